@@ -11,6 +11,8 @@ const addressMax = 255;
 const subleqInstructionBytes = 3;
 
 export const Constants = {
+    wordBits: 8,
+
     // Valid values
     valueMin: -128,
     valueMax: 127,
@@ -29,6 +31,44 @@ export const Constants = {
     subleqInstructionBytes,
 } as const;
 
+/** Word size and memory layout of a machine. Addresses are words, so memory always has one word per possible value, with
+ * the built-in addresses at the top. Constants is the classic configuration (8-bit words and 256 bytes of memory); other
+ * configurations (e.g. 16-bit words and 64K words of memory) are for "extended SIC" programs. */
+export interface MachineConfiguration {
+    wordBits: number;
+    valueMin: number;
+    valueMax: number;
+    addressMin: number;
+    addressInstructionMax: number;
+    addressMax: number;
+    addressUserMax: number;
+    addressInput: number;
+    addressOutput: number;
+    addressHalt: number;
+    subleqInstructionBytes: number;
+}
+
+export function createMachineConfiguration(wordBits: number): MachineConfiguration {
+    if (!Number.isInteger(wordBits) || wordBits < 8 || wordBits > 16) {
+        throw new Error(`Unsupported word size: ${wordBits} (must be an integer on the range [8, 16])`);
+    }
+
+    const wordMax = (1 << wordBits) - 1;
+    return {
+        wordBits,
+        valueMin: -(1 << (wordBits - 1)),
+        valueMax: (1 << (wordBits - 1)) - 1,
+        addressMin: 0,
+        addressInstructionMax: wordMax - subleqInstructionBytes,
+        addressMax: wordMax,
+        addressUserMax: wordMax - 3,
+        addressInput: wordMax - 2,
+        addressOutput: wordMax - 1,
+        addressHalt: wordMax,
+        subleqInstructionBytes,
+    };
+}
+
 // Custom error type
 export interface CompilationContext {
     sourceLineNumber: number;
@@ -212,23 +252,23 @@ export class Assembler {
         return !isNaN(value) && value >= min && value <= max;
     }
 
-    private static isValidValue(str: string): boolean {
-        return Assembler.isValidNumber(str, Constants.valueMin, Constants.valueMax);
+    private static isValidValue(str: string, configuration: MachineConfiguration): boolean {
+        return Assembler.isValidNumber(str, configuration.valueMin, configuration.valueMax);
     }
 
-    private static isValidAddress(str: string): boolean {
-        return Assembler.isValidNumber(str, Constants.addressMin, Constants.addressMax);
+    private static isValidAddress(str: string, configuration: MachineConfiguration): boolean {
+        return Assembler.isValidNumber(str, configuration.addressMin, configuration.addressMax);
     }
 
     private static isLabelReference(expression: Expression): expression is LabelReference {
         return typeof(expression) === "object";
     }
 
-    private static parseAddress(str: string, context: CompilationContext) : number {
-        if (Assembler.isValidAddress(str)) {
+    private static parseAddress(str: string, context: CompilationContext, configuration: MachineConfiguration) : number {
+        if (Assembler.isValidAddress(str, configuration)) {
             return parseInt(str);
         } else {
-            throw new CompilationError(`Invalid argument: ${str} (must be an integer on the range [${Constants.addressMin}, ${Constants.addressMax}])`, context);
+            throw new CompilationError(`Invalid argument: ${str} (must be an integer on the range [${configuration.addressMin}, ${configuration.addressMax}])`, context);
         }
     }
 
@@ -263,29 +303,29 @@ export class Assembler {
         throw new CompilationError(`Internal compiler error on token: ${token.raw}`, context);
     }
 
-    private static parseValueExpression(token: Token, context: CompilationContext): Expression | number[] {
+    private static parseValueExpression(token: Token, context: CompilationContext, configuration: MachineConfiguration): Expression | number[] {
         switch (token.tokenType) {
             case TokenType.numberLiteral:
-                return Assembler.parseValue(token, context);
+                return Assembler.parseValue(token, context, configuration);
 
             case TokenType.characterLiteral:
-                return Assembler.parseCharacter(token, context);
+                return Assembler.parseCharacter(token, context, configuration);
 
             case TokenType.reference:
                 return Assembler.parseReference(token, context);
 
             case TokenType.stringLiteral:
-                return Assembler.parseString(token, context);
+                return Assembler.parseString(token, context, configuration);
 
             default:
                 throw new CompilationError(`Expected number, character, string, or reference, but got: \"${token.raw}\"`, context);
         }
     }
 
-    private static parseAddressExpression(token: Token, context: CompilationContext): Expression {
+    private static parseAddressExpression(token: Token, context: CompilationContext, configuration: MachineConfiguration): Expression {
         switch (token.tokenType) {
             case TokenType.numberLiteral:
-                return Assembler.parseAddress(token.raw, context);
+                return Assembler.parseAddress(token.raw, context, configuration);
 
             case TokenType.reference:
                 return Assembler.parseReference(token, context);
@@ -295,7 +335,7 @@ export class Assembler {
         }
     }
 
-    private static parseLineInternal(tokens: Token[], context: CompilationContext): ParsedLine {
+    private static parseLineInternal(tokens: Token[], context: CompilationContext, configuration: MachineConfiguration): ParsedLine {
         let index = 0;
 
         // Check for label
@@ -342,12 +382,12 @@ export class Assembler {
                     }
 
                     expressions = [
-                        Assembler.parseAddressExpression(commandArguments[0], context),
-                        Assembler.parseAddressExpression(commandArguments[1], context)
+                        Assembler.parseAddressExpression(commandArguments[0], context, configuration),
+                        Assembler.parseAddressExpression(commandArguments[1], context, configuration)
                     ];
 
                     if (commandArguments.length >= 3) {
-                        expressions.push(Assembler.parseAddressExpression(commandArguments[2], context));
+                        expressions.push(Assembler.parseAddressExpression(commandArguments[2], context, configuration));
                     }
                 }
                 break;
@@ -360,7 +400,7 @@ export class Assembler {
 
                     expressions = [];
                     for (const commandArgument of commandArguments) {
-                        const parsedValueExpression = Assembler.parseValueExpression(commandArgument, context);
+                        const parsedValueExpression = Assembler.parseValueExpression(commandArgument, context, configuration);
                         if (Array.isArray(parsedValueExpression)) {
                             expressions.push(...parsedValueExpression);
                         } else {
@@ -382,26 +422,25 @@ export class Assembler {
         };
     };
 
-    public static unsignedToSigned(unsigned: number): number {
-        let signed = unsigned & 0x7f;
-        signed += (unsigned & 0x80) ? -128 : 0;
-        return signed;
+    public static unsignedToSigned(unsigned: number, configuration: MachineConfiguration = Constants): number {
+        const value = unsigned & configuration.addressMax;
+        return (value > configuration.valueMax) ? value - configuration.addressMax - 1 : value;
     }
 
-    public static signedToUnsigned(signed: number): number {
-        return signed & 0xff;
+    public static signedToUnsigned(signed: number, configuration: MachineConfiguration = Constants): number {
+        return signed & configuration.addressMax;
     }
 
-    public static parseValue(token: Token, context?: CompilationContext): number {
+    public static parseValue(token: Token, context?: CompilationContext, configuration: MachineConfiguration = Constants): number {
         const str = token.raw;
-        if (Assembler.isValidValue(str)) {
-            return Assembler.signedToUnsigned(parseInt(str));
+        if (Assembler.isValidValue(str, configuration)) {
+            return Assembler.signedToUnsigned(parseInt(str), configuration);
         } else {
-            throw new CompilationError(`Invalid argument: ${str} (must be an integer on the range [${Constants.valueMin}, ${Constants.valueMax}])`, context);
+            throw new CompilationError(`Invalid argument: ${str} (must be an integer on the range [${configuration.valueMin}, ${configuration.valueMax}])`, context);
         }
     }
 
-    public static parseCharacter(token: Token, context?: CompilationContext): number {
+    public static parseCharacter(token: Token, context?: CompilationContext, configuration: MachineConfiguration = Constants): number {
         if (!token.groups) {
             throw new CompilationError(`Internal compiler error on token: ${token.raw}`, context);
         }
@@ -415,13 +454,13 @@ export class Assembler {
         }
 
         if (token.raw[0] === "-") {
-            value = Assembler.signedToUnsigned(-value);
+            value = Assembler.signedToUnsigned(-value, configuration);
         }
 
         return value;
     }
 
-    public static parseString(token: Token, context?: CompilationContext): number[] {
+    public static parseString(token: Token, context?: CompilationContext, configuration: MachineConfiguration = Constants): number[] {
         if (!token.groups) {
             throw new CompilationError(`Internal compiler error on token: ${token.raw}`, context);
         }
@@ -442,7 +481,7 @@ export class Assembler {
             // Negate, if needed
             if (token.raw[0] === "-") {
                 for (let i = 0; i < output.length; i++) {
-                    output[i] = Assembler.signedToUnsigned(-output[i]);
+                    output[i] = Assembler.signedToUnsigned(-output[i], configuration);
                 }
             }
         }
@@ -453,25 +492,25 @@ export class Assembler {
         return output;
     }
 
-    public static parseLine(line: string) {
+    public static parseLine(line: string, configuration: MachineConfiguration = Constants) {
         const context = {
             sourceLineNumber: 1,
             sourceLine: line,
         };
 
         const tokens = Tokenizer.tokenizeLine(line, context);
-        return Assembler.parseLineInternal(tokens, context);
+        return Assembler.parseLineInternal(tokens, context, configuration);
     }
 
-    public static assemble(lines: string[]): AssembledProgram {
+    public static assemble(lines: string[], configuration: MachineConfiguration = Constants): AssembledProgram {
         let address = 0;
         let labels: {[name: string]: number} = {};
         let addressToLabel = [];
 
-        labels[`MAX`] = Constants.addressUserMax;
-        labels[`IN`] = Constants.addressInput;
-        labels[`OUT`] = Constants.addressOutput;
-        labels[`HALT`] = Constants.addressHalt;
+        labels[`MAX`] = configuration.addressUserMax;
+        labels[`IN`] = configuration.addressInput;
+        labels[`OUT`] = configuration.addressOutput;
+        labels[`HALT`] = configuration.addressHalt;
 
         // Correlate address to source line
         const sourceMap: SourceMapEntry[] = [];
@@ -487,7 +526,7 @@ export class Assembler {
                 };
 
                 const tokens = Tokenizer.tokenizeLine(line, context);
-                const assembledLine = Assembler.parseLineInternal(tokens, context);
+                const assembledLine = Assembler.parseLineInternal(tokens, context, configuration);
 
                 // Add label, if present
                 const label = assembledLine.label;
@@ -509,7 +548,7 @@ export class Assembler {
                         let nextAddress = address;
                         switch (assembledLine.command) {
                             case Command.subleqInstruction:
-                                nextAddress += Constants.subleqInstructionBytes;
+                                nextAddress += configuration.subleqInstructionBytes;
                                 if (lineExpressions.length < 3) {
                                     expressions.push(nextAddress);
                                 }
@@ -550,13 +589,13 @@ export class Assembler {
                 }
 
                 if (expression.negated) {
-                    expressionValue = Assembler.signedToUnsigned(-expressionValue);
+                    expressionValue = Assembler.signedToUnsigned(-expressionValue, configuration);
                 }
 
                 expressionValue += expression.offset;
 
-                if (expressionValue < 0 || expressionValue > Constants.addressMax) {
-                    throw new CompilationError(`Address \"${expression.label}${expression.offset >= 0 ? "+" : ""}${expression.offset}\" (${expressionValue}) is outside of valid range of [${Constants.addressMin}, ${Constants.addressMax}]`, expression.context);
+                if (expressionValue < 0 || expressionValue > configuration.addressMax) {
+                    throw new CompilationError(`Address \"${expression.label}${expression.offset >= 0 ? "+" : ""}${expression.offset}\" (${expressionValue}) is outside of valid range of [${configuration.addressMin}, ${configuration.addressMax}]`, expression.context);
                 }
             } else {
                 expressionValue = expression;
@@ -575,8 +614,8 @@ export class Assembler {
             }
         }
 
-        if (address - 1 > Constants.addressUserMax) {
-            throw new CompilationError(`Program is too long (maximum size: ${Constants.addressUserMax + 1} bytes; program size: ${address} bytes)`);
+        if (address - 1 > configuration.addressUserMax) {
+            throw new CompilationError(`Program is too long (maximum size: ${configuration.addressUserMax + 1} bytes; program size: ${address} bytes)`);
         }
 
         return {
@@ -608,7 +647,188 @@ export interface StateUpdatedData {
     variables: Variable[];
 }
 
+/** Per-address counters collected while profiling (see Emulator.enableProfiling) */
+export interface ExecutionProfile {
+    /** Number of times an instruction starting at each address was executed */
+    executionCounts: Uint32Array;
+
+    /** Number of times the instruction at each address branched (i.e. its result was <= 0) or fell through */
+    branchTakenCounts: Uint32Array;
+    branchNotTakenCounts: Uint32Array;
+
+    /** Number of operand reads and writes of each address (note: instruction fetches aren't included) */
+    readCounts: Uint32Array;
+    writeCounts: Uint32Array;
+}
+
+export interface LineProfile {
+    lineNumber: number;
+    executions: number;
+    branchesTaken: number;
+    branchesNotTaken: number;
+}
+
+export interface AddressProfile {
+    address: number;
+    label?: string;
+    reads: number;
+    writes: number;
+}
+
+/** Profile mapped back to source lines and variables (suitable for serializing to JSON) */
+export interface ProfileSummary {
+    cyclesExecuted: number;
+    lines: LineProfile[];
+    addresses: AddressProfile[];
+}
+
+export function createExecutionProfile(configuration: MachineConfiguration = Constants): ExecutionProfile {
+    const size = configuration.addressMax + 1;
+    return {
+        executionCounts: new Uint32Array(size),
+        branchTakenCounts: new Uint32Array(size),
+        branchNotTakenCounts: new Uint32Array(size),
+        readCounts: new Uint32Array(size),
+        writeCounts: new Uint32Array(size),
+    };
+}
+
+/** Aggregates a profile by source line (instructions that don't start on a source map entry, e.g. due to self-modifying
+ * code, are attributed to the previous entry) and by address (only including addresses that were accessed) */
+export function summarizeProfile(program: AssembledProgram, profile: ExecutionProfile): ProfileSummary {
+    const lineToProfile = new Map<number, LineProfile>();
+    let cyclesExecuted = 0;
+    let lineNumber = -1;
+    for (let address = 0; address < profile.executionCounts.length; address++) {
+        const entry = program.sourceMap[address];
+        if (entry) {
+            lineNumber = entry.lineNumber;
+        }
+
+        const executions = profile.executionCounts[address];
+        cyclesExecuted += executions;
+        if (executions > 0 && lineNumber >= 0) {
+            let lineProfile = lineToProfile.get(lineNumber);
+            if (!lineProfile) {
+                lineProfile = { lineNumber, executions: 0, branchesTaken: 0, branchesNotTaken: 0 };
+                lineToProfile.set(lineNumber, lineProfile);
+            }
+
+            lineProfile.executions += executions;
+            lineProfile.branchesTaken += profile.branchTakenCounts[address];
+            lineProfile.branchesNotTaken += profile.branchNotTakenCounts[address];
+        }
+    }
+
+    const addressToLabel: { [address: number]: string } = {};
+    for (const { label, address } of program.variables) {
+        addressToLabel[address] = label;
+    }
+
+    const addresses: AddressProfile[] = [];
+    for (let address = 0; address < profile.executionCounts.length; address++) {
+        const reads = profile.readCounts[address];
+        const writes = profile.writeCounts[address];
+        if (reads > 0 || writes > 0) {
+            const label = addressToLabel[address];
+            addresses.push({ address, ...(label === undefined ? {} : { label }), reads, writes });
+        }
+    }
+
+    return {
+        cyclesExecuted,
+        lines: Array.from(lineToProfile.values()).sort((a, b) => (a.lineNumber - b.lineNumber)),
+        addresses,
+    };
+}
+
+/** Source of values for @IN (see EmulatorOptions.input) */
+export interface InputDevice {
+    read(): number;
+}
+
+/** Destination for values written to @OUT (see EmulatorOptions.output) */
+export interface OutputDevice {
+    write(value: number): void;
+
+    /** True once no more output is needed (e.g. the expected output has all been produced, or was incorrect) */
+    isDone(): boolean;
+}
+
+/** Describes an incorrect output value (shared by ComparatorOutputDevice and Verifier, so their errors match) */
+export function describeIncorrectOutput(expected: number, actual: number): string {
+    return `expected ${expected} but got ${actual} instead`;
+}
+
+/** Reads input from a span of values. Note: as with Verifier, reading past the end yields undefined (and thus a result
+ * of zero). */
+export class SpanInputDevice implements InputDevice {
+    public index = 0;
+
+    constructor(private readonly values: ArrayLike<number>) {
+    }
+
+    public read(): number {
+        return this.values[this.index++];
+    }
+}
+
+/** Collects output into a preallocated buffer (additional output is discarded once the buffer is full) */
+export class BufferOutputDevice implements OutputDevice {
+    public readonly buffer: Int32Array;
+    public length = 0;
+
+    constructor(capacity: number) {
+        this.buffer = new Int32Array(capacity);
+    }
+
+    public write(value: number): void {
+        if (this.length < this.buffer.length) {
+            this.buffer[this.length++] = value;
+        }
+    }
+
+    public isDone(): boolean {
+        return this.length >= this.buffer.length;
+    }
+
+    public getValues(): number[] {
+        return Array.from(this.buffer.subarray(0, this.length));
+    }
+}
+
+/** Compares output against a span of expected values, and is done at the first mismatch */
+export class ComparatorOutputDevice implements OutputDevice {
+    public length = 0;
+    public mismatchIndex?: number;
+    public errorContext?: string;
+
+    constructor(private readonly expected: ArrayLike<number>) {
+    }
+
+    public write(value: number): void {
+        const expected = this.expected[this.length];
+        if (value !== expected && this.mismatchIndex === undefined) {
+            this.mismatchIndex = this.length;
+            this.errorContext = describeIncorrectOutput(expected, value);
+        }
+
+        this.length++;
+    }
+
+    public isDone(): boolean {
+        return this.mismatchIndex !== undefined || this.length >= this.expected.length;
+    }
+
+    public isCorrect(): boolean {
+        return this.mismatchIndex === undefined && this.length >= this.expected.length;
+    }
+}
+
 export interface EmulatorOptions {
+    // Note: devices take precedence over the per-value callbacks
+    input?: InputDevice;
+    output?: OutputDevice;
     readInput?: () => number;
     writeOutput?: (value: number) => void;
 
@@ -626,6 +846,13 @@ export class Emulator {
     private memory: number[] = [];
     private initialMemorySnapshot: number[];
 
+    // True if memory (and memoryAccessed) may be shared with a fork, in which case it's copied before being modified
+    private memoryShared = false;
+
+    // Addresses whose values have changed since the last call to takeDirtyAddresses (one bit per address)
+    private dirtyAddresses: Uint32Array;
+    private dirty = false;
+
     // Metrics
 
     // Memory access
@@ -635,11 +862,19 @@ export class Emulator {
     // Cycle count
     private cyclesExecuted = 0;
 
-    constructor(private program: AssembledProgram, private callbacks: EmulatorOptions = {}) {
+    // Profiling counters (only collected once enabled)
+    private profile?: ExecutionProfile;
+
+    // Execution trace (only recorded once started)
+    private trace?: TraceWriter;
+
+    constructor(private program: AssembledProgram, private callbacks: EmulatorOptions = {}, private readonly configuration: MachineConfiguration = Constants) {
+        this.dirtyAddresses = new Uint32Array(Math.ceil((configuration.addressMax + 1) / 32));
         const bytes = this.program.bytes;
-        for (let i = 0; i <= Constants.addressMax; i++) {
+        for (let i = 0; i <= configuration.addressMax; i++) {
             const value = (i < bytes.length) ? bytes[i] : 0;
             this.memory[i] = value;
+            this.markDirty(i);
 
             if (this.callbacks.onWriteMemory) {
                 this.callbacks.onWriteMemory(i, value);
@@ -680,7 +915,7 @@ export class Emulator {
             for (let i = 0; i < this.program.variables.length; i++) {
                 variables.push({
                     label: this.program.variables[i].label,
-                    value: Assembler.unsignedToSigned(this.memory[this.program.variables[i].address])
+                    value: Assembler.unsignedToSigned(this.memory[this.program.variables[i].address], this.configuration)
                 });
             }
 
@@ -697,12 +932,20 @@ export class Emulator {
         }
     }
 
+    private ownMemory(): void {
+        if (this.memoryShared) {
+            this.memory = this.memory.slice();
+            this.memoryAccessed = this.memoryAccessed.slice();
+            this.memoryShared = false;
+        }
+    }
+
     private accessMemory(address: number): void {
         if (!this.memoryAccessed[address]) {
+            this.ownMemory();
             this.memoryBytesAccessed++;
+            this.memoryAccessed[address] = true;
         }
-
-        this.memoryAccessed[address] = true;
     };
 
     private readMemory(address: number): number {
@@ -710,9 +953,19 @@ export class Emulator {
         return this.memory[address];
     };
 
+    private markDirty(address: number): void {
+        this.dirtyAddresses[address >>> 5] |= (1 << (address & 31));
+        this.dirty = true;
+    }
+
     private writeMemory(address: number, value: number): void {
         this.accessMemory(address);
-        this.memory[address] = value;
+        if (this.memory[address] !== value) {
+            this.ownMemory();
+            this.markDirty(address);
+            this.memory[address] = value;
+        }
+
         if (this.callbacks.onWriteMemory) {
             this.callbacks.onWriteMemory(address, value);
         }
@@ -727,8 +980,34 @@ export class Emulator {
         return true;
     }
 
+    /** Returns (and clears) the list of addresses whose values have changed since the last call, in ascending order. This
+     * is an alternative to onWriteMemory for consumers that only need to refresh memory occasionally (e.g. a UI that
+     * updates once per frame). Note that all addresses are initially considered changed. */
+    public takeDirtyAddresses(): number[] {
+        const addresses: number[] = [];
+        if (this.dirty) {
+            for (let i = 0; i < this.dirtyAddresses.length; i++) {
+                let bits = this.dirtyAddresses[i];
+                while (bits !== 0) {
+                    const bit = 31 - Math.clz32(bits & -bits);
+                    addresses.push(i * 32 + bit);
+                    bits &= bits - 1;
+                }
+            }
+
+            this.dirtyAddresses.fill(0);
+            this.dirty = false;
+        }
+        return addresses;
+    }
+
+    /** Returns the current value at the given address (unsigned). */
+    public getMemory(address: number): number {
+        return this.memory[address];
+    }
+
     public isRunning(): boolean {
-        return this.ip >= 0 && (this.ip <= Constants.addressInstructionMax);
+        return this.ip >= 0 && (this.ip <= this.configuration.addressInstructionMax);
     };
 
     public getCyclesExecuted(): number {
@@ -739,37 +1018,107 @@ export class Emulator {
         return this.memoryBytesAccessed;
     }
 
+    /** Starts collecting per-address execution, branch, and memory access counters (note: these are not cleared by
+     * reset, so a profile can cover several test sets). */
+    public enableProfiling(): ExecutionProfile {
+        if (!this.profile) {
+            this.profile = createExecutionProfile(this.configuration);
+        }
+        return this.profile;
+    }
+
+    /** Stops collecting counters (and discards them) */
+    public disableProfiling(): void {
+        this.profile = undefined;
+    }
+
+    public getProfile(): ExecutionProfile | undefined {
+        return this.profile;
+    }
+
+    /** Creates an independent copy of the emulator's current state (sharing memory until either copy modifies it), e.g.
+     * to run several continuations of a shared prefix, or to explore "what-if" scenarios. The fork uses the given
+     * callbacks, and doesn't inherit profiling or tracing. Note: resetting a fork returns it to the program's initial
+     * state, not the state at the time of the fork. */
+    public fork(callbacks: EmulatorOptions = {}): Emulator {
+        const fork: Emulator = Object.assign(Object.create(Emulator.prototype), this);
+        fork.callbacks = callbacks;
+        fork.dirtyAddresses = this.dirtyAddresses.slice();
+        fork.profile = undefined;
+        fork.trace = undefined;
+        fork.memoryShared = true;
+        this.memoryShared = true;
+        return fork;
+    }
+
+    /** Starts recording every step to the given trace (note: the caller is responsible for finishing the trace, and the
+     * trace format only supports the classic configuration). */
+    public startTracing(writer: TraceWriter): void {
+        if (this.configuration.wordBits !== Constants.wordBits) {
+            throw new Error("Tracing is only supported for 8-bit machines");
+        }
+
+        this.trace = writer;
+    }
+
+    public getSnapshot(): MachineSnapshot {
+        const { addressMax, wordBits } = this.configuration;
+        const memoryAccessed = new Uint8Array(addressMax + 1);
+        for (let i = 0; i <= addressMax; i++) {
+            memoryAccessed[i] = this.memoryAccessed[i] ? 1 : 0;
+        }
+
+        return {
+            ip: this.ip,
+            cyclesExecuted: this.cyclesExecuted,
+            memoryBytesAccessed: this.memoryBytesAccessed,
+            memory: (wordBits > 8) ? Uint16Array.from(this.memory) : Uint8Array.from(this.memory),
+            memoryAccessed,
+        };
+    }
+
     public step(): void {
         if (this.isRunning()) {
+            const trace = this.trace;
+            if (trace && trace.needsKeyframe()) {
+                trace.writeKeyframe(this.getSnapshot());
+            }
+
+            const { addressMax, addressInput, addressOutput, addressHalt, subleqInstructionBytes } = this.configuration;
+            const address = this.ip;
             const a = this.readMemory(this.ip++);
             const b = this.readMemory(this.ip++);
             const c = this.readMemory(this.ip++);
 
             // Read operands
             let input = 0;
-            if (a === Constants.addressInput || b === Constants.addressInput) {
-                this.accessMemory(Constants.addressInput);
-                if (this.callbacks.readInput) {
+            if (a === addressInput || b === addressInput) {
+                this.accessMemory(addressInput);
+                if (this.callbacks.input) {
+                    input = this.callbacks.input.read();
+                } else if (this.callbacks.readInput) {
                     input = this.callbacks.readInput();
                 }
             }
 
-            const av = (a === Constants.addressInput) ? input : this.readMemory(a);
-            const bv = (b === Constants.addressInput) ? input : this.readMemory(b);
+            const av = (a === addressInput) ? input : this.readMemory(a);
+            const bv = (b === addressInput) ? input : this.readMemory(b);
 
             // Arithmetic (wraps around on overflow)
-            const result = (av - bv) & 0xff;
+            const result = (av - bv) & addressMax;
 
             // Write result
-            const resultSigned = Assembler.unsignedToSigned(result);
+            const resultSigned = Assembler.unsignedToSigned(result, this.configuration);
             switch (a) {
-                case Constants.addressInput:
-                case Constants.addressHalt:
+                case addressInput:
+                case addressHalt:
                     break;
 
-                case Constants.addressOutput:
-                    this.accessMemory(Constants.addressOutput);
-                    if (this.callbacks.writeOutput) {
+                case addressOutput:
+                    this.accessMemory(addressOutput);
+                    if (this.callbacks.output) {
+                        this.callbacks.output.write(resultSigned);
+                    } else if (this.callbacks.writeOutput) {
                         this.callbacks.writeOutput(resultSigned);
                     }
                     break;
@@ -784,6 +1133,29 @@ export class Emulator {
                 this.ip = c;
             }
 
+            const profile = this.profile;
+            if (profile) {
+                profile.executionCounts[address]++;
+                profile.readCounts[a]++;
+                profile.readCounts[b]++;
+                if (a !== addressInput && a !== addressHalt) {
+                    profile.writeCounts[a]++;
+                }
+
+                if (resultSigned <= 0) {
+                    profile.branchTakenCounts[address]++;
+                } else {
+                    profile.branchNotTakenCounts[address]++;
+                }
+            }
+
+            if (trace) {
+                trace.writeStep(
+                    this.ip - address - subleqInstructionBytes,
+                    (a === addressInput || b === addressInput) ? input : undefined,
+                    (a === addressInput || a === addressHalt) ? undefined : result);
+            }
+
             this.cyclesExecuted++;
             this.running = this.isRunning();
             this.stateUpdated();
@@ -806,17 +1178,24 @@ export class Emulator {
     /** Resets the emulator's memory back to its initial state. */
     public reset(): void {
         // Reset state
+        this.ownMemory();
         this.running = true;
         this.ip = 0;
         this.memoryAccessed = [];
         this.memoryBytesAccessed = 0;
         this.cyclesExecuted = 0;
 
+        // Start a new trace block, since the next step doesn't follow from the previous one
+        if (this.trace) {
+            this.trace.flushBlock();
+        }
+
         // Reset memory
-        for (let i = 0; i <= Constants.addressMax; i++) {
+        for (let i = 0; i <= this.configuration.addressMax; i++) {
             const value = this.initialMemorySnapshot[i];
             if (this.memory[i] !== value) {
                 this.memory[i] = value;
+                this.markDirty(i);
                 if (this.callbacks.onWriteMemory) {
                     this.callbacks.onWriteMemory(i, value);
                 }
@@ -827,3 +1206,1354 @@ export class Emulator {
         this.stateUpdated();
     }
 }
+
+export enum VerificationStatus {
+    correct,
+    incorrectOutput,
+    halted,
+    limitExceeded,
+}
+
+export interface VerificationResult {
+    status: VerificationStatus;
+    cyclesExecuted: number;
+    memoryBytesAccessed: number;
+
+    /** Description of the first incorrect output (for VerificationStatus.incorrectOutput) */
+    errorContext?: string;
+}
+
+export interface VerifierTestSet {
+    input: ArrayLike<number>;
+    output: ArrayLike<number>;
+}
+
+export interface VerifierTask extends VerifierTestSet {
+    maxCyclesExecuted: number;
+    maxMemoryBytesAccessed: number;
+}
+
+type WordArray = Uint8Array | Uint16Array;
+
+function createWordArray(configuration: MachineConfiguration): WordArray {
+    const size = configuration.addressMax + 1;
+    return (configuration.wordBits === Constants.wordBits) ? new Uint8Array(size) : new Uint16Array(size);
+}
+
+interface VerifierState {
+    memory: WordArray;
+    memoryAccessed: Uint8Array;
+    ip: number;
+    cyclesExecuted: number;
+    memoryBytesAccessed: number;
+    inputIndex: number;
+    outputIndex: number;
+}
+
+function sharedPrefixLength(a: ArrayLike<number>, b: ArrayLike<number>, max: number): number {
+    let length = 0;
+    while (length < max && length < b.length && a[length] === b[length]) {
+        length++;
+    }
+    return length;
+}
+
+/** Runs a program against precomputed test sets without any of the Emulator's callbacks or per-step bookkeeping (used
+ * for server-side verification, where only the verdict and stats matter). The semantics match Emulator.step(). */
+export class Verifier {
+    private readonly initialMemory: WordArray;
+    private readonly memory: WordArray;
+    private readonly memoryAccessed: Uint8Array;
+
+    constructor(bytes: ArrayLike<number>, private readonly configuration: MachineConfiguration = Constants) {
+        this.initialMemory = createWordArray(configuration);
+        this.memory = createWordArray(configuration);
+        this.memoryAccessed = new Uint8Array(configuration.addressMax + 1);
+
+        const length = Math.min(bytes.length, configuration.addressMax + 1);
+        for (let i = 0; i < length; i++) {
+            this.initialMemory[i] = bytes[i];
+        }
+    }
+
+    /** Runs from the initial state until all expected outputs have been produced (or the program fails or exceeds either
+     * limit). */
+    public verify(inputs: ArrayLike<number>, expectedOutputs: ArrayLike<number>, maxCyclesExecuted: number, maxMemoryBytesAccessed: number): VerificationResult {
+        return this.run(this.createInitialState(), inputs, expectedOutputs, expectedOutputs.length, maxCyclesExecuted, maxMemoryBytesAccessed, Infinity, Infinity)!;
+    }
+
+    /** Verifies several test sets (each with its own limits) in lockstep, running each one for cyclesPerSlice cycles at a
+     * time, and stops as soon as any of them fails. This way, a failure in one test set is found without first running
+     * the others to completion. Test sets that were cancelled (because another one failed first) have no result. */
+    public verifyUntilFailure(tasks: ArrayLike<VerifierTask>, cyclesPerSlice = 1000): (VerificationResult | undefined)[] {
+        const runs = Array.from(tasks, task => ({
+            task,
+            state: this.createInitialState(createWordArray(this.configuration), new Uint8Array(this.configuration.addressMax + 1)),
+            result: undefined as VerificationResult | undefined,
+        }));
+
+        let remaining = runs.length;
+        for (let pauseAtCycle = cyclesPerSlice; remaining > 0; pauseAtCycle += cyclesPerSlice) {
+            for (const run of runs) {
+                if (!run.result) {
+                    const { input, output, maxCyclesExecuted, maxMemoryBytesAccessed } = run.task;
+                    run.result = this.run(run.state, input, output, output.length, maxCyclesExecuted, maxMemoryBytesAccessed, Infinity, pauseAtCycle);
+                    if (run.result) {
+                        remaining--;
+                        if (run.result.status !== VerificationStatus.correct) {
+                            remaining = 0;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        return runs.map(run => run.result);
+    }
+
+    /** Verifies several test sets, with results identical to calling verify for each one. Execution is deterministic until
+     * the program reads input (or produces output) that differs between sets, so the prefix that all of the sets share
+     * (e.g. a puzzle's fixed tests) is only run once, and each set then continues from a copy of that state. */
+    public verifyTestSets(testSets: ArrayLike<VerifierTestSet>, maxCyclesExecuted: number, maxMemoryBytesAccessed: number): VerificationResult[] {
+        if (testSets.length === 0) {
+            return [];
+        }
+
+        let sharedInputLength = testSets[0].input.length;
+        let sharedOutputLength = testSets[0].output.length;
+        for (let i = 1; i < testSets.length; i++) {
+            sharedInputLength = sharedPrefixLength(testSets[0].input, testSets[i].input, sharedInputLength);
+            sharedOutputLength = sharedPrefixLength(testSets[0].output, testSets[i].output, sharedOutputLength);
+        }
+
+        // Note: a "correct" result for the prefix just means that it completed (or paused before reading unshared input)
+        const prefixState = this.createInitialState();
+        const prefixResult = this.run(prefixState, testSets[0].input, testSets[0].output, sharedOutputLength, maxCyclesExecuted, maxMemoryBytesAccessed, sharedInputLength, Infinity);
+        if (prefixResult && prefixResult.status !== VerificationStatus.correct) {
+            return Array.from(testSets, () => ({ ...prefixResult }));
+        }
+
+        const checkpointMemory = prefixState.memory.slice();
+        const checkpointMemoryAccessed = prefixState.memoryAccessed.slice();
+        return Array.from(testSets, ({ input, output }) => {
+            const state = { ...prefixState };
+            state.memory.set(checkpointMemory);
+            state.memoryAccessed.set(checkpointMemoryAccessed);
+            return this.run(state, input, output, output.length, maxCyclesExecuted, maxMemoryBytesAccessed, Infinity, Infinity)!;
+        });
+    }
+
+    private createInitialState(memory = this.memory, memoryAccessed = this.memoryAccessed): VerifierState {
+        memory.set(this.initialMemory);
+        memoryAccessed.fill(0);
+        return {
+            memory,
+            memoryAccessed,
+            ip: 0,
+            cyclesExecuted: 0,
+            memoryBytesAccessed: 0,
+            inputIndex: 0,
+            outputIndex: 0,
+        };
+    }
+
+    /** Runs until outputCount outputs have been produced (or the program fails or exceeds either limit). If the program
+     * tries to read input at inputLimit (or beyond), or reaches pauseAtCycle, it is paused instead, and undefined is
+     * returned. Either way, the state is updated in place (so that it can be resumed). */
+    private run(state: VerifierState, inputs: ArrayLike<number>, expectedOutputs: ArrayLike<number>, outputCount: number, maxCyclesExecuted: number, maxMemoryBytesAccessed: number, inputLimit: number, pauseAtCycle: number): VerificationResult | undefined {
+        return (this.configuration.wordBits === Constants.wordBits)
+            ? Verifier.runClassic(state, inputs, expectedOutputs, outputCount, maxCyclesExecuted, maxMemoryBytesAccessed, inputLimit, pauseAtCycle)
+            : Verifier.runExtended(state, inputs, expectedOutputs, outputCount, maxCyclesExecuted, maxMemoryBytesAccessed, inputLimit, pauseAtCycle, this.configuration);
+    }
+
+    // Note: the classic configuration has its own copy of the interpreter loop, with the word size and built-in addresses
+    // as constants (and memory always a Uint8Array), since that's measurably faster; runExtended must be kept in sync
+    private static runClassic(state: VerifierState, inputs: ArrayLike<number>, expectedOutputs: ArrayLike<number>, outputCount: number, maxCyclesExecuted: number, maxMemoryBytesAccessed: number, inputLimit: number, pauseAtCycle: number): VerificationResult | undefined {
+        const { memory, memoryAccessed } = state;
+        const { addressInstructionMax, addressInput, addressOutput, addressHalt } = Constants;
+        let { ip, cyclesExecuted, memoryBytesAccessed, inputIndex, outputIndex } = state;
+        let errorContext: string | undefined;
+        let paused = false;
+
+        while (outputIndex < outputCount && cyclesExecuted <= maxCyclesExecuted && memoryBytesAccessed <= maxMemoryBytesAccessed) {
+            if (ip > addressInstructionMax) {
+                break;
+            }
+
+            if (cyclesExecuted >= pauseAtCycle) {
+                paused = true;
+                break;
+            }
+
+            const a = memory[ip];
+            const b = memory[ip + 1];
+            const c = memory[ip + 2];
+            const readsInput = (a === addressInput || b === addressInput);
+            if (readsInput && inputIndex >= inputLimit) {
+                paused = true;
+                break;
+            }
+
+            for (let address = ip; address < ip + 3; address++) {
+                if (!memoryAccessed[address]) {
+                    memoryAccessed[address] = 1;
+                    memoryBytesAccessed++;
+                }
+            }
+
+            // Note: as in Emulator, reading past the end of the input yields undefined, and thus a result of zero
+            let input = 0;
+            if (readsInput) {
+                input = inputs[inputIndex++];
+            }
+
+            let av = input;
+            if (a !== addressInput) {
+                av = memory[a];
+            }
+
+            let bv = input;
+            if (b !== addressInput) {
+                bv = memory[b];
+            }
+
+            if (!memoryAccessed[a]) {
+                memoryAccessed[a] = 1;
+                memoryBytesAccessed++;
+            }
+
+            if (!memoryAccessed[b]) {
+                memoryAccessed[b] = 1;
+                memoryBytesAccessed++;
+            }
+
+            const result = (av - bv) & 0xff;
+            const resultSigned = (result & 0x80) ? result - 256 : result;
+            if (a === addressOutput) {
+                const expected = expectedOutputs[outputIndex++];
+                if (resultSigned !== expected && errorContext === undefined) {
+                    errorContext = describeIncorrectOutput(expected, resultSigned);
+                }
+            } else if (a !== addressInput && a !== addressHalt) {
+                memory[a] = result;
+            }
+
+            ip = (resultSigned <= 0) ? c : ip + 3;
+            cyclesExecuted++;
+
+            if (errorContext !== undefined) {
+                break;
+            }
+        }
+
+        state.ip = ip;
+        state.cyclesExecuted = cyclesExecuted;
+        state.memoryBytesAccessed = memoryBytesAccessed;
+        state.inputIndex = inputIndex;
+        state.outputIndex = outputIndex;
+
+        if (paused) {
+            return undefined;
+        }
+
+        if (cyclesExecuted > maxCyclesExecuted || memoryBytesAccessed > maxMemoryBytesAccessed) {
+            return { status: VerificationStatus.limitExceeded, cyclesExecuted, memoryBytesAccessed };
+        }
+
+        if (errorContext !== undefined) {
+            return { status: VerificationStatus.incorrectOutput, cyclesExecuted, memoryBytesAccessed, errorContext };
+        }
+
+        if (outputIndex < outputCount) {
+            return { status: VerificationStatus.halted, cyclesExecuted, memoryBytesAccessed };
+        }
+
+        return { status: VerificationStatus.correct, cyclesExecuted, memoryBytesAccessed };
+    }
+
+    /** Same as runClassic, but for any configuration (word size and addresses aren't constants, so this is slower) */
+    private static runExtended(state: VerifierState, inputs: ArrayLike<number>, expectedOutputs: ArrayLike<number>, outputCount: number, maxCyclesExecuted: number, maxMemoryBytesAccessed: number, inputLimit: number, pauseAtCycle: number, configuration: MachineConfiguration): VerificationResult | undefined {
+        const { memory, memoryAccessed } = state;
+        const { addressInstructionMax, addressInput, addressOutput, addressHalt, addressMax: wordMask, valueMax } = configuration;
+        const signBit = valueMax + 1;
+        const wordCount = wordMask + 1;
+        let { ip, cyclesExecuted, memoryBytesAccessed, inputIndex, outputIndex } = state;
+        let errorContext: string | undefined;
+        let paused = false;
+
+        while (outputIndex < outputCount && cyclesExecuted <= maxCyclesExecuted && memoryBytesAccessed <= maxMemoryBytesAccessed) {
+            if (ip > addressInstructionMax) {
+                break;
+            }
+
+            if (cyclesExecuted >= pauseAtCycle) {
+                paused = true;
+                break;
+            }
+
+            const a = memory[ip];
+            const b = memory[ip + 1];
+            const c = memory[ip + 2];
+            const readsInput = (a === addressInput || b === addressInput);
+            if (readsInput && inputIndex >= inputLimit) {
+                paused = true;
+                break;
+            }
+
+            for (let address = ip; address < ip + 3; address++) {
+                if (!memoryAccessed[address]) {
+                    memoryAccessed[address] = 1;
+                    memoryBytesAccessed++;
+                }
+            }
+
+            // Note: as in Emulator, reading past the end of the input yields undefined, and thus a result of zero
+            let input = 0;
+            if (readsInput) {
+                input = inputs[inputIndex++];
+            }
+
+            let av = input;
+            if (a !== addressInput) {
+                av = memory[a];
+            }
+
+            let bv = input;
+            if (b !== addressInput) {
+                bv = memory[b];
+            }
+
+            if (!memoryAccessed[a]) {
+                memoryAccessed[a] = 1;
+                memoryBytesAccessed++;
+            }
+
+            if (!memoryAccessed[b]) {
+                memoryAccessed[b] = 1;
+                memoryBytesAccessed++;
+            }
+
+            const result = (av - bv) & wordMask;
+            const resultSigned = (result & signBit) ? result - wordCount : result;
+            if (a === addressOutput) {
+                const expected = expectedOutputs[outputIndex++];
+                if (resultSigned !== expected && errorContext === undefined) {
+                    errorContext = describeIncorrectOutput(expected, resultSigned);
+                }
+            } else if (a !== addressInput && a !== addressHalt) {
+                memory[a] = result;
+            }
+
+            ip = (resultSigned <= 0) ? c : ip + 3;
+            cyclesExecuted++;
+
+            if (errorContext !== undefined) {
+                break;
+            }
+        }
+
+        state.ip = ip;
+        state.cyclesExecuted = cyclesExecuted;
+        state.memoryBytesAccessed = memoryBytesAccessed;
+        state.inputIndex = inputIndex;
+        state.outputIndex = outputIndex;
+
+        if (paused) {
+            return undefined;
+        }
+
+        if (cyclesExecuted > maxCyclesExecuted || memoryBytesAccessed > maxMemoryBytesAccessed) {
+            return { status: VerificationStatus.limitExceeded, cyclesExecuted, memoryBytesAccessed };
+        }
+
+        if (errorContext !== undefined) {
+            return { status: VerificationStatus.incorrectOutput, cyclesExecuted, memoryBytesAccessed, errorContext };
+        }
+
+        if (outputIndex < outputCount) {
+            return { status: VerificationStatus.halted, cyclesExecuted, memoryBytesAccessed };
+        }
+
+        return { status: VerificationStatus.correct, cyclesExecuted, memoryBytesAccessed };
+    }
+}
+
+/** Results of statically analyzing a program's initial memory image (see analyzeProgram). The analysis is conservative:
+ * "reachable" and "writable" may include addresses that are never actually executed or written, but never omit any. */
+export interface ProgramAnalysis {
+    /** One byte per address: 1 if an instruction starting at the address may be executed */
+    reachable: Uint8Array;
+
+    /** One byte per address: 1 if the address may be written (note: @OUT is never written, since writes go to output) */
+    writable: Uint8Array;
+
+    /** One byte per address: 1 if the address always reads as its initial value (i.e. it's neither writable nor @IN) */
+    constant: Uint8Array;
+
+    /** True if a reachable instruction's own bytes may be written. In that case, nothing is known about its operands, so
+     * every instruction slot is considered reachable and every (user) address writable. */
+    selfModifying: boolean;
+
+    /** One byte per address: 1 if the address is accessed in every run, up to (and including) its first output */
+    accessed: Uint8Array;
+
+    /** Lower bound on memoryBytesAccessed for any run that produces output (i.e. the number of "accessed" addresses) */
+    minimumMemoryBytesAccessed: number;
+}
+
+enum BranchOutcome {
+    never,
+    always,
+    unknown,
+}
+
+/** Statically analyzes a program for the classic configuration (e.g. to find dead code or self-modification, or to bound
+ * memoryBytesAccessed) without running it. The analysis grows the sets of reachable instructions and writable addresses
+ * until neither changes. */
+export function analyzeProgram(bytes: ArrayLike<number>): ProgramAnalysis {
+    const { addressInstructionMax, addressInput, addressOutput, addressHalt } = Constants;
+    const memory = new Uint8Array(addressMax + 1);
+    const length = Math.min(bytes.length, addressMax + 1);
+    for (let i = 0; i < length; i++) {
+        memory[i] = bytes[i];
+    }
+
+    const reachable = new Uint8Array(addressMax + 1);
+    const writable = new Uint8Array(addressMax + 1);
+    let selfModifying = false;
+
+    // Note: an operand's value is only known if it's never written (and isn't input); subtracting an address from itself
+    // always yields zero (even for @IN, since input is only read once per instruction)
+    const getBranchOutcome = (a: number, b: number): BranchOutcome => {
+        if (a === b) {
+            return BranchOutcome.always;
+        }
+
+        if (a === addressInput || b === addressInput || writable[a] || writable[b]) {
+            return BranchOutcome.unknown;
+        }
+
+        return (Assembler.unsignedToSigned((memory[a] - memory[b]) & 0xff) <= 0) ? BranchOutcome.always : BranchOutcome.never;
+    };
+
+    reachable[0] = 1;
+    let changed = true;
+    while (changed && !selfModifying) {
+        changed = false;
+        for (let ip = 0; ip <= addressInstructionMax; ip++) {
+            if (!reachable[ip]) {
+                continue;
+            }
+
+            if (writable[ip] || writable[ip + 1] || writable[ip + 2]) {
+                selfModifying = true;
+                break;
+            }
+
+            const a = memory[ip];
+            const b = memory[ip + 1];
+            const c = memory[ip + 2];
+            if (a !== addressInput && a !== addressOutput && a !== addressHalt && !writable[a]) {
+                writable[a] = 1;
+                changed = true;
+            }
+
+            const outcome = getBranchOutcome(a, b);
+            if (outcome !== BranchOutcome.never && c <= addressInstructionMax && !reachable[c]) {
+                reachable[c] = 1;
+                changed = true;
+            }
+
+            const next = ip + subleqInstructionBytes;
+            if (outcome !== BranchOutcome.always && next <= addressInstructionMax && !reachable[next]) {
+                reachable[next] = 1;
+                changed = true;
+            }
+        }
+    }
+
+    if (selfModifying) {
+        reachable.fill(1, 0, addressInstructionMax + 1);
+        writable.fill(1, 0, addressInput);
+    }
+
+    const constant = new Uint8Array(addressMax + 1);
+    for (let address = 0; address <= addressMax; address++) {
+        constant[address] = (writable[address] || address === addressInput) ? 0 : 1;
+    }
+
+    // Follow the path that every run takes, until the first output, a data-dependent branch, or a loop (note: runs may
+    // stop as soon as the expected output has been produced, so nothing past the first output is guaranteed)
+    const accessed = new Uint8Array(addressMax + 1);
+    const visited = new Uint8Array(addressMax + 1);
+    let ip = 0;
+    while (ip <= addressInstructionMax && !visited[ip]) {
+        visited[ip] = 1;
+        accessed[ip] = accessed[ip + 1] = accessed[ip + 2] = 1;
+        if (!constant[ip] || !constant[ip + 1] || !constant[ip + 2]) {
+            break;
+        }
+
+        const a = memory[ip];
+        const b = memory[ip + 1];
+        const c = memory[ip + 2];
+        accessed[a] = accessed[b] = 1;
+        const outcome = getBranchOutcome(a, b);
+        if (a === addressOutput || outcome === BranchOutcome.unknown) {
+            break;
+        }
+
+        ip = (outcome === BranchOutcome.always) ? c : ip + subleqInstructionBytes;
+    }
+
+    let minimumMemoryBytesAccessed = 0;
+    for (let address = 0; address <= addressMax; address++) {
+        minimumMemoryBytesAccessed += accessed[address];
+    }
+
+    return { reachable, writable, constant, selfModifying, accessed, minimumMemoryBytesAccessed };
+}
+
+/** Complete machine state (e.g. at a point in an execution trace) */
+export interface MachineSnapshot {
+    ip: number;
+    cyclesExecuted: number;
+    memoryBytesAccessed: number;
+
+    /** Memory (unsigned words; Uint16Array for configurations with more than 8 bits per word) */
+    memory: Uint8Array | Uint16Array;
+
+    /** One byte per address: 1 if the address has been accessed, 0 otherwise */
+    memoryAccessed: Uint8Array;
+}
+
+export interface TraceEvent {
+    step: number;
+    input?: number;
+    output?: number;
+}
+
+export interface TraceWriterOptions {
+    /** Number of steps between keyframes (i.e. full snapshots); smaller blocks make seeking faster but traces larger */
+    stepsPerBlock?: number;
+
+    /** Optional compression for each block (e.g. zlib on the server); the same transform must be reversed when reading */
+    compressBlock?: (block: Uint8Array) => Uint8Array;
+
+    /** If provided, the trace is streamed to this function as blocks are completed (instead of returned by finish) */
+    write?: (chunk: Uint8Array) => void;
+}
+
+// Execution trace format (integers are unsigned LEB128 varints, unless noted):
+//
+//  * Header: "SIC1TRC", version (byte), flags (byte; 1 = blocks are compressed), steps per block
+//  * Blocks: length, then (possibly compressed) block data
+//  * Index: block count, then for each block: step count, offset (relative to the previous block's offset)
+//  * Trailer: offset of the index (uint32, little-endian)
+//
+// Block data is a keyframe (ip byte, cyclesExecuted, memoryBytesAccessed, 256 bytes of memory, 32 bytes of "accessed"
+// bits), the step count, and then one record per step:
+//
+//  * The next ip, relative to the fall-through address (zig-zag encoded)
+//  * If the instruction read input: the input value (byte)
+//  * If the instruction wrote to memory or output: the value written (byte)
+//
+// Everything else (which addresses were accessed or written, etc.) is derived from the snapshot while replaying.
+const traceMagic = "SIC1TRC";
+const traceVersion = 1;
+const traceFlagCompressed = 1;
+
+function invalidTrace(): never {
+    throw new Error("Invalid trace");
+}
+
+class ByteWriter {
+    private buffer = new Uint8Array(1024);
+    public length = 0;
+
+    private ensureCapacity(size: number): void {
+        if (this.length + size > this.buffer.length) {
+            const buffer = new Uint8Array(Math.max(this.buffer.length * 2, this.length + size));
+            buffer.set(this.buffer.subarray(0, this.length));
+            this.buffer = buffer;
+        }
+    }
+
+    public writeByte(value: number): void {
+        this.ensureCapacity(1);
+        this.buffer[this.length++] = value;
+    }
+
+    public writeVarint(value: number): void {
+        this.ensureCapacity(5);
+        while (value >= 0x80) {
+            this.buffer[this.length++] = (value & 0x7f) | 0x80;
+            value >>>= 7;
+        }
+        this.buffer[this.length++] = value;
+    }
+
+    public writeSignedVarint(value: number): void {
+        this.writeVarint((value << 1) ^ (value >> 31));
+    }
+
+    public writeBytes(bytes: ArrayLike<number>): void {
+        this.ensureCapacity(bytes.length);
+        this.buffer.set(bytes, this.length);
+        this.length += bytes.length;
+    }
+
+    public writeUInt32(value: number): void {
+        for (let i = 0; i < 4; i++) {
+            this.writeByte((value >>> (8 * i)) & 0xff);
+        }
+    }
+
+    /** Returns (and clears) the written bytes */
+    public take(): Uint8Array {
+        const bytes = this.buffer.slice(0, this.length);
+        this.length = 0;
+        return bytes;
+    }
+}
+
+class ByteReader {
+    constructor(private bytes: Uint8Array, public offset = 0) {
+    }
+
+    public readByte(): number {
+        if (this.offset >= this.bytes.length) {
+            invalidTrace();
+        }
+        return this.bytes[this.offset++];
+    }
+
+    public readVarint(): number {
+        let value = 0;
+        for (let shift = 0; shift < 35; shift += 7) {
+            const byte = this.readByte();
+            value |= (byte & 0x7f) << shift;
+            if ((byte & 0x80) === 0) {
+                return value >>> 0;
+            }
+        }
+        return invalidTrace();
+    }
+
+    public readSignedVarint(): number {
+        const value = this.readVarint();
+        return (value >>> 1) ^ -(value & 1);
+    }
+
+    public readBytes(length: number): Uint8Array {
+        if (this.offset + length > this.bytes.length) {
+            invalidTrace();
+        }
+        const bytes = this.bytes.subarray(this.offset, this.offset + length);
+        this.offset += length;
+        return bytes;
+    }
+}
+
+/** Records an execution trace (see Emulator.startTracing) */
+export class TraceWriter {
+    private readonly stepsPerBlock: number;
+    private readonly output = new ByteWriter();
+    private readonly block = new ByteWriter();
+    private readonly chunks: Uint8Array[] = [];
+    private readonly index: { stepCount: number, offset: number }[] = [];
+    private keyframe?: Uint8Array;
+    private blockStepCount = 0;
+    private offset = 0;
+    private finished = false;
+
+    constructor(private readonly options: TraceWriterOptions = {}) {
+        this.stepsPerBlock = options.stepsPerBlock ?? 4096;
+
+        for (let i = 0; i < traceMagic.length; i++) {
+            this.output.writeByte(traceMagic.charCodeAt(i));
+        }
+        this.output.writeByte(traceVersion);
+        this.output.writeByte(options.compressBlock ? traceFlagCompressed : 0);
+        this.output.writeVarint(this.stepsPerBlock);
+        this.emit();
+    }
+
+    /** True if a keyframe must be written before the next step */
+    public needsKeyframe(): boolean {
+        return this.keyframe === undefined;
+    }
+
+    public writeKeyframe(snapshot: MachineSnapshot): void {
+        const keyframe = new ByteWriter();
+        keyframe.writeByte(snapshot.ip);
+        keyframe.writeVarint(snapshot.cyclesExecuted);
+        keyframe.writeVarint(snapshot.memoryBytesAccessed);
+        keyframe.writeBytes(snapshot.memory);
+        for (let i = 0; i <= addressMax; i += 8) {
+            let bits = 0;
+            for (let j = 0; j < 8; j++) {
+                bits |= (snapshot.memoryAccessed[i + j] ? 1 : 0) << j;
+            }
+            keyframe.writeByte(bits);
+        }
+        this.keyframe = keyframe.take();
+    }
+
+    public writeStep(ipDelta: number, input?: number, written?: number): void {
+        const block = this.block;
+        block.writeSignedVarint(ipDelta);
+        if (input !== undefined) {
+            block.writeByte(input & 0xff);
+        }
+        if (written !== undefined) {
+            block.writeByte(written & 0xff);
+        }
+
+        if (++this.blockStepCount >= this.stepsPerBlock) {
+            this.flushBlock();
+        }
+    }
+
+    /** Ends the current block (e.g. because the machine was reset), so that the next step starts with a keyframe */
+    public flushBlock(): void {
+        if (this.keyframe) {
+            const data = new ByteWriter();
+            data.writeBytes(this.keyframe);
+            data.writeVarint(this.blockStepCount);
+            data.writeBytes(this.block.take());
+            const payload = this.options.compressBlock ? this.options.compressBlock(data.take()) : data.take();
+
+            this.index.push({ stepCount: this.blockStepCount, offset: this.offset });
+            this.output.writeVarint(payload.length);
+            this.output.writeBytes(payload);
+            this.emit();
+
+            this.keyframe = undefined;
+            this.blockStepCount = 0;
+        }
+    }
+
+    /** Writes the index; returns the whole trace, unless it was streamed */
+    public finish(): Uint8Array | undefined {
+        if (!this.finished) {
+            this.finished = true;
+            this.flushBlock();
+
+            const indexOffset = this.offset;
+            this.output.writeVarint(this.index.length);
+            let previousOffset = 0;
+            for (const { stepCount, offset } of this.index) {
+                this.output.writeVarint(stepCount);
+                this.output.writeVarint(offset - previousOffset);
+                previousOffset = offset;
+            }
+            this.output.writeUInt32(indexOffset);
+            this.emit();
+        }
+
+        if (this.options.write) {
+            return undefined;
+        }
+
+        const trace = new Uint8Array(this.offset);
+        let offset = 0;
+        for (const chunk of this.chunks) {
+            trace.set(chunk, offset);
+            offset += chunk.length;
+        }
+        return trace;
+    }
+
+    private emit(): void {
+        const chunk = this.output.take();
+        this.offset += chunk.length;
+        if (this.options.write) {
+            this.options.write(chunk);
+        } else {
+            this.chunks.push(chunk);
+        }
+    }
+}
+
+interface TraceBlock {
+    firstStep: number;
+    stepCount: number;
+    offset: number;
+}
+
+/** Reconstructs machine state at any step of a trace written by TraceWriter */
+export class TraceReader {
+    private readonly compressed: boolean;
+    private readonly blocks: TraceBlock[] = [];
+    private readonly stepCount: number;
+
+    constructor(private readonly trace: Uint8Array, private readonly decompressBlock?: (block: Uint8Array) => Uint8Array) {
+        const reader = new ByteReader(trace);
+        for (let i = 0; i < traceMagic.length; i++) {
+            if (reader.readByte() !== traceMagic.charCodeAt(i)) {
+                invalidTrace();
+            }
+        }
+
+        if (reader.readByte() !== traceVersion) {
+            invalidTrace();
+        }
+
+        this.compressed = (reader.readByte() & traceFlagCompressed) !== 0;
+        if (this.compressed && !decompressBlock) {
+            throw new Error("Trace is compressed, but no decompression function was provided");
+        }
+
+        // Read the index
+        if (trace.length < 4) {
+            invalidTrace();
+        }
+
+        const trailerOffset = trace.length - 4;
+        const indexOffset = (trace[trailerOffset] | (trace[trailerOffset + 1] << 8) | (trace[trailerOffset + 2] << 16) | (trace[trailerOffset + 3] << 24)) >>> 0;
+        if (indexOffset > trailerOffset) {
+            invalidTrace();
+        }
+
+        const indexReader = new ByteReader(trace.subarray(0, trailerOffset), indexOffset);
+        const blockCount = indexReader.readVarint();
+        let firstStep = 0;
+        let offset = 0;
+        for (let i = 0; i < blockCount; i++) {
+            const stepCount = indexReader.readVarint();
+            offset += indexReader.readVarint();
+            if (offset >= indexOffset) {
+                invalidTrace();
+            }
+
+            this.blocks.push({ firstStep, stepCount, offset });
+            firstStep += stepCount;
+        }
+        this.stepCount = firstStep;
+    }
+
+    /** Returns the total number of steps recorded */
+    public getStepCount(): number {
+        return this.stepCount;
+    }
+
+    /** Returns the machine state after the given number of steps (note: if the machine was reset, the state at the
+     * first step after the reset is the reset state) */
+    public getState(step: number): MachineSnapshot {
+        if (step < 0 || step > this.stepCount || this.blocks.length === 0) {
+            throw new Error(`Step ${step} is not in the trace`);
+        }
+
+        // Find the last block starting at or before the step
+        let low = 0;
+        let high = this.blocks.length - 1;
+        while (low < high) {
+            const middle = (low + high + 1) >>> 1;
+            if (this.blocks[middle].firstStep <= step) {
+                low = middle;
+            } else {
+                high = middle - 1;
+            }
+        }
+
+        const block = this.blocks[low];
+        const { snapshot } = this.replayBlock(block, step - block.firstStep);
+        return snapshot;
+    }
+
+    /** Returns all input and output events, in order */
+    public getEvents(): TraceEvent[] {
+        const events: TraceEvent[] = [];
+        for (const block of this.blocks) {
+            events.push(...this.replayBlock(block, block.stepCount).events);
+        }
+        return events;
+    }
+
+    private replayBlock(block: TraceBlock, stepCount: number): { snapshot: MachineSnapshot, events: TraceEvent[] } {
+        // Read the block's data
+        const blockReader = new ByteReader(this.trace, block.offset);
+        const length = blockReader.readVarint();
+        const payload = blockReader.readBytes(length);
+        const reader = new ByteReader(this.compressed ? this.decompressBlock!(payload) : payload);
+
+        // Restore the keyframe
+        let ip = reader.readByte();
+        let cyclesExecuted = reader.readVarint();
+        let memoryBytesAccessed = reader.readVarint();
+        const memory = reader.readBytes(addressMax + 1).slice();
+        const accessedBits = reader.readBytes((addressMax + 1) / 8);
+        const memoryAccessed = new Uint8Array(addressMax + 1);
+        for (let i = 0; i <= addressMax; i++) {
+            memoryAccessed[i] = (accessedBits[i >>> 3] >>> (i & 7)) & 1;
+        }
+
+        if (reader.readVarint() !== block.stepCount) {
+            invalidTrace();
+        }
+
+        const access = (address: number) => {
+            if (!memoryAccessed[address]) {
+                memoryAccessed[address] = 1;
+                memoryBytesAccessed++;
+            }
+        };
+
+        // Apply steps
+        const { addressInstructionMax, addressInput, addressOutput, addressHalt } = Constants;
+        const events: TraceEvent[] = [];
+        for (let i = 0; i < stepCount; i++) {
+            if (ip > addressInstructionMax) {
+                invalidTrace();
+            }
+
+            const a = memory[ip];
+            const b = memory[ip + 1];
+            access(ip);
+            access(ip + 1);
+            access(ip + 2);
+            access(a);
+            access(b);
+
+            const nextIp = ip + subleqInstructionBytes + reader.readSignedVarint();
+            if (nextIp < 0 || nextIp > addressMax) {
+                invalidTrace();
+            }
+
+            const step = block.firstStep + i;
+            if (a === addressInput || b === addressInput) {
+                events.push({ step, input: Assembler.unsignedToSigned(reader.readByte()) });
+            }
+
+            if (a === addressOutput) {
+                events.push({ step, output: Assembler.unsignedToSigned(reader.readByte()) });
+            } else if (a !== addressInput && a !== addressHalt) {
+                memory[a] = reader.readByte();
+            }
+
+            ip = nextIp;
+            cyclesExecuted++;
+        }
+
+        return {
+            snapshot: { ip, cyclesExecuted, memoryBytesAccessed, memory, memoryAccessed },
+            events,
+        };
+    }
+}
+
+/** One end of a bounded FIFO between cores in a Network. Implementations must never block: cores check canRead or
+ * canWrite first, and wait (without executing the instruction) until the channel is ready. */
+export interface NetworkChannel {
+    canRead(): boolean;
+    read(): number;
+    canWrite(): boolean;
+    write(value: number): void;
+}
+
+/** Bounded FIFO for connecting cores that run on the same thread (capacity can be Infinity, e.g. for external I/O) */
+export class Channel implements NetworkChannel {
+    private values: number[] = [];
+    private head = 0;
+
+    constructor(public readonly capacity = 1, values: number[] = []) {
+        if (!(capacity >= 1)) {
+            throw new Error(`Invalid channel capacity: ${capacity}`);
+        }
+
+        this.values = values.slice();
+    }
+
+    public get length(): number {
+        return this.values.length - this.head;
+    }
+
+    public canRead(): boolean {
+        return this.head < this.values.length;
+    }
+
+    public read(): number {
+        const value = this.values[this.head++];
+
+        // Drop consumed values occasionally (instead of shifting the array on every read)
+        if (this.head >= 1024 && this.head * 2 >= this.values.length) {
+            this.values = this.values.slice(this.head);
+            this.head = 0;
+        }
+
+        return value;
+    }
+
+    public canWrite(): boolean {
+        return this.length < this.capacity;
+    }
+
+    public write(value: number): void {
+        this.values.push(value);
+    }
+
+    /** Removes and returns all values that haven't been read yet */
+    public drain(): number[] {
+        const values = this.values.slice(this.head);
+        this.values = [];
+        this.head = 0;
+        return values;
+    }
+}
+
+/** A classic SIC-1 machine whose @IN and @OUT are connected to channels (see Network). The semantics match Emulator,
+ * except that reading from an empty channel or writing to a full one waits until the channel is ready. Without a
+ * channel, input reads as zero and output is discarded. */
+export class NetworkCore {
+    private readonly memory = new Uint8Array(addressMax + 1);
+    private readonly memoryAccessed = new Uint8Array(addressMax + 1);
+    private ip = 0;
+
+    public input?: NetworkChannel;
+    public output?: NetworkChannel;
+
+    public cyclesExecuted = 0;
+    public memoryBytesAccessed = 0;
+
+    /** Number of times the core was scheduled, but couldn't execute anything due to a channel not being ready */
+    public stalls = 0;
+
+    constructor(bytes: ArrayLike<number>) {
+        const length = Math.min(bytes.length, addressMax + 1);
+        for (let i = 0; i < length; i++) {
+            this.memory[i] = bytes[i];
+        }
+    }
+
+    /** Returns a copy of this core (without its channels) */
+    public clone(): NetworkCore {
+        const core = new NetworkCore(this.memory);
+        core.memoryAccessed.set(this.memoryAccessed);
+        core.ip = this.ip;
+        core.cyclesExecuted = this.cyclesExecuted;
+        core.memoryBytesAccessed = this.memoryBytesAccessed;
+        core.stalls = this.stalls;
+        return core;
+    }
+
+    /** Returns a string that identifies the core's instruction pointer and memory (i.e. everything that affects its
+     * future behavior) */
+    public getStateKey(): string {
+        // Note: apply accepts typed arrays, and is much faster than spreading them
+        return String.fromCharCode(this.ip) + String.fromCharCode.apply(null, this.memory as unknown as number[]);
+    }
+
+    public isHalted(): boolean {
+        return this.ip > Constants.addressInstructionMax;
+    }
+
+    /** Returns true if the next instruction is waiting on a channel */
+    public isBlocked(): boolean {
+        if (this.isHalted()) {
+            return false;
+        }
+
+        const a = this.memory[this.ip];
+        const b = this.memory[this.ip + 1];
+        const { addressInput, addressOutput } = Constants;
+        return ((a === addressInput || b === addressInput) && !!this.input && !this.input.canRead())
+            || (a === addressOutput && !!this.output && !this.output.canWrite());
+    }
+
+    /** Executes up to maxCycles instructions, stopping early if the core halts or blocks on a channel, and returns the
+     * number of instructions executed. */
+    public run(maxCycles: number): number {
+        const { memory, memoryAccessed, input, output } = this;
+        const { addressInstructionMax, addressInput, addressOutput, addressHalt } = Constants;
+        let ip = this.ip;
+        let memoryBytesAccessed = this.memoryBytesAccessed;
+        let cycles = 0;
+
+        while (cycles < maxCycles && ip <= addressInstructionMax) {
+            const a = memory[ip];
+            const b = memory[ip + 1];
+            const c = memory[ip + 2];
+            const readsInput = (a === addressInput || b === addressInput);
+            if ((readsInput && input && !input.canRead()) || (a === addressOutput && output && !output.canWrite())) {
+                break;
+            }
+
+            for (let address = ip; address < ip + 3; address++) {
+                if (!memoryAccessed[address]) {
+                    memoryAccessed[address] = 1;
+                    memoryBytesAccessed++;
+                }
+            }
+
+            let inputValue = 0;
+            if (readsInput && input) {
+                inputValue = input.read();
+            }
+
+            const av = (a === addressInput) ? inputValue : memory[a];
+            const bv = (b === addressInput) ? inputValue : memory[b];
+            if (!memoryAccessed[a]) {
+                memoryAccessed[a] = 1;
+                memoryBytesAccessed++;
+            }
+
+            if (!memoryAccessed[b]) {
+                memoryAccessed[b] = 1;
+                memoryBytesAccessed++;
+            }
+
+            const result = (av - bv) & 0xff;
+            const resultSigned = (result & 0x80) ? result - 256 : result;
+            if (a === addressOutput) {
+                if (output) {
+                    output.write(resultSigned);
+                }
+            } else if (a !== addressInput && a !== addressHalt) {
+                memory[a] = result;
+            }
+
+            ip = (resultSigned <= 0) ? c : ip + 3;
+            cycles++;
+        }
+
+        this.ip = ip;
+        this.memoryBytesAccessed = memoryBytesAccessed;
+        this.cyclesExecuted += cycles;
+        if (cycles === 0 && ip <= addressInstructionMax && maxCycles > 0) {
+            this.stalls++;
+        }
+
+        return cycles;
+    }
+}
+
+export enum NetworkStatus {
+    /** Every core halted */
+    halted,
+
+    /** No core could make progress: every core that hasn't halted is waiting on a channel (either for more input, or
+     * due to a deadlock) */
+    blocked,
+
+    /** The network's cycle limit was reached first */
+    limitExceeded,
+}
+
+/** Runs a set of cores connected by channels (e.g. a pipeline of programs, where each stage's output feeds the next
+ * stage's input) on the current thread. Cores are scheduled round-robin, for up to cyclesPerSlice cycles at a time,
+ * skipping any that are waiting on a channel. */
+export class Network {
+    public readonly cores: NetworkCore[] = [];
+    public cyclesExecuted = 0;
+
+    constructor(private readonly cyclesPerSlice = 100) {
+    }
+
+    public addCore(bytes: ArrayLike<number>): NetworkCore {
+        const core = new NetworkCore(bytes);
+        this.cores.push(core);
+        return core;
+    }
+
+    /** Connects the first core's output to the second core's input */
+    public connect(from: NetworkCore, to: NetworkCore, capacity = 1): Channel {
+        const channel = new Channel(capacity);
+        from.output = channel;
+        to.input = channel;
+        return channel;
+    }
+
+    /** Runs until every core halts, every remaining core is blocked, or a total of maxCyclesExecuted have been executed (across
+     * all cores) */
+    public run(maxCyclesExecuted: number): NetworkStatus {
+        while (true) {
+            let running = false;
+            let progressed = false;
+            for (const core of this.cores) {
+                if (!core.isHalted()) {
+                    const remaining = maxCyclesExecuted - this.cyclesExecuted;
+                    if (remaining <= 0) {
+                        return NetworkStatus.limitExceeded;
+                    }
+
+                    const cycles = core.run(Math.min(this.cyclesPerSlice, remaining));
+                    this.cyclesExecuted += cycles;
+                    running = true;
+                    progressed = progressed || (cycles > 0);
+                }
+            }
+
+            if (!running) {
+                return NetworkStatus.halted;
+            }
+
+            if (!progressed) {
+                return NetworkStatus.blocked;
+            }
+        }
+    }
+}
+
+export enum EquivalenceStatus {
+    /** Every explored input sequence produced the same output (i.e. the programs are equivalent within the bound) */
+    equivalent,
+
+    /** A concrete input sequence produced incorrect output (see EquivalenceResult.counterexample) */
+    counterexample,
+
+    /** The search was stopped after exploring maxStates states */
+    limitExceeded,
+}
+
+export interface EquivalenceOptions {
+    /** Values to try for each input (default: every 8-bit value) */
+    inputValues?: ArrayLike<number>;
+
+    /** Maximum number of inputs in a sequence */
+    maxInputs: number;
+
+    /** Cycle limit for each program between consecutive inputs (and after the last one) */
+    maxCyclesPerInput: number;
+
+    maxStates?: number;
+}
+
+export interface Counterexample {
+    inputs: number[];
+    expectedOutputs: number[];
+    actualOutputs: number[];
+    errorContext: string;
+}
+
+export interface EquivalenceResult {
+    status: EquivalenceStatus;
+    counterexample?: Counterexample;
+
+    /** Number of distinct (candidate, reference) state pairs whose successors were explored */
+    statesExplored: number;
+
+    /** Number of input sequences skipped because the same state pair had already been explored (at least as deeply) */
+    cacheHits: number;
+
+    /** Number of input sequences abandoned because a program didn't read input or halt within the cycle limit. Note that
+     * the reference is assumed to define which inputs are valid, and a slow candidate isn't necessarily incorrect, so
+     * neither case is reported as a counterexample. */
+    pathsPruned: number;
+}
+
+enum SegmentStatus {
+    halted,
+    waitingForInput,
+    limitExceeded,
+}
+
+/** Runs a core until it needs input beyond the (optional) given value, halts, or reaches the cycle limit */
+function runSegment(core: NetworkCore, input: number | undefined, outputs: number[], maxCycles: number): SegmentStatus {
+    const output = new Channel(Infinity);
+    core.input = new Channel(1, (input === undefined) ? [] : [input]);
+    core.output = output;
+    core.run(maxCycles);
+    outputs.push(...output.drain());
+
+    if (core.isHalted()) {
+        return SegmentStatus.halted;
+    }
+
+    return core.isBlocked() ? SegmentStatus.waitingForInput : SegmentStatus.limitExceeded;
+}
+
+/** Searches for an input sequence (of up to maxInputs values, each one taken from inputValues) on which a candidate
+ * program's output differs from a reference program's output, or the candidate halts before producing all of the
+ * reference's output. Every input sequence is explored, except that both programs are run in lockstep, one input at a
+ * time, and any (candidate, reference) state pair that has already been explored is skipped. Only definite failures
+ * are reported (e.g. reading more input than the reference before producing the same output isn't an error). */
+export function checkEquivalence(candidate: ArrayLike<number>, reference: ArrayLike<number>, options: EquivalenceOptions): EquivalenceResult {
+    const { maxInputs, maxCyclesPerInput } = options;
+    const maxStates = (options.maxStates === undefined) ? Infinity : options.maxStates;
+    let inputValues = options.inputValues;
+    if (!inputValues) {
+        const values: number[] = [];
+        for (let value = Constants.valueMin; value <= Constants.valueMax; value++) {
+            values.push(value);
+        }
+
+        inputValues = values;
+    }
+
+    const result: EquivalenceResult = {
+        status: EquivalenceStatus.equivalent,
+        statesExplored: 0,
+        cacheHits: 0,
+        pathsPruned: 0,
+    };
+
+    // State key to the number of inputs that remained when it was explored
+    const explored = new Map<string, number>();
+
+    const fail = (inputs: number[], expectedOutputs: number[], actualOutputs: number[], errorContext: string): false => {
+        result.status = EquivalenceStatus.counterexample;
+        result.counterexample = { inputs, expectedOutputs, actualOutputs, errorContext };
+        return false;
+    };
+
+    // Returns false once the search should stop
+    const visit = (candidateCore: NetworkCore, referenceCore: NetworkCore, candidateOutputs: number[], referenceOutputs: number[], inputs: number[], input?: number): boolean => {
+        const previousOutputCount = Math.min(candidateOutputs.length, referenceOutputs.length);
+        const candidateStatus = runSegment(candidateCore, input, candidateOutputs, maxCyclesPerInput);
+        const referenceStatus = runSegment(referenceCore, input, referenceOutputs, maxCyclesPerInput);
+        const outputCount = Math.min(candidateOutputs.length, referenceOutputs.length);
+        for (let i = previousOutputCount; i < outputCount; i++) {
+            if (candidateOutputs[i] !== referenceOutputs[i]) {
+                return fail(inputs, referenceOutputs, candidateOutputs, `${describeIncorrectOutput(referenceOutputs[i], candidateOutputs[i])} at index ${i}`);
+            }
+        }
+
+        if (candidateStatus === SegmentStatus.halted && candidateOutputs.length < referenceOutputs.length) {
+            return fail(inputs, referenceOutputs, candidateOutputs, "halted before producing all output");
+        }
+
+        if (candidateStatus === SegmentStatus.limitExceeded || referenceStatus === SegmentStatus.limitExceeded) {
+            result.pathsPruned++;
+            return true;
+        }
+
+        if ((candidateStatus === SegmentStatus.halted && referenceStatus === SegmentStatus.halted) || inputs.length >= maxInputs) {
+            return true;
+        }
+
+        // Outputs that one program has produced, but the other hasn't yet, affect what happens next
+        const pending = (candidateOutputs.length > referenceOutputs.length)
+            ? `c${candidateOutputs.slice(outputCount).join(",")}`
+            : `r${referenceOutputs.slice(outputCount).join(",")}`;
+
+        const key = `${candidateCore.getStateKey()}|${referenceCore.getStateKey()}|${pending}`;
+        const inputsRemaining = maxInputs - inputs.length;
+        const previousInputsRemaining = explored.get(key);
+        if (previousInputsRemaining !== undefined && previousInputsRemaining >= inputsRemaining) {
+            result.cacheHits++;
+            return true;
+        }
+
+        if (result.statesExplored >= maxStates) {
+            result.status = EquivalenceStatus.limitExceeded;
+            return false;
+        }
+
+        explored.set(key, inputsRemaining);
+        result.statesExplored++;
+
+        for (let i = 0; i < inputValues!.length; i++) {
+            const value = inputValues![i];
+            if (!visit(candidateCore.clone(), referenceCore.clone(), candidateOutputs.slice(), referenceOutputs.slice(), inputs.concat([value]), value)) {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    visit(new NetworkCore(candidate), new NetworkCore(reference), [], [], []);
+    return result;
+}
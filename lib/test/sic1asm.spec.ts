@@ -1,7 +1,25 @@
 import "mocha";
 import * as assert from "assert";
 import * as sic1 from "../src/sic1asm";
-const { Tokenizer, TokenType, Assembler, Emulator, CompilationError, Constants } = sic1;
+const { Tokenizer, TokenType, Assembler, Emulator, Verifier, VerificationStatus, CompilationError, Constants } = sic1;
+
+// Simple deterministic pseudo-random number generator, so failures are reproducible
+function createRandom(seed: number): (max: number) => number {
+    return (max: number) => {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed % max;
+    };
+}
+
+// Random programs, biased toward the I/O addresses and toward branching to the start
+function createRandomProgram(random: (max: number) => number, configuration: sic1.MachineConfiguration = Constants): number[] {
+    const bytes: number[] = [];
+    const length = 3 + random(30);
+    for (let i = 0; i < length; i++) {
+        bytes.push(random(4) === 0 ? configuration.addressInput + random(3) : random(length + 3));
+    }
+    return bytes;
+}
 
 describe("SIC-1 Assembler", () => {
     describe("Tokenizer", () => {
@@ -705,6 +723,259 @@ describe("SIC-1 Emulator", () => {
         }
     });
 
+    it("Dirty addresses", () => {
+        const emulator = new Emulator(Assembler.assemble(`
+            subleq @tmp, @five
+            subleq @tmp, @zero
+            subleq @OUT, @five, @HALT
+
+            @five: .data 5
+            @zero: .data 0
+            @tmp: .data 0
+        `.split("\n")), {});
+
+        // Initially, everything is considered changed
+        const all = emulator.takeDirtyAddresses();
+        assert.strictEqual(all.length, Constants.addressMax + 1);
+        assert.strictEqual(all[0], 0);
+        assert.strictEqual(all[Constants.addressMax], Constants.addressMax);
+        assert.deepStrictEqual(emulator.takeDirtyAddresses(), []);
+
+        // Only writes that change the value are tracked, and writes to @OUT aren't memory writes
+        emulator.step();
+        assert.deepStrictEqual(emulator.takeDirtyAddresses(), [11]);
+        assert.strictEqual(emulator.getMemory(11), 0xfb);
+        emulator.step();
+        emulator.step();
+        assert.deepStrictEqual(emulator.takeDirtyAddresses(), []);
+
+        emulator.reset();
+        assert.deepStrictEqual(emulator.takeDirtyAddresses(), [11]);
+    });
+
+    it("Profiling", () => {
+        const program = Assembler.assemble(`
+            @loop:
+            subleq @n, @one, @done
+            subleq @zero, @zero, @loop
+            @done:
+            subleq @OUT, @n, @HALT
+
+            @n: .data 3
+            @one: .data 1
+            @zero: .data 0
+        `.split("\n"));
+
+        // Nothing is collected until profiling is enabled
+        const emulator = new Emulator(program);
+        assert.strictEqual(emulator.getProfile(), undefined);
+        const profile = emulator.enableProfiling();
+        assert.strictEqual(emulator.enableProfiling(), profile);
+        emulator.run();
+
+        assert.deepStrictEqual(Array.from(profile.executionCounts.slice(0, 9)), [3, 0, 0, 2, 0, 0, 1, 0, 0]);
+        assert.deepStrictEqual(Array.from(profile.branchTakenCounts.slice(0, 9)), [1, 0, 0, 2, 0, 0, 1, 0, 0]);
+        assert.deepStrictEqual(Array.from(profile.branchNotTakenCounts.slice(0, 9)), [2, 0, 0, 0, 0, 0, 0, 0, 0]);
+
+        assert.deepStrictEqual(sic1.summarizeProfile(program, profile), {
+            cyclesExecuted: 6,
+            lines: [
+                { lineNumber: 2, executions: 3, branchesTaken: 1, branchesNotTaken: 2 },
+                { lineNumber: 3, executions: 2, branchesTaken: 2, branchesNotTaken: 0 },
+                { lineNumber: 5, executions: 1, branchesTaken: 1, branchesNotTaken: 0 },
+            ],
+            addresses: [
+                { address: 9, label: "@n", reads: 4, writes: 3 },
+                { address: 10, label: "@one", reads: 3, writes: 0 },
+                { address: 11, label: "@zero", reads: 4, writes: 2 },
+                { address: Constants.addressOutput, reads: 1, writes: 1 },
+            ],
+        });
+
+        // Counters accumulate across resets
+        emulator.reset();
+        emulator.run();
+        assert.strictEqual(sic1.summarizeProfile(program, profile).cyclesExecuted, 12);
+
+        // Disabling discards the counters
+        emulator.disableProfiling();
+        assert.strictEqual(emulator.getProfile(), undefined);
+        emulator.reset();
+        emulator.run();
+        assert.strictEqual(profile.executionCounts[0], 6);
+    });
+
+    it("Fork", () => {
+        const program = Assembler.assemble(`
+            @loop:
+            subleq @sum, @IN
+            subleq @OUT, @sum
+            subleq @zero, @zero, @loop
+
+            @sum: .data 0
+            @zero: .data 0
+        `.split("\n"));
+
+        // Run a shared prefix, and then continue it with different input
+        const parentOutputs: number[] = [];
+        const parent = new Emulator(program, { readInput: () => 1, writeOutput: value => parentOutputs.push(value) });
+        parent.step();
+        parent.step();
+        assert.deepStrictEqual(parentOutputs, [1]);
+
+        const forkOutputs: number[] = [];
+        const fork = parent.fork({ readInput: () => 5, writeOutput: value => forkOutputs.push(value) });
+        assert.strictEqual(fork.getCyclesExecuted(), 2);
+        assert.strictEqual(fork.getMemoryBytesAccessed(), parent.getMemoryBytesAccessed());
+
+        for (let i = 0; i < 3; i++) {
+            fork.step();
+            parent.step();
+        }
+
+        assert.deepStrictEqual(forkOutputs, [6]);
+        assert.deepStrictEqual(parentOutputs, [1, 2]);
+        assert.strictEqual(fork.getMemory(9), 0x100 - 6);
+        assert.strictEqual(parent.getMemory(9), 0x100 - 2);
+
+        // Resetting either one doesn't affect the other
+        fork.reset();
+        assert.strictEqual(fork.getMemory(9), 0);
+        assert.strictEqual(fork.getMemoryBytesAccessed(), 0);
+        assert.strictEqual(parent.getMemory(9), 0x100 - 2);
+        assert.strictEqual(parent.getCyclesExecuted(), 5);
+    });
+
+    describe("I/O devices", () => {
+        // Negates each input
+        const program = Assembler.assemble(`
+            @loop:
+            subleq @OUT, @IN
+            subleq @zero, @zero, @loop
+
+            @zero: .data 0
+        `.split("\n"));
+
+        function run(input: sic1.InputDevice, output: sic1.OutputDevice): Emulator {
+            const emulator = new Emulator(program, { input, output });
+            while (emulator.isRunning() && !output.isDone() && emulator.getCyclesExecuted() < 100) {
+                emulator.step();
+            }
+
+            return emulator;
+        }
+
+        it("Span input and buffer output", () => {
+            const input = new sic1.SpanInputDevice([1, -2, 3, -128]);
+            const output = new sic1.BufferOutputDevice(4);
+            const emulator = run(input, output);
+            assert.deepStrictEqual(output.getValues(), [-1, 2, -3, -128]);
+            assert.strictEqual(input.index, 4);
+            assert.strictEqual(emulator.getCyclesExecuted(), 7);
+
+            // Extra output is discarded once the buffer is full
+            output.write(5);
+            assert.strictEqual(output.length, 4);
+        });
+
+        it("Comparator output", () => {
+            const correct = new sic1.ComparatorOutputDevice([-1, 2, -3]);
+            run(new sic1.SpanInputDevice([1, -2, 3]), correct);
+            assert.strictEqual(correct.isCorrect(), true);
+            assert.strictEqual(correct.mismatchIndex, undefined);
+
+            // Stops at the first mismatch, with the same error as Verifier
+            const incorrect = new sic1.ComparatorOutputDevice([-1, 5, -3]);
+            const emulator = run(new sic1.SpanInputDevice([1, -2, 3]), incorrect);
+            assert.strictEqual(incorrect.isCorrect(), false);
+            assert.strictEqual(incorrect.mismatchIndex, 1);
+            assert.strictEqual(incorrect.length, 2);
+            assert.strictEqual(emulator.getCyclesExecuted(), 3);
+
+            const result = new Verifier(program.bytes).verify([1, -2, 3], [-1, 5, -3], 100, 256);
+            assert.strictEqual(incorrect.errorContext, result.errorContext);
+        });
+
+        it("Custom devices", () => {
+            let next = 10;
+            const values: number[] = [];
+            run({ read: () => next++ }, { write: value => values.push(value), isDone: () => values.length >= 3 });
+            assert.deepStrictEqual(values, [-10, -11, -12]);
+        });
+    });
+
+    describe("Tracing", () => {
+        const program = Assembler.assemble(`
+            @loop:
+            subleq @tmp, @IN
+            subleq @OUT, @tmp
+            subleq @tmp, @tmp, @loop
+
+            @tmp: .data 0
+        `.split("\n"));
+
+        // Runs the program (resetting part way through), returning the trace and the snapshot after every step
+        function record(options: sic1.TraceWriterOptions) {
+            const inputs = [4, -5, 100, -128, 7];
+            let inputIndex = 0;
+            const outputs: number[] = [];
+            const emulator = new Emulator(program, {
+                readInput: () => inputs[inputIndex++ % inputs.length],
+                writeOutput: value => outputs.push(value),
+            });
+
+            const writer = new sic1.TraceWriter(options);
+            emulator.startTracing(writer);
+            const snapshots = [emulator.getSnapshot()];
+            for (let i = 0; i < 40; i++) {
+                if (i === 25) {
+                    emulator.reset();
+                    snapshots[snapshots.length - 1] = emulator.getSnapshot();
+                }
+
+                emulator.step();
+                snapshots.push(emulator.getSnapshot());
+            }
+
+            return { trace: writer.finish(), snapshots, inputs, outputs };
+        }
+
+        it("Reconstructs every step", () => {
+            const { trace, snapshots } = record({ stepsPerBlock: 7 });
+            const reader = new sic1.TraceReader(trace!);
+            assert.strictEqual(reader.getStepCount(), 40);
+            for (let step = 0; step <= 40; step++) {
+                assert.deepStrictEqual(reader.getState(step), snapshots[step], `Step ${step}`);
+            }
+            assert.throws(() => reader.getState(41));
+        });
+
+        it("Records input and output", () => {
+            const { trace, outputs } = record({});
+            const events = new sic1.TraceReader(trace!).getEvents();
+            assert.deepStrictEqual(events.filter(e => e.output !== undefined).map(e => e.output), outputs);
+            assert.deepStrictEqual(events.filter(e => e.input !== undefined).slice(0, 5).map(e => e.input), [4, -5, 100, -128, 7]);
+            assert.deepStrictEqual(events.slice(0, 2), [{ step: 0, input: 4 }, { step: 1, output: 4 }]);
+        });
+
+        it("Streams and compresses blocks", () => {
+            const chunks: number[] = [];
+            const reverse = (block: Uint8Array) => block.slice().reverse();
+            assert.strictEqual(record({ stepsPerBlock: 5, compressBlock: reverse, write: chunk => chunks.push(...chunk) }).trace, undefined);
+
+            const trace = Uint8Array.from(chunks);
+            assert.throws(() => new sic1.TraceReader(trace));
+            const reader = new sic1.TraceReader(trace, reverse);
+            assert.deepStrictEqual(reader.getState(40), record({}).snapshots[40]);
+        });
+
+        it("Rejects invalid traces", () => {
+            const { trace } = record({});
+            assert.throws(() => new sic1.TraceReader(trace!.subarray(1)));
+            assert.throws(() => new sic1.TraceReader(trace!.subarray(0, trace!.length - 1)));
+        });
+    });
+
     it("Halt", () => {
         for (const [program, shouldHalt] of [
             ["subleq 0, 0, @MAX", false],
@@ -721,3 +992,641 @@ describe("SIC-1 Emulator", () => {
         }
     });
 });
+
+describe("SIC-1 Verifier", () => {
+    const negationProgram = Assembler.assemble(`
+        @loop:
+        subleq @OUT, @IN
+        subleq @zero, @zero, @loop
+
+        @zero: .data 0
+    `.split("\n"));
+
+    it("Correct output", () => {
+        const result = new Verifier(negationProgram.bytes).verify([4, 5, -100], [-4, -5, 100], 1000, 256);
+        assert.deepStrictEqual(result, { status: VerificationStatus.correct, cyclesExecuted: 5, memoryBytesAccessed: 9 });
+    });
+
+    it("Incorrect output", () => {
+        const result = new Verifier(negationProgram.bytes).verify([4, 5, 6], [-4, 5, -6], 1000, 256);
+        assert.strictEqual(result.status, VerificationStatus.incorrectOutput);
+        assert.strictEqual(result.errorContext, "expected 5 but got -5 instead");
+        assert.strictEqual(result.cyclesExecuted, 3);
+    });
+
+    it("Limits", () => {
+        const verifier = new Verifier(negationProgram.bytes);
+        assert.strictEqual(verifier.verify([1, 2, 3], [-1, -2, -3], 4, 256).status, VerificationStatus.limitExceeded);
+        assert.strictEqual(verifier.verify([1, 2, 3], [-1, -2, -3], 5, 256).status, VerificationStatus.correct);
+        assert.strictEqual(verifier.verify([1, 2, 3], [-1, -2, -3], 1000, 8).status, VerificationStatus.limitExceeded);
+    });
+
+    it("Halt before producing all output", () => {
+        const program = Assembler.assemble(["subleq @OUT, @IN, @HALT"]);
+        const result = new Verifier(program.bytes).verify([1, 2], [-1, -2], 1000, 256);
+        assert.strictEqual(result.status, VerificationStatus.halted);
+        assert.strictEqual(result.cyclesExecuted, 1);
+    });
+
+    it("Shared test set prefixes", () => {
+        const verifier = new Verifier(negationProgram.bytes);
+        const testSets = [
+            { input: [1, 2, 3], output: [-1, -2, -3] },
+            { input: [1, 2, 4, 5], output: [-1, -2, -4, -5] },
+            { input: [1, 2], output: [-1, -2] },
+            { input: [1, 7], output: [-1, 7] },
+            { input: [1, 5, 3], output: [-1, -2, -3] },
+        ];
+
+        const expected = testSets.map(({ input, output }) => verifier.verify(input, output, 1000, 256));
+        assert.strictEqual(expected[3].status, VerificationStatus.incorrectOutput);
+        assert.strictEqual(expected[4].errorContext, "expected -2 but got -5 instead");
+        assert.deepStrictEqual(verifier.verifyTestSets(testSets, 1000, 256), expected);
+
+        // Expected output is shared for longer than input here, so the prefix must stop at the first unshared input
+        assert.deepStrictEqual(verifier.verifyTestSets([testSets[0], testSets[4]], 1000, 256), [expected[0], expected[4]]);
+
+        // Failures in the shared prefix apply to every test set
+        assert.deepStrictEqual(verifier.verifyTestSets(testSets.slice(0, 3), 2, 256).map(r => r.status), new Array(3).fill(VerificationStatus.limitExceeded));
+        assert.deepStrictEqual(verifier.verifyTestSets([], 1000, 256), []);
+    });
+
+    it("Verify until failure", () => {
+        const verifier = new Verifier(negationProgram.bytes);
+        const long = new Array(1000).fill(1);
+        const tasks = [
+            { input: long, output: long.map(n => -n), maxCyclesExecuted: 10000, maxMemoryBytesAccessed: 256 },
+            { input: [1, 2], output: [-1, -2], maxCyclesExecuted: 10000, maxMemoryBytesAccessed: 256 },
+        ];
+
+        // When everything passes, results match verify
+        const expected = tasks.map(({ input, output, maxCyclesExecuted, maxMemoryBytesAccessed }) => verifier.verify(input, output, maxCyclesExecuted, maxMemoryBytesAccessed));
+        assert.deepStrictEqual(verifier.verifyUntilFailure(tasks, 10), expected);
+
+        // A failure cancels the (long-running) first test set
+        const failing = { input: [1, 2, 3], output: [-1, 5, -3], maxCyclesExecuted: 10000, maxMemoryBytesAccessed: 256 };
+        const results = verifier.verifyUntilFailure([tasks[0], failing], 10);
+        assert.strictEqual(results[0], undefined);
+        assert.deepStrictEqual(results[1], verifier.verify(failing.input, failing.output, 10000, 256));
+
+        // Limits are per test set
+        const limited = { ...tasks[1], maxCyclesExecuted: 2 };
+        assert.deepStrictEqual(verifier.verifyUntilFailure([tasks[0], limited], 10)[1], verifier.verify(limited.input, limited.output, 2, 256));
+    });
+
+    it("Matches Emulator", () => {
+        const random = createRandom(1);
+        for (let i = 0; i < 200; i++) {
+            const bytes = createRandomProgram(random);
+
+            const inputs: number[] = [];
+            for (let j = 0; j < 20; j++) {
+                inputs.push(random(256) - 128);
+            }
+
+            // Record the Emulator's output (and stats as of the last output), and then require the Verifier to reproduce it
+            let inputIndex = 0;
+            let cyclesExecuted = 0;
+            let memoryBytesAccessed = 0;
+            const outputs: number[] = [];
+            const emulator = new Emulator({ bytes, sourceMap: [], variables: [] }, {
+                readInput: () => inputs[inputIndex++],
+                writeOutput: n => outputs.push(n),
+            });
+
+            const maxCycles = 500;
+            while (emulator.isRunning() && emulator.getCyclesExecuted() < maxCycles && outputs.length < 10) {
+                const outputCount = outputs.length;
+                emulator.step();
+                if (outputs.length > outputCount) {
+                    cyclesExecuted = emulator.getCyclesExecuted();
+                    memoryBytesAccessed = emulator.getMemoryBytesAccessed();
+                }
+            }
+
+            if (outputs.length > 0) {
+                const result = new Verifier(bytes).verify(inputs, outputs, maxCycles, 256);
+                assert.deepStrictEqual(result, {
+                    status: VerificationStatus.correct,
+                    cyclesExecuted,
+                    memoryBytesAccessed,
+                }, `Mismatch for program: ${bytes.join(", ")}`);
+            }
+
+            // Test sets that share a prefix must produce the same results as verifying them individually
+            const verifier = new Verifier(bytes);
+            const testSets = [0, 1, 2].map(() => {
+                const input = inputs.slice(0, random(15));
+                for (let j = random(5); j > 0; j--) {
+                    input.push(random(256) - 128);
+                }
+                return { input, output: outputs.slice(0, random(outputs.length + 1)).concat(random(2) ? [random(256) - 128] : []) };
+            });
+
+            assert.deepStrictEqual(
+                verifier.verifyTestSets(testSets, maxCycles, 100),
+                testSets.map(({ input, output }) => verifier.verify(input, output, maxCycles, 100)),
+                `Mismatch for program: ${bytes.join(", ")}`);
+
+            // Interleaved test sets must also match, at least until the first failure
+            const tasks = testSets.map(testSet => ({ ...testSet, maxCyclesExecuted: random(maxCycles), maxMemoryBytesAccessed: 100 }));
+            const expected = tasks.map(({ input, output, maxCyclesExecuted }) => verifier.verify(input, output, maxCyclesExecuted, 100));
+            const results = verifier.verifyUntilFailure(tasks, 1 + random(20));
+            results.forEach((result, index) => {
+                if (result !== undefined) {
+                    assert.deepStrictEqual(result, expected[index], `Mismatch for program: ${bytes.join(", ")}`);
+                }
+            });
+
+            if (results.some(r => r === undefined)) {
+                assert.ok(results.some(r => r !== undefined && r.status !== VerificationStatus.correct));
+            }
+        }
+    });
+});
+
+describe("SIC-1 Static analysis", () => {
+    it("Reachability and constants", () => {
+        const program = Assembler.assemble(`
+            @loop:
+            subleq @OUT, @IN
+            subleq @zero, @zero, @loop
+            subleq @HALT, @HALT
+
+            @zero: .data 0
+            @one: .data 1
+        `.split("\n"));
+
+        const analysis = sic1.analyzeProgram(program.bytes);
+        assert.strictEqual(analysis.selfModifying, false);
+
+        // The third instruction is dead code, since the second always branches
+        assert.deepStrictEqual(Array.from(analysis.reachable.slice(0, 9)), [1, 0, 0, 1, 0, 0, 0, 0, 0]);
+
+        // Only @zero is written (output isn't a memory write), so everything else (but @IN) is constant
+        assert.deepStrictEqual(Array.from(analysis.writable).map((w, address) => w ? address : -1).filter(a => a >= 0), [9]);
+        assert.strictEqual(analysis.constant[9], 0);
+        assert.strictEqual(analysis.constant[10], 1);
+        assert.strictEqual(analysis.constant[Constants.addressInput], 0);
+        assert.strictEqual(analysis.constant[Constants.addressOutput], 1);
+
+        // The first instruction produces output, so it's all that every run is guaranteed to access
+        assert.deepStrictEqual(Array.from(analysis.accessed).map((a, address) => a ? address : -1).filter(a => a >= 0), [0, 1, 2, Constants.addressInput, Constants.addressOutput]);
+        assert.strictEqual(analysis.minimumMemoryBytesAccessed, 5);
+    });
+
+    it("Constant branches", () => {
+        // @OUT and @HALT are never written, so branches that only depend on them and constants can be resolved
+        const program = Assembler.assemble(`
+            subleq @OUT, @minusOne, @dead
+            subleq @HALT, @one, @HALT
+            @dead:
+            subleq @OUT, @one
+
+            @minusOne: .data -1
+            @one: .data 1
+        `.split("\n"));
+
+        const analysis = sic1.analyzeProgram(program.bytes);
+        assert.deepStrictEqual(Array.from(analysis.reachable.slice(0, 9)), [1, 0, 0, 1, 0, 0, 0, 0, 0]);
+        assert.ok(analysis.writable.every(w => !w));
+        assert.strictEqual(analysis.minimumMemoryBytesAccessed, 5);
+    });
+
+    it("Self-modifying code", () => {
+        // The first instruction overwrites the jump target of the second one
+        const program = Assembler.assemble(`
+            subleq @target, @IN
+            subleq @OUT, @IN
+            @target: .data 0
+        `.split("\n"));
+
+        const analysis = sic1.analyzeProgram(program.bytes);
+        assert.strictEqual(analysis.selfModifying, true);
+        assert.strictEqual(analysis.reachable[Constants.addressInstructionMax], 1);
+        assert.strictEqual(analysis.writable[0], 1);
+        assert.strictEqual(analysis.writable[Constants.addressInput], 0);
+        assert.strictEqual(analysis.constant[0], 0);
+    });
+
+    it("Matches Emulator", () => {
+        const random = createRandom(1);
+        for (let i = 0; i < 500; i++) {
+            const bytes = createRandomProgram(random);
+
+            // Everything the Emulator actually does must be allowed by the analysis
+            const analysis = sic1.analyzeProgram(bytes);
+            let memoryBytesAccessed: number | undefined;
+            const emulator = new Emulator({ bytes, sourceMap: [], variables: [] }, {
+                readInput: () => random(256) - 128,
+                writeOutput: () => { memoryBytesAccessed = memoryBytesAccessed ?? emulator.getMemoryBytesAccessed(); },
+            });
+
+            const profile = emulator.enableProfiling();
+            for (let step = 0; step < 200 && emulator.isRunning(); step++) {
+                emulator.step();
+            }
+
+            for (let address = 0; address <= Constants.addressMax; address++) {
+                const message = `Address ${address} for program: ${bytes.join(", ")}`;
+                assert.ok(analysis.reachable[address] || !profile.executionCounts[address], message);
+                assert.ok(analysis.writable[address] || !profile.writeCounts[address] || address === Constants.addressOutput, message);
+                if (!analysis.constant[address] && !analysis.selfModifying) {
+                    assert.ok(analysis.writable[address] || address === Constants.addressInput, message);
+                }
+            }
+
+            if (memoryBytesAccessed !== undefined) {
+                assert.ok(analysis.minimumMemoryBytesAccessed <= memoryBytesAccessed, `Program: ${bytes.join(", ")}`);
+            }
+        }
+    });
+});
+
+describe("SIC-1 Extended configurations", () => {
+    const configuration = sic1.createMachineConfiguration(16);
+    const additionSource = `
+        @loop:
+        subleq @sum, @IN
+        subleq @sum, @IN
+        subleq @OUT, @sum
+        subleq @sum, @sum, @loop
+
+        @sum: .data 0
+        @big: .data -32768, 32767, 'a', "hi"
+    `.split("\n");
+
+    it("Configurations", () => {
+        assert.deepStrictEqual(sic1.createMachineConfiguration(8), { ...Constants });
+        assert.strictEqual(configuration.valueMin, -32768);
+        assert.strictEqual(configuration.valueMax, 32767);
+        assert.strictEqual(configuration.addressMax, 65535);
+        assert.strictEqual(configuration.addressInput, 65533);
+        assert.strictEqual(configuration.addressInstructionMax, 65532);
+        assert.throws(() => sic1.createMachineConfiguration(7));
+        assert.throws(() => sic1.createMachineConfiguration(17));
+    });
+
+    it("Assembler", () => {
+        // Values and addresses use the whole word
+        const program = Assembler.assemble(additionSource, configuration);
+        assert.deepStrictEqual(program.bytes.slice(0, 3), [12, 65533, 3]);
+        assert.deepStrictEqual(program.bytes.slice(12), [0, 32768, 32767, 97, 104, 105, 0]);
+        assert.deepStrictEqual(Assembler.assemble(["subleq 1000, @HALT"], configuration).bytes, [1000, 65535, 3]);
+        assert.deepStrictEqual(Assembler.assemble(["@x: .data -@x"], configuration).bytes, [0]);
+
+        // But not in the classic configuration
+        assert.throws(() => Assembler.assemble(additionSource), CompilationError);
+        assert.throws(() => Assembler.assemble(["subleq 1000, @HALT"]), CompilationError);
+        assert.throws(() => Assembler.assemble(["subleq 65536, @HALT"], configuration), CompilationError);
+    });
+
+    it("Emulator and Verifier", () => {
+        const program = Assembler.assemble(additionSource, configuration);
+        const inputs = [1000, 2000, -32768, -1, 30000, 30000];
+        const expectedOutputs = [3000, 32767, -5536];
+
+        let inputIndex = 0;
+        const outputs: number[] = [];
+        const emulator = new Emulator(program, {
+            readInput: () => inputs[inputIndex++],
+            writeOutput: value => outputs.push(value),
+        }, configuration);
+
+        while (outputs.length < expectedOutputs.length) {
+            emulator.step();
+        }
+
+        assert.deepStrictEqual(outputs, expectedOutputs);
+        assert.strictEqual(emulator.getMemory(12), 5536);
+        assert.throws(() => emulator.startTracing(new sic1.TraceWriter()));
+
+        const result = new Verifier(program.bytes, configuration).verify(inputs, expectedOutputs, 1000, 1000);
+        assert.deepStrictEqual(result, {
+            status: VerificationStatus.correct,
+            cyclesExecuted: emulator.getCyclesExecuted(),
+            memoryBytesAccessed: emulator.getMemoryBytesAccessed(),
+        });
+
+        const profile = emulator.enableProfiling();
+        assert.strictEqual(profile.executionCounts.length, 65536);
+    });
+
+    it("Matches Emulator", () => {
+        const random = createRandom(1);
+        for (let i = 0; i < 200; i++) {
+            const bytes = createRandomProgram(random, configuration);
+
+            const inputs: number[] = [];
+            for (let j = 0; j < 20; j++) {
+                inputs.push(random(65536) - 32768);
+            }
+
+            let inputIndex = 0;
+            let cyclesExecuted = 0;
+            let memoryBytesAccessed = 0;
+            const outputs: number[] = [];
+            const emulator = new Emulator({ bytes, sourceMap: [], variables: [] }, {
+                readInput: () => inputs[inputIndex++],
+                writeOutput: n => outputs.push(n),
+            }, configuration);
+
+            while (emulator.isRunning() && emulator.getCyclesExecuted() < 500 && outputs.length < 10) {
+                const outputCount = outputs.length;
+                emulator.step();
+                if (outputs.length > outputCount) {
+                    cyclesExecuted = emulator.getCyclesExecuted();
+                    memoryBytesAccessed = emulator.getMemoryBytesAccessed();
+                }
+            }
+
+            if (outputs.length > 0) {
+                const result = new Verifier(bytes, configuration).verify(inputs, outputs, 500, 65536);
+                assert.deepStrictEqual(result, {
+                    status: VerificationStatus.correct,
+                    cyclesExecuted,
+                    memoryBytesAccessed,
+                }, `Mismatch for program: ${bytes.join(", ")}`);
+            }
+        }
+    });
+});
+
+describe("SIC-1 Network", () => {
+    const { Channel, Network, NetworkStatus } = sic1;
+    const addOne = Assembler.assemble(`
+        @loop:
+        subleq @tmp, @IN
+        subleq @tmp, @one
+        subleq @OUT, @tmp
+        subleq @tmp, @tmp, @loop
+
+        @one: .data 1
+        @tmp: .data 0
+    `.split("\n")).bytes;
+
+    it("Pipeline", () => {
+        const network = new Network();
+        const cores = [network.addCore(addOne), network.addCore(addOne), network.addCore(addOne)];
+        network.connect(cores[0], cores[1]);
+        network.connect(cores[1], cores[2]);
+
+        const inputs = [1, 2, 3, 4, 5, 6, 7, 8, 9, -128];
+        const output = new Channel(Infinity);
+        cores[0].input = new Channel(Infinity, inputs);
+        cores[2].output = output;
+
+        // Once the input is exhausted, every core ends up waiting for input
+        assert.strictEqual(network.run(10000), NetworkStatus.blocked);
+        assert.deepStrictEqual(output.drain(), inputs.map(n => ((n + 128 + 3) & 0xff) - 128));
+
+        // Each value takes 4 cycles per stage (and every byte of each program, plus @IN and @OUT, has been accessed)
+        for (const core of cores) {
+            assert.strictEqual(core.cyclesExecuted, 40);
+            assert.strictEqual(core.memoryBytesAccessed, 16);
+            assert.strictEqual(core.isBlocked(), true);
+        }
+
+        assert.strictEqual(network.cyclesExecuted, 120);
+    });
+
+    it("Backpressure", () => {
+        // Fast producer feeding a slow consumer through a channel that can only hold a single value
+        const network = new Network(1);
+        const producer = network.addCore(Assembler.assemble(`
+            @loop:
+            subleq @OUT, @n
+            subleq @n, @minusOne
+            subleq @zero, @zero, @loop
+
+            @n: .data 1
+            @minusOne: .data -1
+            @zero: .data 0
+        `.split("\n")).bytes);
+
+        const consumer = network.addCore(Assembler.assemble(`
+            @loop:
+            subleq @tmp, @IN
+            subleq @OUT, @tmp
+            subleq @tmp, @tmp
+            subleq @tmp, @tmp
+            subleq @tmp, @tmp, @loop
+
+            @tmp: .data 0
+        `.split("\n")).bytes);
+
+        const channel = network.connect(producer, consumer);
+        const output = new Channel(5);
+        consumer.output = output;
+
+        // The consumer is holding the 6th value (waiting on its full output), and the producer filled the channel again
+        assert.strictEqual(network.run(10000), NetworkStatus.blocked);
+        assert.strictEqual(producer.isBlocked(), true);
+        assert.strictEqual(consumer.isBlocked(), true);
+        assert.ok(producer.stalls > 0);
+        assert.strictEqual(channel.length, 1);
+        assert.deepStrictEqual(output.drain(), [-1, -2, -3, -4, -5]);
+
+        // Draining the output lets the pipeline resume
+        assert.strictEqual(consumer.isBlocked(), false);
+        assert.strictEqual(network.run(10000), NetworkStatus.blocked);
+        assert.deepStrictEqual(output.drain(), [-6, -7, -8, -9, -10]);
+    });
+
+    it("Deadlock", () => {
+        // Each core waits on the other's output
+        const network = new Network();
+        const first = network.addCore(addOne);
+        const second = network.addCore(addOne);
+        network.connect(first, second);
+        network.connect(second, first);
+
+        assert.strictEqual(network.run(10000), NetworkStatus.blocked);
+        assert.strictEqual(network.cyclesExecuted, 0);
+        assert.strictEqual(first.stalls, 1);
+        assert.strictEqual(second.stalls, 1);
+    });
+
+    it("Halt and cycle limit", () => {
+        const network = new Network();
+        const halts = network.addCore(Assembler.assemble(`
+            subleq @OUT, @minusOne
+            subleq @HALT, @HALT, @HALT
+
+            @minusOne: .data -1
+        `.split("\n")).bytes);
+
+        const output = new Channel(Infinity);
+        halts.output = output;
+        assert.strictEqual(network.run(10000), NetworkStatus.halted);
+        assert.deepStrictEqual(output.drain(), [1]);
+        assert.strictEqual(halts.cyclesExecuted, 2);
+
+        // Without an input channel, input reads as zero (so this loops forever)
+        const loops = network.addCore(addOne);
+        assert.strictEqual(network.run(1000), NetworkStatus.limitExceeded);
+        assert.strictEqual(network.cyclesExecuted, 1000);
+        assert.strictEqual(loops.cyclesExecuted, 998);
+    });
+
+    it("Matches Emulator", () => {
+        const random = createRandom(1);
+        for (let i = 0; i < 200; i++) {
+            const bytes = createRandomProgram(random);
+
+            const inputs: number[] = [];
+            for (let j = 0; j < 20; j++) {
+                inputs.push(random(256) - 128);
+            }
+
+            const network = new Network(7);
+            const core = network.addCore(bytes);
+            const output = new Channel(Infinity);
+            core.input = new Channel(Infinity, inputs);
+            core.output = output;
+            network.run(500);
+
+            // Step the emulator to the same point (the core stops early if it runs out of input)
+            let inputIndex = 0;
+            const outputs: number[] = [];
+            const emulator = new Emulator({ bytes, sourceMap: [], variables: [] }, {
+                readInput: () => inputs[inputIndex++],
+                writeOutput: n => outputs.push(n),
+            });
+
+            while (emulator.isRunning() && emulator.getCyclesExecuted() < core.cyclesExecuted) {
+                emulator.step();
+            }
+
+            const message = `Mismatch for program: ${bytes.join(", ")}`;
+            assert.deepStrictEqual(output.drain(), outputs, message);
+            assert.strictEqual(core.isHalted(), !emulator.isRunning(), message);
+            if (!core.isBlocked()) {
+                assert.strictEqual(core.memoryBytesAccessed, emulator.getMemoryBytesAccessed(), message);
+            }
+        }
+    });
+});
+
+describe("SIC-1 Equivalence checking", () => {
+    const { checkEquivalence, EquivalenceStatus } = sic1;
+    const assemble = (code: string) => Assembler.assemble(code.split("\n")).bytes;
+    const options = { inputValues: [-5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5], maxInputs: 4, maxCyclesPerInput: 1000 };
+
+    // Adds pairs of inputs
+    const reference = assemble(`
+        @loop:
+        subleq @tmp, @IN
+        subleq @tmp, @IN
+        subleq @OUT, @tmp
+        subleq @tmp, @tmp, @loop
+
+        @tmp: .data 0
+    `);
+
+    it("Equivalent", () => {
+        // Different algorithm (and layout) for the same function
+        const candidate = assemble(`
+            @loop:
+            subleq @a, @IN
+            subleq @b, @IN
+            subleq @c, @b
+            subleq @a, @c
+            subleq @OUT, @a
+            subleq @a, @a
+            subleq @b, @b
+            subleq @c, @c, @loop
+
+            @a: .data 0
+            @b: .data 0
+            @c: .data 0
+        `);
+
+        const result = checkEquivalence(candidate, reference, options);
+        assert.strictEqual(result.status, EquivalenceStatus.equivalent);
+        assert.strictEqual(result.counterexample, undefined);
+        assert.strictEqual(result.pathsPruned, 0);
+
+        // The state after each pair of inputs is the same as the initial state, so most of the search is cached
+        assert.ok(result.cacheHits > 0);
+        assert.ok(result.statesExplored < 11 * 11 * 11);
+    });
+
+    it("Counterexample", () => {
+        // Incorrect when the sum is 3
+        const candidate = assemble(`
+            @loop:
+            subleq @tmp, @IN
+            subleq @tmp, @IN
+            subleq @check, @tmp
+            subleq @check, @three, @maybe
+
+            @output:
+            subleq @OUT, @tmp
+            subleq @tmp, @tmp
+            subleq @check, @check, @loop
+
+            @maybe:
+            subleq @check, @minusOne, @output
+            subleq @tmp, @one
+            subleq @zero, @zero, @output
+
+            @tmp: .data 0
+            @check: .data 0
+            @three: .data 3
+            @one: .data 1
+            @minusOne: .data -1
+            @zero: .data 0
+        `);
+
+        const result = checkEquivalence(candidate, reference, options);
+        assert.strictEqual(result.status, EquivalenceStatus.counterexample);
+
+        // The counterexample is reproducible
+        const { inputs, expectedOutputs, errorContext } = result.counterexample!;
+        assert.ok(errorContext.startsWith("expected 3 but got 4 instead"));
+        const verification = new Verifier(candidate).verify(inputs, expectedOutputs, 1000, 256);
+        assert.strictEqual(verification.status, VerificationStatus.incorrectOutput);
+        assert.strictEqual(`${verification.errorContext} at index ${expectedOutputs.length - 1}`, errorContext);
+    });
+
+    it("Halts early", () => {
+        // Only handles the first pair
+        const candidate = assemble(`
+            subleq @tmp, @IN
+            subleq @tmp, @IN
+            subleq @OUT, @tmp
+            subleq @HALT, @HALT, @HALT
+
+            @tmp: .data 0
+        `);
+
+        const result = checkEquivalence(candidate, reference, options);
+        assert.strictEqual(result.status, EquivalenceStatus.counterexample);
+        assert.deepStrictEqual(result.counterexample, {
+            inputs: [-5, -5, -5, -5],
+            expectedOutputs: [-10, -10],
+            actualOutputs: [-10],
+            errorContext: "halted before producing all output",
+        });
+    });
+
+    it("Cycle limits", () => {
+        // Loops forever without reading input: pruned, rather than reported as incorrect
+        const candidate = assemble(`
+            @loop:
+            subleq @zero, @zero, @loop
+
+            @zero: .data 0
+        `);
+
+        const result = checkEquivalence(candidate, reference, options);
+        assert.strictEqual(result.status, EquivalenceStatus.equivalent);
+        assert.strictEqual(result.pathsPruned, 1);
+
+        // The search can be bounded too
+        const limited = checkEquivalence(reference, reference, { maxInputs: 4, maxCyclesPerInput: 1000, maxStates: 10 });
+        assert.strictEqual(limited.status, EquivalenceStatus.limitExceeded);
+        assert.strictEqual(limited.statesExplored, 10);
+    });
+});
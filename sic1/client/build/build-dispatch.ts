@@ -0,0 +1,15 @@
+// Script for generating the IDispatch name tables and invoke thunks for the native host objects (i.e. converting
+// windows/host-objects.idl into windows/host-objects-dispatch.h); rerun whenever the IDL changes
+import { readFileSync, writeFileSync } from "fs";
+import { join } from "path";
+import { generateHeader, parseIdl } from "./dispatch-generator";
+
+const windowsDirectoryName = "windows";
+const idlFileName = "host-objects.idl";
+const inputPath = join(windowsDirectoryName, idlFileName);
+const outputPath = join(windowsDirectoryName, "host-objects-dispatch.h");
+
+const idl = readFileSync(inputPath, { encoding: "utf8" });
+const header = generateHeader(parseIdl(idl), idlFileName);
+writeFileSync(outputPath, header);
+console.log(`${inputPath} => ${outputPath}`);
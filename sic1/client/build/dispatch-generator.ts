@@ -0,0 +1,308 @@
+// Generates IDispatch name tables and invoke thunks for the host objects declared in host-objects.idl (see
+// windows/dispatch-table.h and windows/dispatchable.h for the C++ side)
+
+export type MethodKind = "method" | "propget" | "propput";
+
+export interface Parameter {
+    name: string;
+    type: string;
+    retval: boolean;
+}
+
+export interface Method {
+    kind: MethodKind;
+    parameters: Parameter[];
+}
+
+export interface Member {
+    name: string;
+    dispId: number;
+    methods: Method[];
+}
+
+export interface Interface {
+    name: string;
+    members: Member[];
+}
+
+export interface PerfectHash {
+    seed: number;
+    slots: number[];
+}
+
+// How each IDL parameter type is read out of (or written into) a VARIANT. Boolean values use VT_I4 because that's
+// what the type library reports for BOOL (a typedef of long), so behavior matches the reflective path.
+interface TypeInfo {
+    variantType: string;
+    retvalDeclaration: (name: string) => string;
+    retvalAddress: (name: string) => string;
+    retvalRelease: (name: string) => string;
+}
+
+const types: { [type: string]: TypeInfo } = {
+    BOOL: {
+        variantType: "VT_I4",
+        retvalDeclaration: name => `BOOL ${name} = FALSE`,
+        retvalAddress: name => `&${name}`,
+        retvalRelease: name => name,
+    },
+    INT32: {
+        variantType: "VT_I4",
+        retvalDeclaration: name => `INT32 ${name} = 0`,
+        retvalAddress: name => `&${name}`,
+        retvalRelease: name => name,
+    },
+    UINT32: {
+        variantType: "VT_UI4",
+        retvalDeclaration: name => `UINT32 ${name} = 0`,
+        retvalAddress: name => `&${name}`,
+        retvalRelease: name => name,
+    },
+    BSTR: {
+        variantType: "VT_BSTR",
+        retvalDeclaration: name => `wil::unique_bstr ${name}`,
+        retvalAddress: name => `${name}.put()`,
+        retvalRelease: name => `${name}.release()`,
+    },
+    "IDispatch*": {
+        variantType: "VT_DISPATCH",
+        retvalDeclaration: name => `wil::com_ptr<IDispatch> ${name}`,
+        retvalAddress: name => `${name}.put()`,
+        retvalRelease: name => `${name}.detach()`,
+    },
+    VARIANT: {
+        variantType: "VT_VARIANT",
+        retvalDeclaration: name => `wil::unique_variant ${name}`,
+        retvalAddress: name => `${name}.addressof()`,
+        retvalRelease: name => `${name}.release()`,
+    },
+};
+
+function getTypeInfo(type: string): TypeInfo {
+    const info = types[type];
+    if (!info) {
+        throw new Error(`Unsupported IDL type: ${type}`);
+    }
+    return info;
+}
+
+function parseParameter(text: string): Parameter {
+    const match = /^\[([^\]]*)\]\s*(.+?)\s*(\w+)$/.exec(text.trim());
+    if (!match) {
+        throw new Error(`Could not parse parameter: ${text}`);
+    }
+
+    const attributes = match[1].split(",").map(attribute => attribute.trim());
+    const retval = attributes.includes("retval");
+    let type = match[2].replace(/\s+/g, "");
+    if (retval) {
+        if (!type.endsWith("*")) {
+            throw new Error(`Return value must be a pointer: ${text}`);
+        }
+        type = type.substring(0, type.length - 1);
+    } else if (!attributes.includes("in")) {
+        throw new Error(`Only [in] and [out, retval] parameters are supported: ${text}`);
+    }
+
+    getTypeInfo(type);
+    return { name: match[3], type, retval };
+}
+
+// Parses the IUnknown-based interfaces out of an IDL file; DISPIDs are assigned in declaration order, starting at 1
+// (property accessors share a DISPID)
+export function parseIdl(idl: string): Interface[] {
+    const interfaces: Interface[] = [];
+    const interfacePattern = /interface\s+(\w+)\s*:\s*IUnknown\s*\{([^}]*)\}/g;
+    const methodPattern = /^(?:\[(propget|propput)\]\s*)?HRESULT\s+(\w+)\s*\(([^)]*)\)$/;
+    let interfaceMatch: RegExpExecArray | null;
+    while ((interfaceMatch = interfacePattern.exec(idl)) !== null) {
+        const members: Member[] = [];
+        const body = interfaceMatch[2].replace(/\/\/[^\n]*/g, "");
+        for (const statement of body.split(";")) {
+            const trimmed = statement.replace(/\s+/g, " ").trim();
+            if (trimmed.length === 0) {
+                continue;
+            }
+
+            const methodMatch = methodPattern.exec(trimmed);
+            if (!methodMatch) {
+                throw new Error(`Could not parse method in ${interfaceMatch[1]}: ${trimmed}`);
+            }
+
+            const kind = (methodMatch[1] ?? "method") as MethodKind;
+            const name = methodMatch[2];
+            const parameterList = methodMatch[3].trim();
+
+            // Note: parameters are split on their attribute lists, since those can contain commas (e.g. "[out, retval]")
+            const parameters = (parameterList.match(/\[[^\]]*\][^,\[]*/g) ?? []).map(parseParameter);
+            if (parameters.length === 0 && parameterList.length > 0) {
+                throw new Error(`Could not parse parameters in ${interfaceMatch[1]}: ${trimmed}`);
+            }
+
+            const retvals = parameters.filter(parameter => parameter.retval);
+            if (retvals.length > 1 || (retvals.length === 1 && !parameters[parameters.length - 1].retval)) {
+                throw new Error(`Return value must be the last parameter: ${trimmed}`);
+            }
+
+            let member = members.find(m => m.name.toLowerCase() === name.toLowerCase());
+            if (!member) {
+                member = { name, dispId: members.length + 1, methods: [] };
+                members.push(member);
+            }
+
+            // A member is either a method or a property (with a getter and/or a setter), never both
+            if (member.methods.some(method => method.kind === kind || (method.kind === "method") !== (kind === "method"))) {
+                throw new Error(`Conflicting declarations for ${interfaceMatch[1]}::${name}`);
+            }
+
+            member.methods.push({ kind, parameters });
+        }
+
+        interfaces.push({ name: interfaceMatch[1], members });
+    }
+    return interfaces;
+}
+
+// FNV-1a over the lower-cased name, with the seed mixed into the offset basis (must match Dispatch::HashName)
+export function hashName(name: string, seed: number): number {
+    let hash = (2166136261 ^ seed) >>> 0;
+    for (let i = 0; i < name.length; i++) {
+        let c = name.charCodeAt(i);
+        if (c >= 0x41 && c <= 0x5a) {
+            c += 0x20;
+        }
+
+        hash = (hash ^ c) >>> 0;
+        hash = Math.imul(hash, 16777619) >>> 0;
+    }
+    return hash;
+}
+
+// Finds the first seed for which every name lands in its own slot, growing the table if no seed works
+export function findPerfectHash(names: string[]): PerfectHash {
+    const maximumSeed = 1 << 16;
+    let slotCount = 1;
+    while (slotCount < names.length * 2) {
+        slotCount *= 2;
+    }
+
+    for (; ; slotCount *= 2) {
+        for (let seed = 0; seed < maximumSeed; seed++) {
+            const slots = new Array<number>(slotCount).fill(-1);
+            let collision = false;
+            for (let i = 0; i < names.length && !collision; i++) {
+                const slot = hashName(names[i], seed) & (slotCount - 1);
+                collision = (slots[slot] !== -1);
+                slots[slot] = i;
+            }
+
+            if (!collision) {
+                return { seed, slots };
+            }
+        }
+    }
+}
+
+function generateCall(lines: string[], member: Member, method: Method, indent: string): void {
+    const inputs = method.parameters.filter(parameter => !parameter.retval);
+    const retval = method.parameters.find(parameter => parameter.retval);
+    const prefix = (method.kind === "propget") ? "get_" : (method.kind === "propput") ? "put_" : "";
+
+    if (method.kind === "propput") {
+        lines.push(`${indent}RETURN_IF_FAILED(CheckPropertyPutArguments(params));`);
+    } else {
+        lines.push(`${indent}RETURN_IF_FAILED(CheckArguments(params, ${inputs.length}));`);
+    }
+
+    inputs.forEach((parameter, index) => {
+        lines.push(`${indent}Argument<${getTypeInfo(parameter.type).variantType}> ${parameter.name}Argument;`);
+        lines.push(`${indent}RETURN_IF_FAILED(${parameter.name}Argument.Load(params, ${index}, argErr));`);
+    });
+
+    // Note: locals are suffixed so that they can't shadow the thunk's own parameters
+    const callArguments = inputs.map(parameter => `${parameter.name}Argument.Get()`);
+    if (retval) {
+        const info = getTypeInfo(retval.type);
+        const name = `${retval.name}Value`;
+        lines.push(`${indent}${info.retvalDeclaration(name)};`);
+        callArguments.push(info.retvalAddress(name));
+        lines.push(`${indent}RETURN_IF_FAILED(object->${prefix}${member.name}(${callArguments.join(", ")}));`);
+        lines.push(`${indent}SetResult<${info.variantType}>(result, ${info.retvalRelease(name)});`);
+        lines.push(`${indent}return S_OK;`);
+    } else {
+        lines.push(`${indent}return object->${prefix}${member.name}(${callArguments.join(", ")});`);
+    }
+}
+
+const flagsByKind: { [kind in MethodKind]: string } = {
+    propget: "DISPATCH_PROPERTYGET",
+    propput: "(DISPATCH_PROPERTYPUT | DISPATCH_PROPERTYPUTREF)",
+    method: "DISPATCH_METHOD",
+};
+
+// Property gets are checked first, since script engines often pass DISPATCH_METHOD | DISPATCH_PROPERTYGET
+const kindOrder: MethodKind[] = ["propget", "propput", "method"];
+
+export function generateTraits(iface: Interface): string {
+    const names = iface.members.map(member => member.name);
+    const hash = findPerfectHash(names);
+    const lines: string[] = [];
+
+    lines.push(`template<>`);
+    lines.push(`struct Traits<${iface.name}> {`);
+    lines.push(`    static constexpr bool generated = true;`);
+    lines.push(``);
+    lines.push(`    static constexpr NameTable<${names.length}, ${hash.slots.length}> names = {`);
+    lines.push(`        ${hash.seed}u,`);
+    lines.push(`        {`);
+    for (const member of iface.members) {
+        lines.push(`            { "${member.name}", ${member.dispId} },`);
+    }
+    lines.push(`        },`);
+    lines.push(`        { ${hash.slots.join(", ")} },`);
+    lines.push(`    };`);
+    lines.push(``);
+    lines.push(`    static constexpr bool Contains(DISPID dispId) {`);
+    lines.push(`        return dispId >= 1 && dispId <= ${names.length};`);
+    lines.push(`    }`);
+    lines.push(``);
+    lines.push(`    static HRESULT Invoke(${iface.name}* object, DISPID dispId, WORD flags, DISPPARAMS* params, VARIANT* result, UINT* argErr) {`);
+    lines.push(`        switch (dispId) {`);
+    for (const member of iface.members) {
+        lines.push(`        case ${member.dispId}: // ${member.name}`);
+
+        const methods = member.methods.slice().sort((a, b) => kindOrder.indexOf(a.kind) - kindOrder.indexOf(b.kind));
+        for (const method of methods) {
+            lines.push(`            if ((flags & ${flagsByKind[method.kind]}) != 0) {`);
+            generateCall(lines, member, method, "                ");
+            lines.push(`            }`);
+        }
+        lines.push(`            break;`);
+        lines.push(``);
+    }
+    lines.push(`        default:`);
+    lines.push(`            break;`);
+    lines.push(`        }`);
+    lines.push(`        return DISP_E_MEMBERNOTFOUND;`);
+    lines.push(`    }`);
+    lines.push(`};`);
+    lines.push(``);
+    lines.push(`static_assert(Traits<${iface.name}>::names.IsPerfect(), "Name table for ${iface.name} has collisions");`);
+    return lines.join("\n");
+}
+
+export function generateHeader(interfaces: Interface[], sourceName: string): string {
+    return [
+        `#pragma once`,
+        ``,
+        `// Generated from ${sourceName} by build/build-dispatch.ts (npm run build:dispatch); do not edit by hand`,
+        ``,
+        `#include "host-objects_h.h"`,
+        `#include "dispatchable.h"`,
+        ``,
+        `namespace Dispatch {`,
+        interfaces.map(generateTraits).join("\n\n").split("\n").map(line => (line.length > 0) ? `    ${line}` : line).join("\n"),
+        `}`,
+        ``,
+    ].join("\n");
+}
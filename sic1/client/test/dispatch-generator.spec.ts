@@ -0,0 +1,75 @@
+import "mocha";
+import * as assert from "assert";
+import { readFileSync } from "fs";
+import { join } from "path";
+import { findPerfectHash, generateHeader, hashName, parseIdl } from "../build/dispatch-generator";
+
+const windowsDirectoryPath = join("..", "windows");
+const idl = readFileSync(join(windowsDirectoryPath, "host-objects.idl"), { encoding: "utf8" });
+
+describe("Dispatch table generator", () => {
+    it("Parses host object interfaces", () => {
+        const interfaces = parseIdl(idl);
+        assert.deepStrictEqual(interfaces.map(i => i.name), ["IWebViewWindow", "ISteam"]);
+
+        const webViewWindow = interfaces[0];
+        const fullscreen = webViewWindow.members.find(m => m.name === "Fullscreen");
+        assert.strictEqual(fullscreen.dispId, 1);
+        assert.deepStrictEqual(fullscreen.methods.map(m => m.kind), ["propget", "propput"]);
+
+        const getPresentationSetting = webViewWindow.members.find(m => m.name === "GetPresentationSetting");
+        assert.deepStrictEqual(getPresentationSetting.methods, [{
+            kind: "method",
+            parameters: [
+                { name: "name", type: "BSTR", retval: false },
+                { name: "data", type: "VARIANT", retval: true },
+            ],
+        }]);
+
+        // DISPIDs are unique and dense within each interface
+        for (const iface of interfaces) {
+            assert.deepStrictEqual(iface.members.map(m => m.dispId), iface.members.map((m, index) => index + 1));
+        }
+    });
+
+    it("Rejects unsupported declarations", () => {
+        assert.throws(() => parseIdl("interface IBad : IUnknown { HRESULT Foo([in] double value); };"));
+        assert.throws(() => parseIdl("interface IBad : IUnknown { HRESULT Foo([out] BSTR* value); };"));
+        assert.throws(() => parseIdl("interface IBad : IUnknown { HRESULT Foo(); [propget] HRESULT Foo([out, retval] BOOL* value); };"));
+    });
+
+    it("Hashes names case-insensitively", () => {
+        // Must match Dispatch::HashName in dispatch-table.h
+        assert.strictEqual(hashName("", 0), 2166136261);
+        assert.strictEqual(hashName("Fullscreen", 4), 1970016316);
+        assert.strictEqual(hashName("ResolveStoreAchievements", 11), 4075914891);
+        assert.strictEqual(hashName("café", 0), 856211068);
+        assert.strictEqual(hashName("FULLSCREEN", 4), hashName("fullscreen", 4));
+    });
+
+    it("Finds collision-free tables", () => {
+        const names = ["a", "b", "c", "aa", "ab", "ba", "GetAchievement", "SetAchievement", "getachievements"];
+        const { seed, slots } = findPerfectHash(names);
+        assert.strictEqual(slots.length & (slots.length - 1), 0);
+        names.forEach((name, index) => assert.strictEqual(slots[hashName(name, seed) & (slots.length - 1)], index));
+        assert.strictEqual(slots.filter(slot => slot >= 0).length, names.length);
+    });
+
+    it("Generated header is up to date", () => {
+        const header = readFileSync(join(windowsDirectoryPath, "host-objects-dispatch.h"), { encoding: "utf8" });
+        assert.strictEqual(header, generateHeader(parseIdl(idl), "host-objects.idl"));
+    });
+
+    it("Native test's copy of a table is up to date", () => {
+        // windows/test/dispatch-table-test.cpp can't include the generated header, so it has its own copy of a table
+        const extractTable = (source: string, declaration: string) => {
+            const start = source.indexOf(declaration);
+            assert.notStrictEqual(start, -1);
+            return source.substring(start + declaration.length, source.indexOf("};", start)).replace(/\s+/g, " ");
+        };
+
+        const header = readFileSync(join(windowsDirectoryPath, "host-objects-dispatch.h"), { encoding: "utf8" });
+        const test = readFileSync(join(windowsDirectoryPath, "test", "dispatch-table-test.cpp"), { encoding: "utf8" });
+        assert.strictEqual(extractTable(test, "NameTable<10, 32> webViewWindowNames = "), extractTable(header, "NameTable<10, 32> names = "));
+    });
+});
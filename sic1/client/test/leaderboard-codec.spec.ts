@@ -0,0 +1,99 @@
+import "mocha";
+import * as assert from "assert";
+import { decodeFriendLeaderboardEntries, FriendLeaderboardEntry, fromBinaryString, toBinaryString } from "../ts/leaderboard-codec";
+
+// Reference encoder for the format written by LeaderboardCodec::EncodeEntries
+function encodeEntries(entries: FriendLeaderboardEntry[]): string {
+    const encoder = new TextEncoder();
+    const bytes: number[] = [];
+    const writeUInt = (value: number, byteCount: number) => {
+        for (let i = 0; i < byteCount; i++) {
+            bytes.push((value >>> (8 * i)) & 0xff);
+        }
+    };
+
+    writeUInt(entries.length, 4);
+    for (const { name, score } of entries) {
+        const nameBytes = encoder.encode(name);
+        writeUInt(score >>> 0, 4);
+        writeUInt(nameBytes.length, 2);
+        bytes.push(...nameBytes);
+    }
+    return toBinaryString(bytes);
+}
+
+// Simple deterministic generator, so failures are reproducible
+function createRandom(seed: number): () => number {
+    return () => {
+        seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+        return seed / 0x100000000;
+    };
+}
+
+describe("Leaderboard codec", () => {
+    it("Decodes native-encoded entries", () => {
+        // Output of LeaderboardCodec::EncodeEntries for these entries
+        const encoded = String.fromCharCode(3, 0, 0, 0, 210, 4, 0, 0, 5, 0, 65, 108, 105, 99, 101, 251, 255, 255, 255, 5, 0, 195, 169, 116, 195, 169, 0, 0, 0, 0, 0, 0);
+        assert.deepStrictEqual(decodeFriendLeaderboardEntries(encoded), [
+            { name: "Alice", score: 1234 },
+            { name: "été", score: -5 },
+            { name: "", score: 0 },
+        ]);
+    });
+
+    it("Round-trips random entries", () => {
+        const random = createRandom(1);
+        const alphabet = "abcXYZ 0123é世😀";
+        for (let iteration = 0; iteration < 500; iteration++) {
+            const entries: FriendLeaderboardEntry[] = [];
+            const count = Math.floor(random() * 20);
+            for (let i = 0; i < count; i++) {
+                const characters = Array.from(alphabet);
+                let name = "";
+                const length = Math.floor(random() * 32);
+                for (let j = 0; j < length; j++) {
+                    name += characters[Math.floor(random() * characters.length)];
+                }
+                entries.push({ name, score: Math.floor(random() * 0x100000000) - 0x80000000 });
+            }
+
+            assert.deepStrictEqual(decodeFriendLeaderboardEntries(encodeEntries(entries)), entries);
+        }
+    });
+
+    it("Rejects truncated and corrupted input", () => {
+        const random = createRandom(2);
+        const encoded = encodeEntries([{ name: "Alice", score: 1 }, { name: "Bob", score: 2 }]);
+        for (let length = 0; length < encoded.length; length++) {
+            assert.throws(() => decodeFriendLeaderboardEntries(encoded.substring(0, length)));
+        }
+        assert.throws(() => decodeFriendLeaderboardEntries(encoded + "\0"));
+        assert.throws(() => decodeFriendLeaderboardEntries("￿" + encoded.substring(1)));
+        assert.throws(() => decodeFriendLeaderboardEntries("\xff\xff\xff\xff"));
+
+        // Arbitrary bytes must either decode or throw
+        for (let iteration = 0; iteration < 2000; iteration++) {
+            const bytes: number[] = [Math.floor(random() * 4), 0, 0, 0];
+            const length = Math.floor(random() * 40);
+            for (let i = 0; i < length; i++) {
+                bytes.push(Math.floor(random() * 256));
+            }
+
+            try {
+                decodeFriendLeaderboardEntries(toBinaryString(bytes)).forEach(entry => assert.strictEqual(typeof(entry.name), "string"));
+            } catch (error) {
+                assert.ok(error instanceof Error);
+            }
+        }
+    });
+
+    it("Converts bytes to and from binary strings", () => {
+        const bytes = Array.from({ length: 10000 }, (_, i) => (i * 7) & 0xff);
+        const binary = toBinaryString(bytes);
+        assert.strictEqual(binary.length, bytes.length);
+        assert.deepStrictEqual(Array.from(fromBinaryString(binary)), bytes);
+        assert.throws(() => toBinaryString([256]));
+        assert.throws(() => toBinaryString([-1]));
+        assert.throws(() => fromBinaryString("Ā"));
+    });
+});
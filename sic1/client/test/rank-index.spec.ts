@@ -0,0 +1,127 @@
+import "mocha";
+import * as assert from "assert";
+import { RankIndex } from "../ts/rank-index";
+
+// Simple deterministic generator, so failures are reproducible
+function createRandom(seed: number): () => number {
+    return () => {
+        seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+        return seed / 0x100000000;
+    };
+}
+
+describe("Rank index", () => {
+    it("Merges histograms", () => {
+        const index = RankIndex.fromHistogramData(
+            [{ bucketMax: 20, count: 2 }, { bucketMax: 10, count: 1 }],
+            undefined,
+            [{ bucketMax: 10, count: 3 }, { bucketMax: 30, count: 0 }],
+        );
+
+        assert.strictEqual(index.getTotal(), 6);
+        assert.deepStrictEqual(index.toHistogramData(), [
+            { bucketMax: 10, count: 4 },
+            { bucketMax: 20, count: 2 },
+            { bucketMax: 30, count: 0 },
+        ]);
+    });
+
+    it("Counts scores above and below", () => {
+        const index = RankIndex.fromHistogramData([{ bucketMax: 10, count: 4 }, { bucketMax: 20, count: 2 }, { bucketMax: 40, count: 1 }]);
+        assert.strictEqual(index.countBelow(10), 0);
+        assert.strictEqual(index.countBelow(11), 4);
+        assert.strictEqual(index.countBelow(20), 4);
+        assert.strictEqual(index.countBelow(100), 7);
+        assert.strictEqual(index.countAbove(5), 7);
+        assert.strictEqual(index.countAbove(10), 3);
+        assert.strictEqual(index.countAbove(30), 1);
+        assert.strictEqual(index.countAbove(40), 0);
+    });
+
+    it("Selects scores by rank", () => {
+        const index = RankIndex.fromHistogramData([{ bucketMax: 10, count: 4 }, { bucketMax: 20, count: 2 }, { bucketMax: 40, count: 1 }]);
+        assert.deepStrictEqual([0, 1, 4, 5, 6, 7, 8].map(rank => index.select(rank)), [undefined, 10, 10, 20, 20, 40, undefined]);
+    });
+
+    it("Calculates percent beaten", () => {
+        const index = RankIndex.fromHistogramData([{ bucketMax: 10, count: 1 }, { bucketMax: 20, count: 3 }, { bucketMax: 30, count: 1 }]);
+        assert.strictEqual(index.getPercentBeaten(10), 100);
+        assert.strictEqual(index.getPercentBeaten(20), 25);
+        assert.strictEqual(index.getPercentBeaten(30), 0);
+        assert.strictEqual(index.getPercentBeaten(30, true), 100);
+        assert.strictEqual(RankIndex.fromHistogramData([{ bucketMax: 5, count: 1 }]).getPercentBeaten(5), 100);
+    });
+
+    it("Matches a linear scan after random insertions", () => {
+        const random = createRandom(1234);
+        const index = new RankIndex();
+        const scores: number[] = [];
+        for (let i = 0; i < 500; i++) {
+            const score = 1 + Math.floor(random() * 100);
+            index.add(score);
+            scores.push(score);
+
+            const probe = Math.floor(random() * 102);
+            assert.strictEqual(index.countBelow(probe), scores.filter(s => s < probe).length);
+            assert.strictEqual(index.countAbove(probe), scores.filter(s => s > probe).length);
+        }
+
+        const sorted = scores.slice().sort((a, b) => a - b);
+        for (let rank = 1; rank <= sorted.length; rank++) {
+            assert.strictEqual(index.select(rank), sorted[rank - 1]);
+        }
+
+        // Round trip through serialization
+        const copy = RankIndex.fromHistogramData(index.toHistogramData());
+        assert.deepStrictEqual(copy.toHistogramData(), index.toHistogramData());
+        assert.strictEqual(copy.getTotal(), scores.length);
+    });
+
+    it("Adds batches of scores", () => {
+        const index = RankIndex.fromHistogramData([{ bucketMax: 10, count: 1 }, { bucketMax: 30, count: 2 }]);
+        index.addHistogramData([{ bucketMax: 30, count: 1 }, { bucketMax: 40, count: 1 }, { bucketMax: 5, count: 2 }, { bucketMax: 20, count: 1 }, { bucketMax: 5, count: 1 }]);
+        index.addHistogramData(undefined);
+        index.addHistogramData([]);
+
+        assert.strictEqual(index.getTotal(), 9);
+        assert.deepStrictEqual(index.toHistogramData(), [
+            { bucketMax: 5, count: 3 },
+            { bucketMax: 10, count: 1 },
+            { bucketMax: 20, count: 1 },
+            { bucketMax: 30, count: 3 },
+            { bucketMax: 40, count: 1 },
+        ]);
+        assert.strictEqual(index.countBelow(30), 5);
+        assert.strictEqual(index.select(6), 30);
+    });
+
+    it("Matches one-at-a-time insertion for random batches", () => {
+        const random = createRandom(5678);
+        for (let i = 0; i < 50; i++) {
+            const cached = Array.from({ length: Math.floor(random() * 20) }, () => ({ bucketMax: Math.floor(random() * 50), count: 1 + Math.floor(random() * 3) }));
+            const live = Array.from({ length: Math.floor(random() * 20) }, () => ({ bucketMax: Math.floor(random() * 50), count: Math.floor(random() * 3) }));
+
+            const batched = RankIndex.fromHistogramData(cached);
+            batched.addHistogramData(live);
+
+            const incremental = RankIndex.fromHistogramData(cached);
+            live.forEach(({ bucketMax, count }) => incremental.add(bucketMax, count));
+
+            assert.deepStrictEqual(batched.toHistogramData(), incremental.toHistogramData());
+            assert.strictEqual(batched.getTotal(), incremental.getTotal());
+            for (let probe = 0; probe <= 50; probe += 5) {
+                assert.strictEqual(batched.countBelow(probe), incremental.countBelow(probe));
+            }
+        }
+    });
+
+    it("Clones independently", () => {
+        const index = RankIndex.fromHistogramData([{ bucketMax: 10, count: 1 }]);
+        const clone = index.clone();
+        clone.add(10);
+        clone.add(5);
+        assert.strictEqual(index.getTotal(), 1);
+        assert.strictEqual(clone.getTotal(), 3);
+        assert.strictEqual(clone.countBelow(10), 1);
+    });
+});
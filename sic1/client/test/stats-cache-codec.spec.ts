@@ -0,0 +1,53 @@
+import "mocha";
+import * as assert from "assert";
+import { decodeStatsCache, encodeStatsCache, Sic1StatsCache } from "../ts/stats-cache-codec";
+
+const cache: Sic1StatsCache = {
+    userStats: {
+        solutionsByUser: [{ bucketMax: 3, count: 10 }, { bucketMax: 1, count: 200 }, { bucketMax: 2, count: 0 }],
+        userSolvedCount: 7,
+    },
+    puzzleStats: {
+        "Addition": {
+            cyclesExecutedBySolution: [{ bucketMax: 16, count: 300 }, { bucketMax: 100000, count: 1 }],
+            memoryBytesAccessedBySolution: [],
+        },
+        "Négatif": {
+            cyclesExecutedBySolution: [{ bucketMax: 5, count: -1 }],
+            memoryBytesAccessedBySolution: [{ bucketMax: 0, count: 1 }, { bucketMax: 2147483647, count: 2 }],
+        },
+    },
+};
+
+describe("Stats cache codec", () => {
+    it("Round trips", () => {
+        const decoded = decodeStatsCache(encodeStatsCache(cache));
+        assert.deepStrictEqual(decoded.userStats, {
+            solutionsByUser: [{ bucketMax: 1, count: 200 }, { bucketMax: 2, count: 0 }, { bucketMax: 3, count: 10 }],
+            userSolvedCount: 7,
+        });
+
+        assert.deepStrictEqual(Object.keys(decoded.puzzleStats), ["Addition", "Négatif"]);
+        assert.deepStrictEqual(decoded.puzzleStats["Addition"], cache.puzzleStats["Addition"]);
+        assert.deepStrictEqual(decoded.puzzleStats["Négatif"], cache.puzzleStats["Négatif"]);
+        assert.strictEqual(decoded.puzzleStats["Missing"], undefined);
+    });
+
+    it("Decodes puzzles once", () => {
+        const decoded = decodeStatsCache(encodeStatsCache(cache));
+        const first = decoded.puzzleStats["Addition"];
+        assert.strictEqual(decoded.puzzleStats["Addition"], first);
+    });
+
+    it("Rejects invalid data", () => {
+        const binary = atob(encodeStatsCache(cache));
+        assert.throws(() => decodeStatsCache(btoa(binary.substring(0, binary.length - 1))));
+        assert.throws(() => decodeStatsCache(btoa(binary + "\0")));
+        assert.throws(() => decodeStatsCache(btoa("\xff\xff\xff\xff\xff\xff\xff\xff\xff")));
+
+        // Corrupt puzzle data is only detected when that puzzle is accessed
+        const corrupt = decodeStatsCache(btoa(binary.substring(0, binary.length - 1) + "\x80"));
+        assert.deepStrictEqual(corrupt.puzzleStats["Addition"], cache.puzzleStats["Addition"]);
+        assert.throws(() => corrupt.puzzleStats["Négatif"]);
+    });
+});
@@ -17,4 +17,7 @@ export interface HistogramDetail {
 export interface ChartData {
     histogram: HistogramDetail;
     highlightedValue?: number;
+
+    /** Percentage of other scores that the highlighted value beats */
+    percentBeaten?: number;
 }
@@ -34,11 +34,13 @@ function limitLines(lines: string[], maxLines: number): string[] {
     }
 }
 
-function formatDetails(details: HistogramBucketDetail[], outliers?: HistogramBucketDetail[]): string {
+function formatDetails(details: HistogramBucketDetail[], outliers?: HistogramBucketDetail[], summary?: string): string {
+    const summaryLines = summary ? [summary, ""] : [];
     const scoreLines = limitLines(details.map(detail => formatDetail(detail)), 7);
     const outlierLines = limitLines(outliers ? ["", "Outliers:", ...outliers.map(detail => formatDetail(detail))] : [], 5);
 
-    return scoreLines
+    return summaryLines
+        .concat(...scoreLines)
         .concat(...outlierLines)
         .join("\n")
     ;
@@ -68,6 +70,7 @@ export class Chart extends Component<ChartProperties, ChartComponentState> {
             const outliers = this.state.data.histogram.outliers ?? [];
             const data = this.state.data.histogram.buckets;
             const highlightedValue = this.state.data.highlightedValue;
+            const percentBeaten = this.state.data.percentBeaten;
             let maxCount = 1;
             let minValue = null;
             let maxValue = null;
@@ -103,7 +106,7 @@ export class Chart extends Component<ChartProperties, ChartComponentState> {
                 {highlightIndex === null ? null : <rect className="chartHighlight" x={highlightIndex * 20 / data.length} y={chartHeight - (data[highlightIndex].count * scale)} width={20 / data.length} height={data[highlightIndex].count * scale}></rect>}
                 {highlightIndex === null ? null : <polyline className="chartArrow" points="0,-0.5 0.5,0 1,-0.5 0,-0.5" transform={`translate(${highlightIndex * 20 / data.length}, ${chartHeight - (data[highlightIndex].count * scale + 0.5)}) scale(${20 / data.length})`}></polyline>}
                 {data.map(({ bucketMax, count, details }, i) => <rect className="chartInvisible" x={i * 20 / data.length} y={chartHeight - Math.max(1, (count * scale))} width={20 / data.length} height={Math.max(1, (count * scale))}>
-                    <title>{formatDetails(details, (i === data.length - 1) ? outliers : undefined)}</title>
+                    <title>{formatDetails(details, (i === data.length - 1) ? outliers : undefined, (i === highlightIndex && percentBeaten !== undefined) ? `Better than ${Math.floor(percentBeaten)}% of other scores` : undefined)}</title>
                 </rect>)}
                 <text className="chartLeft" x="0" y="21.5">{minValue}</text>
                 <text className="chartRight" x="20" y="21.5">{maxValue}</text>
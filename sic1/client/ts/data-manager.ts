@@ -160,7 +160,7 @@ export class Sic1DataManager {
         } catch (e) {}
 
         if (Platform.scheduleLocalStoragePersist) {
-            Platform.scheduleLocalStoragePersist();
+            Platform.scheduleLocalStoragePersist(key);
         }
     }
 
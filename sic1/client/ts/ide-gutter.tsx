@@ -1,4 +1,5 @@
 import { Component, ComponentChild, createRef } from "preact";
+import { LineProfile, ProfileSummary } from "sic1asm";
 import { Shared } from "./shared";
 
 export interface GutterProperties {
@@ -6,6 +7,8 @@ export interface GutterProperties {
     sourceLines: string[];
     currentSourceLine: number;
     sourceLineToBreakpointState: { [lineNumber: number]: boolean | undefined };
+    profile?: ProfileSummary;
+    unreachableSourceLines: { [lineNumber: number]: boolean };
     onToggleBreakpoint: (lineNumber: number) => void;
 }
 
@@ -21,7 +24,19 @@ export class Gutter extends Component<GutterProperties> {
         Shared.scrollElementIntoView(this.currentSourceLineElement.current);
     }
 
+    private static formatLineProfile({ executions, branchesTaken, branchesNotTaken }: LineProfile): string {
+        return `Executed: ${executions}\nBranched: ${branchesTaken}\nNot branched: ${branchesNotTaken}`;
+    }
+
     public render(): ComponentChild {
+        // Shade lines by how often they've been executed, relative to the hottest line
+        const sourceLineToProfile: { [lineNumber: number]: LineProfile } = {};
+        let maxExecutions = 0;
+        for (const lineProfile of this.props.profile?.lines ?? []) {
+            sourceLineToProfile[lineProfile.lineNumber] = lineProfile;
+            maxExecutions = Math.max(maxExecutions, lineProfile.executions);
+        }
+
         return <div className="gutter">
             {this.props.hasStarted
                 ? (this.props.sourceLines.map((s, index) =>
@@ -30,7 +45,9 @@ export class Gutter extends Component<GutterProperties> {
                             ?
                                 <span
                                     ref={(index === this.props.currentSourceLine) ? this.currentSourceLineElement : undefined}
-                                    className={`breakpoint${this.props.sourceLineToBreakpointState[index] ? "" : " off"}`}
+                                    className={`breakpoint${this.props.sourceLineToBreakpointState[index] ? "" : " off"}${this.props.unreachableSourceLines[index] ? " unreachable" : ""}`}
+                                    style={sourceLineToProfile[index] ? { backgroundColor: `color-mix(in srgb, var(--fg) ${Math.round(50 * sourceLineToProfile[index].executions / maxExecutions)}%, transparent)` } : undefined}
+                                    title={sourceLineToProfile[index] ? Gutter.formatLineProfile(sourceLineToProfile[index]) : (this.props.unreachableSourceLines[index] ? "Unreachable" : undefined)}
                                     tabIndex={0}
                                     onMouseDown={(event) => {
                                         this.props.onToggleBreakpoint(index);
@@ -15,6 +15,17 @@ export interface Sic1MemoryProps {
 }
 
 export class Sic1Memory extends Component<Sic1MemoryProps> {
+    // Note: memory is replaced (rather than modified) when it changes, so the grid only needs to be reconciled when a
+    // prop actually changes, and not every time the IDE re-renders (e.g. for each cycle)
+    public shouldComponentUpdate(nextProps: Readonly<Sic1MemoryProps>): boolean {
+        for (const key in nextProps) {
+            if (nextProps[key] !== this.props[key]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     public render(): ComponentChild {
         return <table className={`memory${this.props.hasStarted ? " running" : ""}`}><tr><th colSpan={16}>Memory</th></tr>
         {
@@ -1,5 +1,5 @@
 import { Component, ComponentChild } from "preact";
-import { Assembler, Variable } from "sic1asm";
+import { AddressProfile, Assembler, ProfileSummary, Variable } from "sic1asm";
 import { NumberSpan } from "./ide-number-span";
 
 export interface Sic1WatchProps {
@@ -9,6 +9,7 @@ export interface Sic1WatchProps {
     variableToAddress: { [label: string]: number };
     watchedAddresses: Set<number>;
     highlightAddress?: number;
+    profile?: ProfileSummary;
 
     onSetHighlightAddress: (address?: number) => void;
 }
@@ -37,6 +38,11 @@ export class Sic1Watch extends Component<Sic1WatchProps> {
 
         const watches = [...customWatches, ...variableWatches];
 
+        const addressToProfile: { [address: number]: AddressProfile } = {};
+        for (const addressProfile of this.props.profile?.addresses ?? []) {
+            addressToProfile[addressProfile.address] = addressProfile;
+        }
+
         return <table>
             <thead><tr><th className="width100inline">Label (Address)</th><th>Value</th></tr></thead>
             <tbody>
@@ -44,6 +50,7 @@ export class Sic1Watch extends Component<Sic1WatchProps> {
                     ? <tr><td className="center" colSpan={2}>(not running)</td></tr>
                     : (watches.length > 0
                         ? watches.map(watch => <tr
+                                    title={this.props.profile ? `Reads: ${addressToProfile[watch.address]?.reads ?? 0}\nWrites: ${addressToProfile[watch.address]?.writes ?? 0}` : undefined}
                                     onMouseEnter={() => this.props.onSetHighlightAddress(watch.address)}
                                     onMouseLeave={() => this.props.onSetHighlightAddress(undefined)}
                                 >
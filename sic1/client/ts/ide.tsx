@@ -1,4 +1,4 @@
-import { Assembler, Emulator, CompilationError, Constants, Variable, Command } from "sic1asm";
+import { Assembler, Emulator, CompilationError, Constants, Variable, Command, ProfileSummary, summarizeProfile, AssembledProgram, analyzeProgram } from "sic1asm";
 import { Format, PuzzleTest, generatePuzzleTest, PuzzleTestSet } from "sic1-shared";
 import { Component, ComponentChild, ComponentChildren, JSX, createRef } from "preact";
 import { Button } from "./button";
@@ -70,10 +70,16 @@ interface Sic1IdeTransientState {
     watchedAddresses: Set<number>;
     sourceLineToBreakpointState: { [lineNumber: number]: boolean };
 
-    // Memory
-    [index: number]: number;
+    // Instructions that static analysis shows can never be executed (i.e. dead code)
+    unreachableSourceLines: { [lineNumber: number]: boolean };
+
+    // Memory (unsigned bytes; note: this array is replaced, not modified, when memory changes)
+    memory: number[];
     highlightAddress?: number;
 
+    // Execution counts, etc. (updated along with memory)
+    profile?: ProfileSummary;
+
     // For achievement tracking
     hasReadInput: boolean;
 
@@ -83,6 +89,9 @@ interface Sic1IdeTransientState {
 
 interface Sic1IdeState extends Sic1IdeTransientState {
     executing: boolean;
+
+    // Profiling slows down execution, so it's only enabled while its views (the gutter heatmap and watch counters) are shown
+    profiling: boolean;
 }
 
 export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
@@ -91,20 +100,34 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
         { label: "Run", rate: 50 },
         { label: "Turbo (4x)", rate: 200 },
         { label: "Turbo (50x)", rate: 2500 },
+        { label: "Max speed", rate: Infinity },
     ];
 
+    // At max speed, execution runs once per animation frame, for (at most) this long, so that typing, animations, etc.
+    // remain responsive
+    private static readonly maxSpeedFrameBudgetMS = 8;
+    private static readonly maxSpeedStepsPerClockCheck = 1000;
+
     private stateFlags = StateFlags.none;
     private stepRateIndex: number | undefined = undefined;
     private stepsPerInterval = 1;
     private resetRequired = false; // True if the current/last step incremented the testSetIndex, necessitating a post-step reset
     private runToken?: number;
+    private runFrameToken?: number;
+
+    // While set, state updates are accumulated here (instead of calling setState for every emulator callback); its
+    // prototype is the current state, so that functional updates see pending changes
+    private deferredState?: Partial<Sic1IdeState>;
+
     private memoryMap: number[][];
     private programBytes: number[];
+    private assembledProgram: AssembledProgram;
     private emulator: Emulator;
     private testSetIndex: number;
     private solutionCyclesExecuted?: number;
     private solutionMemoryBytesAccessed?: number;
     private lastAddress?: number;
+    private profileChanged = false; // True if execution has happened since the profile was last summarized
 
     private inputCode = createRef<HTMLTextAreaElement>();
     private gutter = createRef<Gutter>();
@@ -124,6 +147,7 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
 
         let state: Sic1IdeState = {
             executing: false,
+            profiling: false,
             ...Sic1Ide.createEmptyTransientState(props.puzzle, props.solutionName),
         };
 
@@ -148,7 +172,10 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
             variableToAddress: {},
             watchedAddresses: new Set(),
             sourceLineToBreakpointState: {},
+            unreachableSourceLines: {},
             hasReadInput: false,
+            memory: new Array(Constants.addressMax + 1).fill(0),
+            profile: undefined,
 
             // Load input from puzzle definition by default, but use saved input for sandbox mode
             customInputString,
@@ -160,11 +187,6 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
             outputFormat: customOutputFormat ? formatNameToFormat[customOutputFormat] : puzzle.outputFormat,
         };
 
-        // Initialize memory
-        for (let i = 0; i < 256; i++) {
-            state[i] = 0;
-        }
-
         return state;
     }
 
@@ -199,15 +221,25 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                 this.runToken = undefined;
             }
 
+            if (this.runFrameToken !== undefined) {
+                window.cancelAnimationFrame(this.runFrameToken);
+                this.runFrameToken = undefined;
+            }
+
             const executing = (index !== undefined);
             if (executing) {
-                const { periodMS, stepsPerPeriod } = Sic1Ide.rateToIntervalParameters(Sic1Ide.stepRates[index].rate);
-                this.stepsPerInterval = stepsPerPeriod;
-                this.runToken = window.setInterval(this.runCallback, periodMS);
+                const { rate } = Sic1Ide.stepRates[index];
+                if (rate === Infinity) {
+                    this.runFrameToken = window.requestAnimationFrame(this.runFrameCallback);
+                } else {
+                    const { periodMS, stepsPerPeriod } = Sic1Ide.rateToIntervalParameters(rate);
+                    this.stepsPerInterval = stepsPerPeriod;
+                    this.runToken = window.setInterval(this.runCallback, periodMS);
+                }
             }
 
             this.stepRateIndex = index;
-            this.setState({ executing });
+            this.updateState({ executing });
         }
     }
 
@@ -225,7 +257,7 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
             stateLabel = "Running"
         }
 
-        this.setState({ stateLabel });
+        this.updateState({ stateLabel });
 
         if (success) {
             // Show message box
@@ -247,8 +279,49 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
         }
     }
 
-    private updateMemory(address: number, value: number): void {
-        this.setState({ [address]: value });
+    private updateState(update: Partial<Sic1IdeState> | ((state: Sic1IdeState) => Partial<Sic1IdeState>)): void {
+        if (this.deferredState) {
+            Object.assign(this.deferredState, (typeof(update) === "function") ? update(this.deferredState as Sic1IdeState) : update);
+        } else {
+            this.setState(update);
+        }
+    }
+
+    /** Runs the callback, and then applies all of its state updates at once. */
+    private batchStateUpdates(callback: () => void): void {
+        this.deferredState = Object.create(this.state);
+        try {
+            callback();
+        } finally {
+            // Note: spreading only copies the pending changes (i.e. own properties, not the prototype's)
+            const update = { ...this.deferredState };
+            this.deferredState = undefined;
+            this.setState(update);
+        }
+    }
+
+    /** Copies memory changes and profiling counters from the emulator into state (once per step, timer tick, or frame,
+     * instead of on every write). */
+    private flushEmulatorState(): void {
+        const emulator = this.emulator;
+        if (emulator) {
+            const profile = emulator.getProfile();
+            if (profile && this.profileChanged) {
+                this.profileChanged = false;
+                this.updateState({ profile: summarizeProfile(this.assembledProgram, profile) });
+            }
+
+            const addresses = emulator.takeDirtyAddresses();
+            if (addresses.length > 0) {
+                this.updateState(state => {
+                    const memory = state.memory.slice();
+                    for (const address of addresses) {
+                        memory[address] = emulator.getMemory(address);
+                    }
+                    return { memory };
+                });
+            }
+        }
     }
 
     private load(): boolean {
@@ -269,12 +342,20 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                 .filter(sme => (sme && sme.command === Command.subleqInstruction))
                 .map(sme => [sme.lineNumber, false]));
 
+            const { reachable } = analyzeProgram(assembledProgram.bytes);
+            const unreachableSourceLines = Object.fromEntries(assembledProgram.sourceMap
+                .map((sme, address) => [sme, address] as const)
+                .filter(([sme, address]) => (sme && sme.command === Command.subleqInstruction && !reachable[address]))
+                .map(([sme]) => [sme.lineNumber, true]));
+
             this.setState({
                 variableToAddress: Object.fromEntries(assembledProgram.variables.map(({label, address}) => [label, address])),
                 sourceLineToBreakpointState,
+                unreachableSourceLines,
             });
 
             this.programBytes = assembledProgram.bytes.slice();
+            this.assembledProgram = assembledProgram;
             this.emulator = new Emulator(assembledProgram, {
                 readInput: () => {
                     // Get next input, or zero if past the end
@@ -290,12 +371,12 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                     const expectedOutputBytes = this.state.test.testSets[this.testSetIndex]["output"];
                     if (expectedOutputBytes) {
                         if (outputIndex < expectedOutputBytes.length) {
-                            this.setState(state => ({ actualOutputBytes: [...state.actualOutputBytes, value] }));
+                            this.updateState(state => ({ actualOutputBytes: [...state.actualOutputBytes, value] }));
     
                             if (value !== expectedOutputBytes[outputIndex]) {
                                 this.setStateFlag(StateFlags.error);
                                 const index = outputIndex;
-                                this.setState(state => {
+                                this.updateState(state => {
                                     const unexpectedOutputIndexes = {};
                                     for (let key in state.unexpectedOutputIndexes) {
                                         unexpectedOutputIndexes[key] = state.unexpectedOutputIndexes[key];
@@ -309,14 +390,10 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                             ++outputIndex;
                         }
                     } else {
-                        this.setState(state => ({ actualOutputBytes: [...state.actualOutputBytes, value] }));
+                        this.updateState(state => ({ actualOutputBytes: [...state.actualOutputBytes, value] }));
                     }
                 },
 
-                onWriteMemory: (address, value) => {
-                    this.updateMemory(address, value);
-                },
-
                 onStateUpdated: (data) => {
                     // Check for program
                     if (this.emulator && this.emulator.isEmpty()) {
@@ -345,7 +422,7 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                                 this.testSetIndex++;
                                 inputIndex = 0;
                                 outputIndex = 0;
-                                this.setState({ actualOutputBytes: [] });
+                                this.updateState({ actualOutputBytes: [] });
                                 this.resetRequired = true;
                             }
                         }
@@ -353,7 +430,7 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
 
                     // Note: Halt is treated as "still running" so that memory, etc. can be inspected
                     this.setStateFlag(StateFlags.running, data.running || data.ip > Constants.addressInstructionMax);
-                    this.setState(state => ({
+                    this.updateState(state => ({
                         cyclesExecuted: data.cyclesExecuted,
                         memoryBytesAccessed: data.memoryBytesAccessed,
                         currentSourceLine: (data.ip <= Constants.addressUserMax) ? data.sourceLineNumber : undefined,
@@ -370,6 +447,12 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                 },
             });
 
+            if (this.state.profiling) {
+                this.emulator.enableProfiling();
+                this.profileChanged = true;
+            }
+
+            this.flushEmulatorState();
             return true;
         } catch (error) {
             if (error instanceof CompilationError) {
@@ -384,6 +467,7 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
     private stepInternal() {
         if (this.emulator && !this.isDone()) {
             this.emulator.step();
+            this.profileChanged = true;
             if (!this.emulator.isRunning()) {
                 // Execution halted
                 this.setStepRateIndex(undefined);
@@ -399,17 +483,62 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
         this.setStepRateIndex(undefined);
         if (this.hasStarted()) {
             this.stepInternal();
+            this.flushEmulatorState();
         } else {
             this.load();
         }
     }
 
     private runCallback = () => {
-        for (let i = 0; (i < this.stepsPerInterval) && (this.stepRateIndex !== undefined); i++) {
-            this.stepInternal();
+        this.batchStateUpdates(() => {
+            for (let i = 0; (i < this.stepsPerInterval) && (this.stepRateIndex !== undefined); i++) {
+                this.stepInternal();
+            }
+            this.flushEmulatorState();
+        });
+    }
+
+    private runFrameCallback = () => {
+        this.runFrameToken = undefined;
+        const deadline = performance.now() + Sic1Ide.maxSpeedFrameBudgetMS;
+        this.batchStateUpdates(() => {
+            // Note: reading the clock is relatively expensive, so it's only checked periodically
+            do {
+                for (let i = 0; (i < Sic1Ide.maxSpeedStepsPerClockCheck) && (this.stepRateIndex !== undefined); i++) {
+                    this.stepInternal();
+                }
+            } while (this.stepRateIndex !== undefined && performance.now() < deadline);
+            this.flushEmulatorState();
+        });
+
+        if (this.stepRateIndex !== undefined) {
+            this.runFrameToken = window.requestAnimationFrame(this.runFrameCallback);
         }
     }
 
+    private setHighlightAddress = (highlightAddress?: number) => {
+        this.setState({ highlightAddress });
+    }
+
+    private toggleProfiling = () => {
+        const profiling = !this.state.profiling;
+        this.setState({ profiling, profile: undefined });
+        if (this.emulator) {
+            // Note: when enabled mid-run, counting starts from the current step
+            if (profiling) {
+                this.emulator.enableProfiling();
+                this.profileChanged = true;
+                this.flushEmulatorState();
+            } else {
+                this.emulator.disableProfiling();
+            }
+        }
+    }
+
+    private toggleWatch = (address: number) => {
+        this.setState((state) => ({ watchedAddresses: Shared.toggleSetValue(state.watchedAddresses, address) }));
+    }
+
     private run = () => {
         let loaded = this.hasStarted() ? true : this.load();
         if (loaded && !this.isDone()) {
@@ -851,6 +980,7 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                     >
                     {Sic1Ide.stepRates[Math.min(Sic1Ide.stepRates.length - 1, (this.stepRateIndex ?? -1) + 1)].label}
                 </Button>
+                <Button onClick={this.toggleProfiling} title="Shade lines by execution count, and count reads and writes of watched addresses">{this.state.profiling ? "Hide Profile" : "Show Profile"}</Button>
                 <Button onClick={this.menu} title="Esc or F1">Menu</Button>
                 <div className="controlFooter"></div>
             </div>
@@ -861,6 +991,8 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                     currentSourceLine={this.state.currentSourceLine}
                     sourceLines={this.state.sourceLines}
                     sourceLineToBreakpointState={this.state.sourceLineToBreakpointState}
+                    profile={this.state.profile}
+                    unreachableSourceLines={this.state.unreachableSourceLines}
                     onToggleBreakpoint={(lineNumber) => this.setState(state => ({ sourceLineToBreakpointState: { ...state.sourceLineToBreakpointState, [lineNumber]: !state.sourceLineToBreakpointState[lineNumber] } }))}
                     />
                 <textarea
@@ -897,21 +1029,22 @@ export class Sic1Ide extends Component<Sic1IdeProperties, Sic1IdeState> {
                     hasStarted={this.hasStarted()}
                     currentAddress={this.state.currentAddress}
                     memoryMap={this.memoryMap}
-                    memory={this.state}
+                    memory={this.state.memory}
                     watchedAddresses={this.state.watchedAddresses}
                     highlightAddress={this.state.highlightAddress}
-                    onSetHighlightAddress={(highlightAddress) => this.setState({ highlightAddress })}
-                    onToggleWatch={(address) => this.setState((state) => ({ watchedAddresses: Shared.toggleSetValue(state.watchedAddresses, address) }))}
+                    onSetHighlightAddress={this.setHighlightAddress}
+                    onToggleWatch={this.toggleWatch}
                     />
                 <br />
                 <Sic1Watch
                     hasStarted={this.stateFlags !== StateFlags.none}
-                    memory={this.state}
+                    memory={this.state.memory}
                     variables={this.state.variables}
                     variableToAddress={this.state.variableToAddress}
                     watchedAddresses={this.state.watchedAddresses}
                     highlightAddress={this.state.highlightAddress}
-                    onSetHighlightAddress={(highlightAddress) => this.setState({ highlightAddress })}
+                    profile={this.state.profile}
+                    onSetHighlightAddress={this.setHighlightAddress}
                     />
             </div>
         </div>;
@@ -0,0 +1,79 @@
+// Binary encoding for leaderboard data passed to and from the native host (see windows/leaderboardcodec.h for the
+// format). Blobs are passed as "binary strings" (one byte per character), so each call crosses the host object bridge
+// as a single string rather than an array with one element per value.
+
+export interface FriendLeaderboardEntry {
+    name: string;
+    score: number;
+}
+
+const utf8Decoder = new TextDecoder("utf-8");
+
+function invalid(): never {
+    throw new Error("Invalid leaderboard data");
+}
+
+export function toBinaryString(bytes: ArrayLike<number>): string {
+    let result = "";
+    const chunkSize = 4096;
+    for (let i = 0; i < bytes.length; i += chunkSize) {
+        const chunk = Array.prototype.slice.call(bytes, i, i + chunkSize) as number[];
+        if (chunk.some(byte => !Number.isInteger(byte) || byte < 0 || byte > 0xff)) {
+            invalid();
+        }
+        result += String.fromCharCode.apply(null, chunk);
+    }
+    return result;
+}
+
+export function fromBinaryString(binary: string): Uint8Array {
+    const bytes = new Uint8Array(binary.length);
+    for (let i = 0; i < binary.length; i++) {
+        const byte = binary.charCodeAt(i);
+        if (byte > 0xff) {
+            invalid();
+        }
+        bytes[i] = byte;
+    }
+    return bytes;
+}
+
+// Format: uint32 count, then for each entry: int32 score, uint16 name length (bytes), UTF-8 name (little-endian)
+export function decodeFriendLeaderboardEntries(binary: string): FriendLeaderboardEntry[] {
+    const bytes = fromBinaryString(binary);
+    const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+    let offset = 0;
+    const ensureAvailable = (size: number) => {
+        if (offset + size > bytes.length) {
+            invalid();
+        }
+    };
+
+    ensureAvailable(4);
+    const count = view.getUint32(offset, true);
+    offset += 4;
+
+    // Each entry takes at least 6 bytes, so reject impossible counts before allocating anything
+    if (count > (bytes.length - offset) / 6) {
+        invalid();
+    }
+
+    const entries: FriendLeaderboardEntry[] = [];
+    for (let i = 0; i < count; i++) {
+        ensureAvailable(6);
+        const score = view.getInt32(offset, true);
+        const nameLength = view.getUint16(offset + 4, true);
+        offset += 6;
+
+        ensureAvailable(nameLength);
+        const name = utf8Decoder.decode(bytes.subarray(offset, offset + nameLength));
+        offset += nameLength;
+
+        entries.push({ name, score });
+    }
+
+    if (offset !== bytes.length) {
+        invalid();
+    }
+    return entries;
+}
@@ -4,10 +4,10 @@ declare const chrome: { webview: { hostObjects: {
         steam: {
             UserName: string,
 
-            // Leaderboards
+            // Leaderboards (program bytes and friend entries are binary strings; see leaderboard-codec.ts)
             ResolveGetLeaderboard: (resolve: (leaderboardHandle: number) => void, reject: (status: number) => void, leaderboardName: string) => void;
-            ResolveSetLeaderboardEntry: (resolve: (updated: boolean) => void, reject: (status: number) => void, leaderboardHandle: number, score: number, program?: number[]) => void;
-            ResolveGetFriendLeaderboardEntries: (resolve: (flatArray: (string | number)[]) => void, reject: (status: number) => void, leaderboardHandle: number) => void;
+            ResolveSetLeaderboardEntry: (resolve: (updated: boolean) => void, reject: (status: number) => void, leaderboardHandle: number, score: number, program: string) => void;
+            ResolveGetFriendLeaderboardEntries: (resolve: (encodedEntries: string) => void, reject: (status: number) => void, leaderboardHandle: number) => void;
 
             // Achievements
             GetAchievement: (achievementId: string) => boolean;
@@ -24,11 +24,14 @@ declare const chrome: { webview: { hostObjects: {
             SetPresentationSetting: (fieldName: string, value: number) => void;
 
             // Data/settings persistence
-            ResolvePersistLocalStorage: (resolve: () => void, reject: (status: number) => void, data: string) => void;
+            ResolvePersistLocalStorageChanges: (resolve: () => void, reject: (status: number) => void, sequence: number, changes: string) => void; // Changes: JSON-encoded Record<string, string | null>
             ResolvePersistPresentationSettings: (resolve: () => void, reject: (status: number) => void) => void;
 
             // Manual
             OpenManual: () => void;
+
+            // Diagnostics (JSON-encoded NativeMetrics)
+            GetMetrics: () => string;
         },
     },
     options: {
@@ -59,6 +59,13 @@ class CoalescedFunction {
     }
 }
 
+/** Native (host) performance metrics; times are in microseconds. */
+export interface NativeMetrics {
+    counters: Record<string, number>;
+    gauges: Record<string, { value: number, max: number }>;
+    histograms: Record<string, { count: number, sum: number, p50: number, p90: number, p99: number, max: number }>;
+}
+
 export interface Platform {
     /** Indicates the program should have native app semantics, e.g. it should have an "exit" option in the menu. */
     readonly app: boolean;
@@ -81,8 +88,8 @@ export interface Platform {
     /** Overrides saved fullscreen value on load, if provided. */
     readonly fullscreenDefault?: boolean;
 
-    /** Persist localStorage data (only necessary in app mode) */
-    readonly scheduleLocalStoragePersist?: () => void;
+    /** Persist localStorage data (only necessary in app mode); pass the changed key, if known */
+    readonly scheduleLocalStoragePersist?: (key?: string) => void;
 
     /** Persist presentation settings (only necessary in app mode) */
     readonly schedulePresentationSettingsPersist?: () => void;
@@ -101,6 +108,9 @@ export interface Platform {
 
     /** Used for suppressing achievement notification when windowed for Steam (because Steam UI pops up a notification on the desktop). */
     readonly shouldShowAchievementNotification?: () => boolean;
+
+    /** Returns native host metrics (only available in app mode). */
+    readonly getNativeMetrics?: () => NativeMetrics;
 }
 
 const createPlatform: Record<PlatformName, () => Platform> = {
@@ -119,16 +129,17 @@ const createPlatform: Record<PlatformName, () => Platform> = {
             }
         };
 
+        // The native host keeps its own copy of localStorage (for saving to disk), so only changed keys are sent to it,
+        // along with a sequence number. If the host ever rejects an update (e.g. because it missed one), everything is
+        // sent again as a "full" update (sequence 0).
+        const hostValues = new Map<string, string>(); // Values the host is known to have
+        const changedKeys = new Set<string>();
+        let allKeysChanged = false; // I.e. any key may have changed
+        let fullUpdateNeeded = true;
+        let sequence = 0;
+
         const localStorageManager = {
-            extract: (): string => {
-                // Read all relevant keys into a big record, and then stringify it
-                const data: Record<string, string> = {};
-                forEachRelevantLocalStorageKey((key) => {
-                    data[key] = localStorage[key];
-                });
-                return JSON.stringify(data);
-            },
-            inject: (dataString: string, clear?: boolean) => {
+            inject: (dataString: string): boolean => {
                 // Clear all relevant keys and then populate from saved data
                 try {
                     if (dataString) {
@@ -140,12 +151,69 @@ const createPlatform: Record<PlatformName, () => Platform> = {
                         for (const key of keysToRemove) {
                             localStorage.removeItem(key);
                         }
-        
+
+                        hostValues.clear();
                         for (const [key, value] of Object.entries(data)) {
                             localStorage[key] = value;
+                            hostValues.set(key, value);
                         }
+
+                        // localStorage now matches what the host loaded
+                        fullUpdateNeeded = false;
+                        return true;
                     }
                 } catch {}
+                return false;
+            },
+            markChanged: (key?: string) => {
+                if (key === undefined) {
+                    allKeysChanged = true;
+                } else {
+                    changedKeys.add(key);
+                }
+            },
+            requestFullUpdate: () => {
+                fullUpdateNeeded = true;
+            },
+            extractChanges: (): { sequence: number, changes: string } | undefined => {
+                const changes: Record<string, string | null> = {};
+                let changed = false;
+                const checkKey = (key: string) => {
+                    const value = localStorage.getItem(key);
+                    if (fullUpdateNeeded || value !== (hostValues.get(key) ?? null)) {
+                        changes[key] = value;
+                        changed = true;
+                        if (value === null) {
+                            hostValues.delete(key);
+                        } else {
+                            hostValues.set(key, value);
+                        }
+                    }
+                };
+
+                if (fullUpdateNeeded) {
+                    hostValues.clear();
+                    forEachRelevantLocalStorageKey(checkKey);
+                    changed = true;
+                } else if (allKeysChanged) {
+                    // Check every key, including ones that may have been removed
+                    const keys = new Set<string>(hostValues.keys());
+                    forEachRelevantLocalStorageKey((key) => keys.add(key));
+                    keys.forEach(checkKey);
+                } else {
+                    changedKeys.forEach(checkKey);
+                }
+
+                const full = fullUpdateNeeded;
+                changedKeys.clear();
+                allKeysChanged = false;
+                fullUpdateNeeded = false;
+                if (!changed) {
+                    return undefined;
+                }
+
+                sequence = full ? 0 : sequence + 1;
+                return { sequence, changes: JSON.stringify(changes) };
             },
         };
 
@@ -181,18 +249,31 @@ const createPlatform: Record<PlatformName, () => Platform> = {
 
         const steamApiKey = `${Shared.localStoragePrefix}steamApi`;
         const persistDelayMS = 100;
+        const hresultCancelled = -2147023673; // HRESULT_FROM_WIN32(ERROR_CANCELLED), as a signed 32-bit integer
         const persistPresentationSettings = new CoalescedFunction(() => wrapNativePromise(webViewWindow.ResolvePersistPresentationSettings), persistDelayMS);
 
         let steamApi: SteamApi;
         const saveSteamApi = () => {
             if (steamApi) {
                 localStorage.setItem(steamApiKey, steamApi.serialize());
+                localStorageManager.markChanged(steamApiKey);
             }
         };
 
         const persistLocalStorage = new CoalescedFunction(() => {
             saveSteamApi();
-            wrapNativePromise(webViewWindow.ResolvePersistLocalStorage, localStorageManager.extract());
+            const update = localStorageManager.extractChanges();
+            if (update) {
+                // Note: if the host rejects the update, everything is resent right away (so the save file doesn't stay stale),
+                // unless the host is shutting down (in which case the final changes are sent by the OnClosing callback)
+                wrapNativePromise(webViewWindow.ResolvePersistLocalStorageChanges, update.sequence, update.changes)
+                    .catch((status: number) => {
+                        localStorageManager.requestFullUpdate();
+                        if (status !== hresultCancelled) {
+                            persistLocalStorage.runAsync();
+                        }
+                    });
+            }
         }, persistDelayMS);
 
         const persistAchievementsDelayMS = 250;
@@ -211,7 +292,10 @@ const createPlatform: Record<PlatformName, () => Platform> = {
             },
             presentationSettings,
             userNameOverride: (userName && userName.length > 0) ? userName : undefined,
-            scheduleLocalStoragePersist: () => persistLocalStorage.runAsync(),
+            scheduleLocalStoragePersist: (key?: string) => {
+                localStorageManager.markChanged(key);
+                persistLocalStorage.runAsync();
+            },
             schedulePresentationSettingsPersist: () => persistPresentationSettings.runAsync(),
             getAchievementAsync: async (id: Achievement) => { return steam.GetAchievement(id); },
             setAchievementAsync: async (id: Achievement) => {
@@ -223,6 +307,7 @@ const createPlatform: Record<PlatformName, () => Platform> = {
                 return false;
             },
             shouldShowAchievementNotification: () => webViewWindow.Fullscreen, // Only show when in fullscreen
+            getNativeMetrics: () => JSON.parse(webViewWindow.GetMetrics()),
         };
 
         // On exit, provide updated localStorage data for export
@@ -233,9 +318,22 @@ const createPlatform: Record<PlatformName, () => Platform> = {
                 platform.onClosing();
             }
 
-            // Save localStorage; it will be persisted via native code during shutdown 
+            // Send any remaining localStorage changes; they will be persisted via native code during shutdown
+            // Note: host calls are synchronous here (so a rejected update can be retried as a full update immediately)
             saveSteamApi();
-            webViewWindow.LocalStorageDataString = localStorageManager.extract();
+            for (let attempt = 0; attempt < 2; attempt++) {
+                const update = localStorageManager.extractChanges();
+                if (!update) {
+                    break;
+                }
+
+                try {
+                    webViewWindow.ResolvePersistLocalStorageChanges(() => {}, () => {}, update.sequence, update.changes);
+                    break;
+                } catch {
+                    localStorageManager.requestFullUpdate();
+                }
+            }
         };
 
         return platform;
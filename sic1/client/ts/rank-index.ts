@@ -0,0 +1,187 @@
+import * as Contract from "sic1-server-contract";
+
+// Counts of scores, supporting rank queries (e.g. "how many scores are below X?") and incremental insertion in
+// O(log n), where n is the number of distinct scores. This is a Fenwick tree (binary indexed tree) over the sorted list
+// of distinct scores. Inserting a score that hasn't been seen before requires rebuilding the tree (O(n)), but that's
+// rare once an index is populated.
+//
+// Indexes are serialized as (sorted) histogram data, i.e. the same format used by the server and stats caches.
+
+function lowerBound(values: number[], value: number): number {
+    let low = 0;
+    let high = values.length;
+    while (low < high) {
+        const middle = (low + high) >>> 1;
+        if (values[middle] < value) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+export class RankIndex {
+    private values: number[] = []; // Distinct scores, in ascending order
+    private counts: number[] = []; // Count for each score (parallel to values)
+    private tree: number[] = [];   // Fenwick tree over counts (1-based)
+    private total = 0;
+
+    public static fromHistogramData(...histograms: (Contract.HistogramData | undefined)[]): RankIndex {
+        // Merge everything first, so the tree is only built once
+        const merged = new Map<number, number>();
+        for (const histogram of histograms) {
+            for (const { bucketMax, count } of histogram ?? []) {
+                merged.set(bucketMax, (merged.get(bucketMax) ?? 0) + count);
+            }
+        }
+
+        const index = new RankIndex();
+        index.values = Array.from(merged.keys()).sort((a, b) => a - b);
+        index.counts = index.values.map(value => merged.get(value));
+        index.rebuild();
+        return index;
+    }
+
+    public clone(): RankIndex {
+        const index = new RankIndex();
+        index.values = this.values.slice();
+        index.counts = this.counts.slice();
+        index.tree = this.tree.slice();
+        index.total = this.total;
+        return index;
+    }
+
+    public add(value: number, count = 1): void {
+        const position = lowerBound(this.values, value);
+        if (this.values[position] !== value) {
+            this.values.splice(position, 0, value);
+            this.counts.splice(position, 0, count);
+            this.rebuild();
+        } else {
+            this.counts[position] += count;
+            this.total += count;
+            for (let i = position + 1; i <= this.values.length; i += (i & -i)) {
+                this.tree[i] += count;
+            }
+        }
+    }
+
+    /** Adds a batch of scores (e.g. live data on top of a cached index), rebuilding the tree at most once, i.e. in
+     * O(n + k log n) for k scores, instead of O(n) for each previously unseen score */
+    public addHistogramData(data: Contract.HistogramData | undefined): void {
+        if (!data || data.length === 0) {
+            return;
+        }
+
+        const added = new Map<number, number>();
+        for (const { bucketMax, count } of data) {
+            const position = lowerBound(this.values, bucketMax);
+            if (this.values[position] === bucketMax) {
+                this.counts[position] += count;
+            } else {
+                added.set(bucketMax, (added.get(bucketMax) ?? 0) + count);
+            }
+        }
+
+        if (added.size > 0) {
+            // Merge the new scores into the (sorted) list of distinct scores
+            const addedValues = Array.from(added.keys()).sort((a, b) => a - b);
+            const values: number[] = [];
+            const counts: number[] = [];
+            let position = 0;
+            for (const value of addedValues) {
+                while (position < this.values.length && this.values[position] < value) {
+                    values.push(this.values[position]);
+                    counts.push(this.counts[position]);
+                    position++;
+                }
+
+                values.push(value);
+                counts.push(added.get(value));
+            }
+
+            this.values = values.concat(this.values.slice(position));
+            this.counts = counts.concat(this.counts.slice(position));
+        }
+
+        this.rebuild();
+    }
+
+    public getTotal(): number {
+        return this.total;
+    }
+
+    /** Returns the number of scores strictly less than the given value */
+    public countBelow(value: number): number {
+        return this.prefixSum(lowerBound(this.values, value));
+    }
+
+    /** Returns the number of scores strictly greater than the given value */
+    public countAbove(value: number): number {
+        return this.total - this.prefixSum(lowerBound(this.values, value + 1));
+    }
+
+    /** Returns the smallest score with at least the given (1-based) rank, i.e. the score at that position if all scores
+     * were sorted in ascending order; returns undefined if the rank is out of range */
+    public select(rank: number): number | undefined {
+        if (rank < 1 || rank > this.total) {
+            return undefined;
+        }
+
+        // Descend the tree, finding the last position whose prefix sum is below the rank
+        let position = 0;
+        let remaining = rank;
+        for (let step = 1 << Math.floor(Math.log2(this.values.length)); step > 0; step >>= 1) {
+            const next = position + step;
+            if (next <= this.values.length && this.tree[next] < remaining) {
+                position = next;
+                remaining -= this.tree[next];
+            }
+        }
+        return this.values[position];
+    }
+
+    /** Returns the percentage (0 - 100) of other scores that the given score (which is assumed to be included in the
+     * index) beats, where lower scores are better unless higherIsBetter is set */
+    public getPercentBeaten(value: number, higherIsBetter = false): number {
+        const others = this.total - 1;
+        if (others <= 0) {
+            return 100;
+        }
+
+        const beaten = higherIsBetter ? this.countBelow(value) : this.countAbove(value);
+        return Math.max(0, Math.min(100, 100 * beaten / others));
+    }
+
+    /** Serializes to histogram data, sorted by score */
+    public toHistogramData(): Contract.HistogramData {
+        return this.values.map((bucketMax, i) => ({ bucketMax, count: this.counts[i] }));
+    }
+
+    private prefixSum(length: number): number {
+        let sum = 0;
+        for (let i = length; i > 0; i -= (i & -i)) {
+            sum += this.tree[i];
+        }
+        return sum;
+    }
+
+    private rebuild(): void {
+        // Linear-time construction: add each node's sum to its parent
+        const length = this.values.length;
+        const tree = new Array<number>(length + 1).fill(0);
+        let total = 0;
+        for (let i = 1; i <= length; i++) {
+            tree[i] += this.counts[i - 1];
+            total += this.counts[i - 1];
+            const parent = i + (i & -i);
+            if (parent <= length) {
+                tree[parent] += tree[i];
+            }
+        }
+
+        this.tree = tree;
+        this.total = total;
+    }
+}
@@ -1,6 +1,7 @@
 import * as Contract from "sic1-server-contract";
 import { Shared } from "./shared";
 import { ChartData, HistogramBucketDetail, HistogramBucketWithDetails, HistogramDetail } from "./chart-model";
+import { RankIndex } from "./rank-index";
 import { steamStatsCache, webStatsCache } from "./stats-cache";
 import { FriendLeaderboardEntry, SteamApi } from "./steam-api";
 
@@ -71,32 +72,17 @@ function calculateBounds(min: number, max: number, bucketCount: number): Histogr
     }
 }
 
-export function sortAndNormalizeHistogramData(data: Contract.HistogramData, bucketCount: number, highlightedValue?: number, removeOutliers = false): HistogramDetail {
+export function sortAndNormalizeHistogramData(data: Contract.HistogramData, bucketCount: number, highlightedValue?: number, removeOutliers = false, index?: RankIndex): HistogramDetail {
     let outliers: HistogramBucketDetail[] | undefined = undefined;
 
     if (removeOutliers) {
         // Remove upper-end outliers, if necessary
-        const dataCount = data.reduce((count, bucket) => (count + bucket.count), 0);
+        index = index ?? RankIndex.fromHistogramData(data);
+        const dataCount = index.getTotal();
         if (dataCount > 4) {
-            // First, sort
-            data = data.slice().sort((a, b) => (a.bucketMax - b.bucketMax));
-
             // Find inter-quartile range
-            const firstQuarterIndex = Math.ceil(dataCount * 1 / 4);
-            const thirdQuarterIndex = Math.ceil(dataCount * 3 / 4);
-            let firstQuarter: number | undefined = undefined;
-            let thirdQuarter: number | undefined = undefined;
-            let i = 0;
-            for (const { bucketMax, count } of data) {
-                i += count;
-                if (firstQuarter === undefined && i >= firstQuarterIndex) {
-                    firstQuarter = bucketMax;
-                }
-                if (thirdQuarter === undefined && i >= thirdQuarterIndex) {
-                    thirdQuarter = bucketMax;
-                    break;
-                }
-            }
+            const firstQuarter = index.select(Math.ceil(dataCount * 1 / 4));
+            const thirdQuarter = index.select(Math.ceil(dataCount * 3 / 4));
 
             // Consider anything more than 3 * IQR above 75th percentile an outlier
             const k = 3;
@@ -104,6 +90,7 @@ export function sortAndNormalizeHistogramData(data: Contract.HistogramData, buck
 
             // Clamp to highlighted value, if provided
             const max = (highlightedValue === undefined) ? cutoff : Math.max(highlightedValue, cutoff);
+            data = index.toHistogramData();
             const firstOutlierIndex = data.findIndex(({ bucketMax }) => (bucketMax > max));
             if (firstOutlierIndex >= 0) {
                 outliers = data.slice(firstOutlierIndex).map(({ bucketMax, count }) => ({ value: bucketMax, count }));
@@ -169,41 +156,73 @@ export function sortAndNormalizeHistogramData(data: Contract.HistogramData, buck
     };
 }
 
-function enrichAndAggregatePuzzleStats(data: Contract.PuzzleStatsResponse[], cycles: number, bytes: number): { cycles: ChartData, bytes: ChartData } {
-    // Merge and normalize data
-    const cyclesHistogram = sortAndNormalizeHistogramData([].concat(
-        [{ bucketMax: cycles, count: 1 }],
-        ...data.map(d => d.cyclesExecutedBySolution),
-    ), puzzleBucketCount, cycles, true);
+interface PuzzleRankIndexes {
+    cycles: RankIndex;
+    bytes: RankIndex;
+}
+
+// Rank indexes over the bundled stats caches (which never change) are built on first use, so that adding a new score
+// doesn't require rescanning all of the cached histograms
+const cachedPuzzleRankIndexes: { [key: string]: PuzzleRankIndexes } = {};
+const cachedUserRankIndexes: { [key: string]: RankIndex } = {};
+
+function getCachedPuzzleRankIndexes(puzzleTitle: string, includeWebStats: boolean): PuzzleRankIndexes {
+    const key = `${puzzleTitle}${includeWebStats ? "_Web" : ""}`;
+    let indexes = cachedPuzzleRankIndexes[key];
+    if (!indexes) {
+        const data = [steamStatsCache.puzzleStats[puzzleTitle]];
+        if (includeWebStats) {
+            data.push(webStatsCache.puzzleStats[puzzleTitle]);
+        }
+
+        indexes = {
+            cycles: RankIndex.fromHistogramData(...data.map(d => d?.cyclesExecutedBySolution)),
+            bytes: RankIndex.fromHistogramData(...data.map(d => d?.memoryBytesAccessedBySolution)),
+        };
+        cachedPuzzleRankIndexes[key] = indexes;
+    }
+    return indexes;
+}
+
+function getCachedUserRankIndex(includeWebStats: boolean): RankIndex {
+    const key = includeWebStats ? "Web" : "";
+    let index = cachedUserRankIndexes[key];
+    if (!index) {
+        index = RankIndex.fromHistogramData(steamStatsCache.userStats?.solutionsByUser, includeWebStats ? webStatsCache.userStats?.solutionsByUser : undefined);
+        cachedUserRankIndexes[key] = index;
+    }
+    return index;
+}
 
-    const bytesHistogram = sortAndNormalizeHistogramData([].concat(
-        [{ bucketMax: bytes, count: 1 }],
-        ...data.map(d => d.memoryBytesAccessedBySolution),
-    ), puzzleBucketCount, bytes, true);
+function createPuzzleChartData(cachedIndex: RankIndex, liveData: Contract.HistogramData | undefined, value: number): ChartData {
+    const index = cachedIndex.clone();
+    index.addHistogramData((liveData ?? []).concat([{ bucketMax: value, count: 1 }]));
 
     return {
-        cycles: {
-            histogram: cyclesHistogram,
-            highlightedValue: cycles,
-        },
-        bytes: {
-            histogram: bytesHistogram,
-            highlightedValue: bytes,
-        },
+        histogram: sortAndNormalizeHistogramData(index.toHistogramData(), puzzleBucketCount, value, true, index),
+        highlightedValue: value,
+        percentBeaten: index.getPercentBeaten(value),
     };
 }
 
-function enrichAndAggregateUserStats(data: Contract.UserStatsResponse[], solvedCount: number): ChartData {
-    const histogram = sortAndNormalizeHistogramData([].concat(
-        [{ bucketMax: solvedCount, count: 1 }],
-        ...data.map(d => d.solutionsByUser),
-    ), userBucketCount);
+function enrichAndAggregatePuzzleStats(cachedIndexes: PuzzleRankIndexes, liveData: Contract.PuzzleStatsResponse | undefined, cycles: number, bytes: number): { cycles: ChartData, bytes: ChartData } {
+    // Merge cached and live data, and add the new score
+    return {
+        cycles: createPuzzleChartData(cachedIndexes.cycles, liveData?.cyclesExecutedBySolution, cycles),
+        bytes: createPuzzleChartData(cachedIndexes.bytes, liveData?.memoryBytesAccessedBySolution, bytes),
+    };
+}
+
+function enrichAndAggregateUserStats(cachedIndex: RankIndex, liveData: Contract.UserStatsResponse | undefined, solvedCount: number): ChartData {
+    const index = cachedIndex.clone();
+    index.addHistogramData((liveData?.solutionsByUser ?? []).concat([{ bucketMax: solvedCount, count: 1 }]));
 
     // Highlight whatever solvedCount is expected locally. This is currently needed for Steam users (who
     // never upload solutions), but is arguably more user-friendly anyway.
     return {
-        histogram: histogram,
+        histogram: sortAndNormalizeHistogramData(index.toHistogramData(), userBucketCount),
         highlightedValue: solvedCount,
+        percentBeaten: index.getPercentBeaten(solvedCount, true),
     };
 }
 
@@ -277,14 +296,13 @@ export class Sic1WebService implements Sic1Service {
 
     public async getPuzzleStatsAsync(puzzleTitle: string, cycles: number, bytes: number): Promise<{ cycles: ChartData, bytes: ChartData }> {
         // Start with cached Steam stats, then use live web stats (falling back to the cache on failure), and finally add the new stats
-        const data = [steamStatsCache.puzzleStats[puzzleTitle]];
+        let liveData: Contract.PuzzleStatsResponse | undefined;
         try {
-            data.push(await this.getPuzzleStatsRawAsync(puzzleTitle));
+            liveData = await this.getPuzzleStatsRawAsync(puzzleTitle);
         } catch {
-            data.push(webStatsCache.puzzleStats[puzzleTitle]);
         }
 
-        return enrichAndAggregatePuzzleStats(data, cycles, bytes);
+        return enrichAndAggregatePuzzleStats(getCachedPuzzleRankIndexes(puzzleTitle, !liveData), liveData, cycles, bytes);
     }
 
     public async getUserStatsRawAsync(userId?: string): Promise<Contract.UserStatsResponse> {
@@ -309,13 +327,13 @@ export class Sic1WebService implements Sic1Service {
 
     public async getUserStatsAsync(userId: string, solvedCount: number): Promise<ChartData> {
         // Start with cached Steam stats, then use live web stats (falling back to the cache on failure), and finally add the new stats
-        const data = [steamStatsCache.userStats];
+        let liveData: Contract.UserStatsResponse | undefined;
         try {
-            data.push(await this.getUserStatsRawAsync(userId));
+            liveData = await this.getUserStatsRawAsync(userId);
         } catch {
-            data.push(webStatsCache.userStats);
         }
-        return enrichAndAggregateUserStats(data, solvedCount);
+
+        return enrichAndAggregateUserStats(getCachedUserRankIndex(!liveData), liveData, solvedCount);
     }
 
     public async getLeaderboardAsync(): Promise<LeaderboardEntry[]> {
@@ -394,12 +412,12 @@ export class Sic1SteamService implements Sic1Service {
 
     public getPuzzleStatsAsync(puzzleTitle: string, cycles: number, bytes: number): Promise<{ cycles: ChartData; bytes: ChartData; }> {
         // Use bundled stats cache (obviously, this won't always be up to date, but it removes any Steam dependency on the web service)
-        return Promise.resolve(enrichAndAggregatePuzzleStats([steamStatsCache.puzzleStats[puzzleTitle], webStatsCache.puzzleStats[puzzleTitle]], cycles, bytes));
+        return Promise.resolve(enrichAndAggregatePuzzleStats(getCachedPuzzleRankIndexes(puzzleTitle, true), undefined, cycles, bytes));
     }
 
     public getUserStatsAsync(userId: string, solvedCount: number): Promise<ChartData> {
         // Use bundled stats cache
-        return Promise.resolve(enrichAndAggregateUserStats([steamStatsCache.userStats, webStatsCache.userStats], solvedCount));
+        return Promise.resolve(enrichAndAggregateUserStats(getCachedUserRankIndex(true), undefined, solvedCount));
     }
 
     public updateStatsIfNeededAsync(userId: string, puzzleTitle: string, programBytes: number[], changes: StatChanges): PuzzleFriendLeaderboardPromises {
@@ -0,0 +1,189 @@
+import * as Contract from "sic1-server-contract";
+import { toBinaryString } from "./leaderboard-codec";
+
+// Compact encoding for the bundled stats caches (see stats-cache.ts, which is generated by tools/cli/build-stats-cache.ts).
+// Only the puzzle table is read at startup; each puzzle's histograms are decoded the first time they're accessed.
+//
+// Format (base64-encoded), where all numbers are unsigned LEB128 varints, except as noted:
+//
+//  * User stats: userSolvedCount, then a histogram
+//  * Puzzle count, then for each puzzle: title length (bytes), UTF-8 title, data length (bytes)
+//  * Puzzle data, in the same order as the table: cycles histogram, then bytes histogram
+//
+// Histograms are a bucket count, and then for each bucket (sorted by score): the score's difference from the previous
+// bucket's score (zig-zag encoded; the first bucket is relative to zero), and the count (zig-zag encoded).
+
+export type Sic1PuzzleStats = { [puzzleTitle: string]: Contract.PuzzleStatsResponse };
+
+export interface Sic1StatsCache {
+    userStats: Contract.UserStatsResponse;
+    puzzleStats: Sic1PuzzleStats;
+}
+
+const utf8Encoder = new TextEncoder();
+const utf8Decoder = new TextDecoder("utf-8");
+
+function invalid(): never {
+    throw new Error("Invalid stats cache");
+}
+
+function writeVarint(bytes: number[], value: number): void {
+    if (!Number.isSafeInteger(value) || value < 0) {
+        invalid();
+    }
+
+    while (value >= 0x80) {
+        bytes.push((value % 0x80) | 0x80);
+        value = Math.floor(value / 0x80);
+    }
+    bytes.push(value);
+}
+
+function writeSignedVarint(bytes: number[], value: number): void {
+    writeVarint(bytes, (value < 0) ? (-2 * value - 1) : (2 * value));
+}
+
+function writeHistogram(bytes: number[], data: Contract.HistogramData | undefined): void {
+    const sorted = (data ?? []).slice().sort((a, b) => (a.bucketMax - b.bucketMax));
+    writeVarint(bytes, sorted.length);
+    let previous = 0;
+    for (const { bucketMax, count } of sorted) {
+        writeSignedVarint(bytes, bucketMax - previous);
+        writeSignedVarint(bytes, count);
+        previous = bucketMax;
+    }
+}
+
+export function encodeStatsCache(cache: Sic1StatsCache): string {
+    const bytes: number[] = [];
+    writeVarint(bytes, cache.userStats.userSolvedCount ?? 0);
+    writeHistogram(bytes, cache.userStats.solutionsByUser);
+
+    const titles = Object.keys(cache.puzzleStats);
+    const blocks = titles.map(title => {
+        const block: number[] = [];
+        writeHistogram(block, cache.puzzleStats[title].cyclesExecutedBySolution);
+        writeHistogram(block, cache.puzzleStats[title].memoryBytesAccessedBySolution);
+        return block;
+    });
+
+    writeVarint(bytes, titles.length);
+    for (let i = 0; i < titles.length; i++) {
+        const titleBytes = utf8Encoder.encode(titles[i]);
+        writeVarint(bytes, titleBytes.length);
+        bytes.push(...titleBytes);
+        writeVarint(bytes, blocks[i].length);
+    }
+
+    for (const block of blocks) {
+        bytes.push(...block);
+    }
+
+    return btoa(toBinaryString(bytes));
+}
+
+/** Reads directly from a binary string (one byte per character), to avoid copying the whole cache */
+class Reader {
+    constructor(private binary: string, public offset = 0, private end = binary.length) {
+    }
+
+    public readVarint(): number {
+        let value = 0;
+        let scale = 1;
+        while (true) {
+            if (this.offset >= this.end || scale > Number.MAX_SAFE_INTEGER) {
+                invalid();
+            }
+
+            const byte = this.binary.charCodeAt(this.offset++);
+            value += (byte & 0x7f) * scale;
+            if ((byte & 0x80) === 0) {
+                return value;
+            }
+            scale *= 0x80;
+        }
+    }
+
+    public readSignedVarint(): number {
+        const value = this.readVarint();
+        return (value % 2) ? -(value + 1) / 2 : value / 2;
+    }
+
+    public readString(length: number): string {
+        if (this.offset + length > this.end) {
+            invalid();
+        }
+
+        const bytes = new Uint8Array(length);
+        for (let i = 0; i < length; i++) {
+            bytes[i] = this.binary.charCodeAt(this.offset++);
+        }
+        return utf8Decoder.decode(bytes);
+    }
+
+    public readHistogram(): Contract.HistogramData {
+        const length = this.readVarint();
+
+        // Each bucket takes at least 2 bytes, so reject impossible lengths before allocating anything
+        if (length > (this.end - this.offset) / 2) {
+            invalid();
+        }
+
+        const data: Contract.HistogramData = [];
+        let bucketMax = 0;
+        for (let i = 0; i < length; i++) {
+            bucketMax += this.readSignedVarint();
+            data.push({ bucketMax, count: this.readSignedVarint() });
+        }
+        return data;
+    }
+}
+
+export function decodeStatsCache(encoded: string): Sic1StatsCache {
+    const binary = atob(encoded);
+    const reader = new Reader(binary);
+    const userSolvedCount = reader.readVarint();
+    const userStats: Contract.UserStatsResponse = {
+        solutionsByUser: reader.readHistogram(),
+        userSolvedCount,
+    };
+
+    const puzzleCount = reader.readVarint();
+    const table: { title: string, length: number }[] = [];
+    for (let i = 0; i < puzzleCount; i++) {
+        const title = reader.readString(reader.readVarint());
+        table.push({ title, length: reader.readVarint() });
+    }
+
+    // Puzzle data is only decoded on first access (after which the property is replaced by the decoded value)
+    const puzzleStats: Sic1PuzzleStats = {};
+    let offset = reader.offset;
+    for (const { title, length } of table) {
+        const start = offset;
+        offset += length;
+        Object.defineProperty(puzzleStats, title, {
+            enumerable: true,
+            configurable: true,
+            get: () => {
+                const blockReader = new Reader(binary, start, start + length);
+                const value: Contract.PuzzleStatsResponse = {
+                    cyclesExecutedBySolution: blockReader.readHistogram(),
+                    memoryBytesAccessedBySolution: blockReader.readHistogram(),
+                };
+
+                if (blockReader.offset !== start + length) {
+                    invalid();
+                }
+
+                Object.defineProperty(puzzleStats, title, { enumerable: true, writable: true, value });
+                return value;
+            },
+        });
+    }
+
+    if (offset !== binary.length) {
+        invalid();
+    }
+
+    return { userStats, puzzleStats };
+}
@@ -1,16 +1,12 @@
 // Stats updated 2023-01-19T00:58:06.927Z
+// Note: this file is generated by tools/cli/build-stats-cache.ts
 
-import * as Contract from "sic1-server-contract";
+import { decodeStatsCache } from "./stats-cache-codec";
 
-export type Sic1PuzzleStats = { [puzzleTitle: string]: Contract.PuzzleStatsResponse };
+export type { Sic1PuzzleStats, Sic1StatsCache } from "./stats-cache-codec";
 
-export interface Sic1StatsCache {
-    userStats: Contract.UserStatsResponse;
-    puzzleStats: Sic1PuzzleStats;
-}
+const webStatsCache = decodeStatsCache("AB4CvAoCjggCggMC1AECmgIC9AECugECHgIOAggCBAIoAqoBAj4CSgI8AgoCAgIAAgACAgICAgICAgIEAgACBAIAAgoCEh4dU3VibGVxIEluc3RydWN0aW9uIGFuZCBPdXRwdXQcGkRhdGEgRGlyZWN0aXZlIGFuZCBMb29waW5nGxBGaXJzdCBBc3Nlc3NtZW50LghBZGRpdGlvbn0LU3VidHJhY3Rpb253DVNpZ24gRnVuY3Rpb26/AQ5NdWx0aXBsaWNhdGlvbpQCCERpdmlzaW9ujAIMU2VxdWVuY2UgU3VtkAEUU2VxdWVuY2UgQ2FyZGluYWxpdHlzEk51bWJlciB0byBTZXF1ZW5jZZYBE1NlbGYtTW9kaWZ5aW5nIENvZGUUDFN0YWNrIE1lbW9yeSoQUmV2ZXJzZSBTZXF1ZW5jZesCCkludGVybGVhdmWEAxJJbmRpY2F0b3IgRnVuY3Rpb274AQRTb3J0gwEETW9kZVoKQ2hhcmFjdGVycwoORGVjaW1hbCBEaWdpdHMOCVVwcGVyY2FzZToHU3RyaW5ncxYJVG9rZW5pemVyOQ1QYXJzZSBEZWNpbWFsaQ1QcmludCBEZWNpbWFsTQpDYWxjdWxhdG9yUBJNdWx0aS1MaW5lIFN0cmluZ3MxFVBhcnNlIERhdGEgRGlyZWN0aXZlc2cZUGFyc2UgU3VibGVxIEluc3RydWN0aW9uc1AMU2VsZi1Ib3N0aW5nagUCiEECDAIEAgQCBAcIFAL0QAYMAgACBAYEDAQEBuYHAgIC8CQYBAYKhgYGFgLkJATYAQIAFgQIDDgCAALcFQIAAuQEAsABAggCDAsWpgECrhQECAJSAsYFAgQEFAYCAjYEAAQIHR4MBgIC7hECBAaUAQIeBgQCEAYABAACBAZAAgAGOAIIBBAEQAIwAgACCAIgAhQEAAIQBAAGAgICGgQiAB4cggEC7BAEBgIQAqABBAQCEAIABgYCAAIAAkAGDAJIAgACNAI8AgQCAAIYAiwCAAIACAICAgQCAgQEChACCAAbKAgCAg6ADgI8AgQEhgECAAIUBAQCegJ+AgQEDgImBAACAAIUBAQEBAgEAhACCAIYBAgECAQEAhQdJAQEHgJKAtINAgACBAISAooBAgACggECegIEAgYCIAIOBAQCFAIABAQCBAIYAggCEAIEAggCCAIUMggGAi4kBAoKAvQDAiIC7AICngEC/gECIAI4AkoCJgIuAgQCJgIeAhYCIAIaAgACFgIOAgwCEgIIAgwCBAIIAhACAAIAAggCCAQEAgQCBAQEAgwGAAIIAgQCBAgEGAQOBAQEBAAsKgYCFgI6AmACEAIeAuIBAkwChAECogMCmAECDgKeAQJGAgoCTgJUAhgCLgIyAgwCCAISAggCBAIaAgQCAAIMAgQCCgIIAgQCAAIABgQCBAgEAgQCBAQABAICAgQEVkgEGgYCBAIAAgQCAgIEAgICAAIGAgoCCAIaAhICBAIUAi4CFAIYAggCIgIKAhICDgIEAg4CWAIWAjQCIgJEAiQCMgI0AhgCGgIIAjICGgI0Ah4CEAIWAhYCGAIWAgwCMgIyAhYCFAIQAhQCIAIIAgQCCgImAgQCCAICAggCCAIOBAgCDAQEAgACAAIEBggCBAQIAgQEBBAADgACBAQEEAAEAEQEEgAMBCQEsAIAMkIKBAgCWAJKBDoCdgIiAjwCVAJKAjYCjgECcgIkAjQCZgJCAgwCGAIcAhgCHAIIAgYCEAISAgwCFAIMAgQCBgICAgACBAIAAgQCAAIEAgQEBAIAAgICAAIACAgCABQACgQgBGIES5gBBARQAmACCAIQAgwCDAIEAjICcAJIAhQCKAIcAgACAgIMAggCBAIAAiQCCAQIAhgCJAIMAgQCBAQYBA4CBgIEAgQCCgIGAhACCAIMAg4CCAIQAgQCBAIUBAACBAIQBAgCCAIAAg4CBAgIBgQCBAYECAAEBAgEHgQGAAYEBAQIBAQECgQ6BDoECAQGCAQEBgQoBEQIpAoEOE4EBAQCOgJiBBgCeAKoAQIEAiQCJgIMAgoCDgIEAgQCCAIIAggCDAIEAgICGAIOAhYCEgIEAg4CBAIGAigCEgIKAgwCGAIEBAwCDAIKAhwCDAQEAhgCBAIIBgQCCAIECAQCBAQIAgQIBAIEFAwaBJoBBCxyAiAACgIKAgTkAgIUAgwCKgImAggCrgECKAIoAgQCFgIWAhAEDgIQAggCCAIKAgACCAIAAg4ECAIOAgYEBAIKAgQCCAQEAgACBAIABAYEAAYEAgYEBAQMEgQZLAICAgISAhwCtgMCAAIEAmQCMgIAAqoBAhwCAAImAiQCCAIIAg4CBAQIAgACBAQAAgQGDB80BAIMEAAQCggABBQCNAIaBggC5AICBAIIAi4CMgIEArwBAgwCNAQEAgwCDgQEBBIEBAIYAgQGCBAEBgQQBBQEGB4EAgACDAQABAAEBAIoAhYCFgKgBAIEAgACVAIeAgQCegIYBBACBAIEAgQCBAYICgQvYB4CCAIAEk4CcgIEAgQEAgIMAgQEAgIWAhACBgJEAhgEBgIEApwBAkwCGAQEAgYCFAIMBAgCAAQKAiAIDAIYAigEBAQQAhQCBAYAAggCBAIMBgQCBAIICAQEBAoAGAQaIgICCAJUAjgCDAIOArgBAhACJgJKAlACMAI6Ak4CLgIEAh4CLAIIAggCCAYIAgQIBAQEBAQDGBAsAhiKBwUeigcQAioGAggIAgYGQgIAAg4CCBQEBpAGDQ4CAgQCBgIKAgACAgI4BgAIAAYEAgQEBBSQBnPmAQIEAAIAFAYCAgYCAgQCBAIAAgAGAAYEBggQBAYEBggCCAIEBgQEBAYABAQCAAQAAgQCBgYIBAAEAAQMAgoGBAIGAgAGAAIEAgQCCAIAAggEEAIIAgACAgICAgICBAQIAgACAAQEAgwCBAQEBAQCBAIEAgQCBAIEAgwCBAIEAgQEBAIEAggCAgIEAgQCBAIEAgQCCAIEAhACCAQEBBACBAIAAgAEIAgIBgACBAIEBAwCBAIEAgoCBAIEBAAEBAIEDAQCBAwEDgQEBCgEDAQIBAoEJgIGADgCBgAIBAgEEARWBPIEAOoEBEBmCAwIAgICBgIEAgQCDAIEAgYCAgIIAgACEAIGAgACDAIKAgACCAIKAggCEAIEAgACFAIWAgQCBAIKAgACDAIeAiACDAIEBAACEAIMBAQCAAIEAggCIAIEAggCEAIMAgwCEAYEAgQCCAIEAgACDAIIBAYEBAQEDAICBAgEAgAoBHTEAQYaAhoEIgAGDAIACAgIAA4CCgYKBAYEAgQCCAICAgACCAIICgACBAIAAgYCBAIEAgAKBAQAEAwGAAYABAQEBAYCAgQCAgQEHAAEAggEBAQCBAQEAgAEAAQEBAQCAgQMAgAKBAIAAgAKBAgEBAQGBAIEBAgCAAQACAQGBAIABgACBAoEAgQCAAoAAgQEBAIEBAAEBAIACggCBAQEAgQCBAYABAQGBAIEAgACAAQIFgQEBAQQAgAEBAYABAQIBAYICAQUBBAILAQIAgIEIgACAAICDAAiBAIEKABIBAIAIAAEAAIAvAEEOARMYAIGBAgGAgACBAgCAhACBAYIBgQEAgIGAgYCAAIECgQCCAQEAggECAQEAgQGBAIMAggCBAIEAhACBAIIBAQCAAIAAgQCBAIEAgQCDAIMAgQGCAIEAgQCBAQCAgQEDAQEAgACCAQEAggCBAIAAgAECAIAAgQCBAQEAgYCAAQEBgAGCAQEBAQIBAYEAgAEAAwUDAAKCAQIHAREcgggAAYAEAIMAiAAPAASBAgECgQYBBYEBAYKBAQIBggKBAQAAgQEEAQEAgQCAAIIAgAGBAICBAQMBAoEGgQOBAIEBgQCBAYAEAAKAgYEBgICAgQEAgQGBAIEAgISCAIEAgAMBAQEKAQKBBAEHgQCAAYGFgQeAmQEqAEEHgAOAAQIFgDKAQSuBAC4AQQ1cggIAgICEgAUAAIEEAYODAIEBgACAgIEBgQCBAIGBAgCBAgEBAoIAAIIAgQEAAIECAQEFAIEDAgOBAQIBgACAAYEBgQKCAYEAggCBAIEBAgCAAQCBgYcBAoEAggCBAoAAgAIBAwECAAOCCHiBgRqBDQEagQOAgQCMgQeABQEDghEBG4EBgQCBA4ANARqBDIENAQKBCgEkgEIiAEE1gEEUAQ4CHQEwgMElgMAFgDoBQRIAOw+BBuuAQQQAgICMgQkBCIEAggOCAgEBgAOBAQEBAQUAAoMBAQGAAIICgACBAgEDAgKBBAEEggOBAQIE+wEBNYDBKABBFgGJAhYBCQECgRABDgEAgCCAwTuAQSyBQiKAgLSAgTkBQSaDQiOBQQT/AEEIAQgAhIICAQOBhAECAQGBAYEAggQBAYEFAQGABIICgQgBAIEAQRYAw4IAgACUAIWWAQEBBwEAhACRAQEDEQMFggCCAQGBAwEBAwCCgQEBAIIAggSBBAwCAICBAoCAgICAgoCCgQEBAQEDAYABgAIBAYAEggOBAMcBBoKGkoHLAoCBAIAAgACRiICHAIO7AIGAgQCBAoGPAwMAAIUAggMCAIEAgA6BAgAaAQNLAQCBAQEAhYCAgIGAgACCgIKAgYCBAYEBAQeXgQEABIEBAQCBA4ABAQCAggABAAEAAQEAgQYBAQECAICBAYABAQOBAYEAgQYCAYACAAEBBoAAgIWAtIBABVgAgYMAgYECAQGBgACAgQAAgIGAAIEBAoIAAYEBgQCCBQEKgAGABYEVAASYgQKBAQAHAQKCAYABAACBCYEAgQiBAgEBAQcBAoEJgQIDK4BBBNoBA4EBgAQAgIGCgQEBAYABgQEBA4EBAQQBBIECAQCBBAEOghABBSsAgQSBAYEQAQ8BCwEMAQMBEAEBAQCBCQEBgQgAggABAgIABoCAgAUABLiAQQ+BAICFgQEAgIECggEBAgAFgAGCAQEAgQaBAQABgQgBAIEC+gBDAIEAgQCBCoEBAwCCAIEAggaABIEDCwEAggEBgIMAgQCAgIAAggCCAIEAgQCBBimAQQWBEoEDAQMBBYELAQYBAQEBgIKBA4IAgAOAgIABAQKAAQAAgAEAAoAGAACAOYBABm0AQQSBBAEDgQMBBgIBgICBAIEAgAGAAIEBAAWBAIACAACAAQABgAEBAIABAQCAggAAgAS6gIEUATAAQQqCC4EXAQgBDgCGgIqABwEJASGAQQEAMoCAI4EBNQCAIoQBBGSAQQMBAgEFgQSBAoEEAQECA4EAgIMAAICCAAIAAIEIAQaBBrsBgROAB4EwAIEOgQ2BJgCCAwCDgA+AgYAJAACABgASAIsAAgAIAAEAj4EFgAWAAgEFgCmAQSoBggX1AIEEAIEBAIEBgAGBAYCBgAEBAICAgAKCAQABAoMAAYAAgACBAIADAQOABgAAgQ=");
 
-const webStatsCache: Sic1StatsCache = {"userStats":{"solutionsByUser":[{"bucketMax":9,"count":7},{"bucketMax":17,"count":5},{"bucketMax":13,"count":85},{"bucketMax":12,"count":20},{"bucketMax":1,"count":670},{"bucketMax":18,"count":1},{"bucketMax":23,"count":1},{"bucketMax":6,"count":122},{"bucketMax":24,"count":1},{"bucketMax":27,"count":2},{"bucketMax":16,"count":30},{"bucketMax":21,"count":1},{"bucketMax":15,"count":37},{"bucketMax":11,"count":2},{"bucketMax":25,"count":2},{"bucketMax":22,"count":1},{"bucketMax":20,"count":0},{"bucketMax":26,"count":0},{"bucketMax":3,"count":193},{"bucketMax":2,"count":519},{"bucketMax":28,"count":0},{"bucketMax":30,"count":9},{"bucketMax":14,"count":31},{"bucketMax":7,"count":93},{"bucketMax":29,"count":5},{"bucketMax":4,"count":106},{"bucketMax":5,"count":141},{"bucketMax":10,"count":4},{"bucketMax":8,"count":15},{"bucketMax":19,"count":0}],"userSolvedCount":0},"puzzleStats":{"Subleq Instruction and Output":{"cyclesExecutedBySolution":[{"bucketMax":5,"count":2},{"bucketMax":2,"count":6},{"bucketMax":3,"count":2},{"bucketMax":4,"count":2},{"bucketMax":1,"count":4164}],"memoryBytesAccessedBySolution":[{"bucketMax":5,"count":4154},{"bucketMax":8,"count":6},{"bucketMax":4,"count":10},{"bucketMax":13,"count":2},{"bucketMax":10,"count":2},{"bucketMax":9,"count":0},{"bucketMax":19,"count":2}]},"Data Directive and Looping":{"cyclesExecutedBySolution":[{"bucketMax":3,"count":499},{"bucketMax":17,"count":2},{"bucketMax":5,"count":2360},{"bucketMax":4,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":12,"count":0},{"bucketMax":11,"count":108},{"bucketMax":8,"count":11},{"bucketMax":23,"count":2},{"bucketMax":9,"count":2354},{"bucketMax":5,"count":387}]},"First Assessment":{"cyclesExecutedBySolution":[{"bucketMax":12,"count":4},{"bucketMax":8,"count":1390},{"bucketMax":11,"count":96},{"bucketMax":9,"count":0},{"bucketMax":10,"count":306},{"bucketMax":6,"count":28},{"bucketMax":13,"count":6},{"bucketMax":7,"count":0}],"memoryBytesAccessedBySolution":[{"bucketMax":16,"count":355},{"bucketMax":27,"count":4},{"bucketMax":14,"count":4},{"bucketMax":12,"count":1303},{"bucketMax":19,"count":10},{"bucketMax":17,"count":2},{"bucketMax":22,"count":1},{"bucketMax":23,"count":27},{"bucketMax":11,"count":83},{"bucketMax":25,"count":0},{"bucketMax":15,"count":41}]},"Addition":{"cyclesExecutedBySolution":[{"bucketMax":49,"count":4},{"bucketMax":56,"count":0},{"bucketMax":41,"count":28},{"bucketMax":46,"count":32},{"bucketMax":54,"count":8},{"bucketMax":73,"count":2},{"bucketMax":34,"count":2},{"bucketMax":19,"count":1143},{"bucketMax":33,"count":0},{"bucketMax":59,"count":1},{"bucketMax":20,"count":2},{"bucketMax":47,"count":24},{"bucketMax":15,"count":6},{"bucketMax":18,"count":1},{"bucketMax":38,"count":0},{"bucketMax":51,"count":10},{"bucketMax":60,"count":1},{"bucketMax":42,"count":4},{"bucketMax":48,"count":0},{"bucketMax":50,"count":16},{"bucketMax":44,"count":8},{"bucketMax":37,"count":32},{"bucketMax":23,"count":74},{"bucketMax":27,"count":2},{"bucketMax":28,"count":8},{"bucketMax":24,"count":15},{"bucketMax":90,"count":0},{"bucketMax":31,"count":0},{"bucketMax":53,"count":0}],"memoryBytesAccessedBySolution":[{"bucketMax":36,"count":30},{"bucketMax":50,"count":2},{"bucketMax":17,"count":3},{"bucketMax":14,"count":65},{"bucketMax":46,"count":1},{"bucketMax":28,"count":0},{"bucketMax":19,"count":80},{"bucketMax":40,"count":22},{"bucketMax":41,"count":0},{"bucketMax":35,"count":26},{"bucketMax":18,"count":8},{"bucketMax":37,"count":2},{"bucketMax":32,"count":6},{"bucketMax":29,"count":32},{"bucketMax":33,"count":36},{"bucketMax":52,"count":5},{"bucketMax":42,"count":0},{"bucketMax":38,"count":0},{"bucketMax":22,"count":8},{"bucketMax":15,"count":1078},{"bucketMax":60,"count":1},{"bucketMax":49,"count":1},{"bucketMax":21,"count":2},{"bucketMax":23,"count":0},{"bucketMax":39,"count":12},{"bucketMax":34,"count":0},{"bucketMax":26,"count":3},{"bucketMax":47,"count":1},{"bucketMax":64,"count":0},{"bucketMax":27,"count":0}]},"Subtraction":{"cyclesExecutedBySolution":[{"bucketMax":30,"count":2},{"bucketMax":41,"count":7},{"bucketMax":54,"count":2},{"bucketMax":42,"count":19},{"bucketMax":48,"count":2},{"bucketMax":38,"count":63},{"bucketMax":20,"count":4},{"bucketMax":64,"count":10},{"bucketMax":21,"count":1},{"bucketMax":57,"count":12},{"bucketMax":61,"count":4},{"bucketMax":45,"count":0},{"bucketMax":37,"count":61},{"bucketMax":39,"count":2},{"bucketMax":50,"count":2},{"bucketMax":55,"count":8},{"bucketMax":63,"count":2},{"bucketMax":33,"count":0},{"bucketMax":56,"count":4},{"bucketMax":34,"count":10},{"bucketMax":59,"count":4},{"bucketMax":46,"count":10},{"bucketMax":36,"count":2},{"bucketMax":28,"count":896},{"bucketMax":29,"count":30},{"bucketMax":44,"count":0},{"bucketMax":32,"count":67}],"memoryBytesAccessedBySolution":[{"bucketMax":31,"count":3},{"bucketMax":21,"count":37},{"bucketMax":25,"count":9},{"bucketMax":72,"count":4},{"bucketMax":41,"count":12},{"bucketMax":23,"count":0},{"bucketMax":39,"count":2},{"bucketMax":43,"count":8},{"bucketMax":47,"count":10},{"bucketMax":42,"count":4},{"bucketMax":35,"count":2},{"bucketMax":46,"count":4},{"bucketMax":75,"count":1},{"bucketMax":20,"count":15},{"bucketMax":26,"count":69},{"bucketMax":24,"count":2},{"bucketMax":27,"count":0},{"bucketMax":29,"count":61},{"bucketMax":32,"count":16},{"bucketMax":33,"count":7},{"bucketMax":40,"count":2},{"bucketMax":28,"count":65},{"bucketMax":30,"count":2},{"bucketMax":22,"count":873},{"bucketMax":45,"count":4},{"bucketMax":18,"count":2},{"bucketMax":37,"count":0},{"bucketMax":44,"count":2},{"bucketMax":36,"count":10}]},"Sign Function":{"cyclesExecutedBySolution":[{"bucketMax":27,"count":79},{"bucketMax":35,"count":19},{"bucketMax":43,"count":6},{"bucketMax":55,"count":2},{"bucketMax":18,"count":2},{"bucketMax":37,"count":11},{"bucketMax":52,"count":4},{"bucketMax":47,"count":2},{"bucketMax":57,"count":2},{"bucketMax":39,"count":13},{"bucketMax":70,"count":2},{"bucketMax":41,"count":11},{"bucketMax":93,"count":0},{"bucketMax":25,"count":17},{"bucketMax":31,"count":37},{"bucketMax":45,"count":4},{"bucketMax":65,"count":2},{"bucketMax":60,"count":6},{"bucketMax":30,"count":28},{"bucketMax":29,"count":16},{"bucketMax":63,"count":0},{"bucketMax":64,"count":4},{"bucketMax":51,"count":0},{"bucketMax":82,"count":2},{"bucketMax":46,"count":6},{"bucketMax":59,"count":2},{"bucketMax":40,"count":0},{"bucketMax":89,"count":2},{"bucketMax":53,"count":4},{"bucketMax":24,"count":250},{"bucketMax":36,"count":15},{"bucketMax":28,"count":127},{"bucketMax":32,"count":19},{"bucketMax":56,"count":2},{"bucketMax":48,"count":4},{"bucketMax":26,"count":182},{"bucketMax":42,"count":7},{"bucketMax":50,"count":0},{"bucketMax":91,"count":2},{"bucketMax":66,"count":2},{"bucketMax":33,"count":23},{"bucketMax":38,"count":16},{"bucketMax":44,"count":9},{"bucketMax":49,"count":8},{"bucketMax":34,"count":2},{"bucketMax":23,"count":5}],"memoryBytesAccessedBySolution":[{"bucketMax":40,"count":25},{"bucketMax":23,"count":29},{"bucketMax":64,"count":2},{"bucketMax":65,"count":2},{"bucketMax":35,"count":5},{"bucketMax":69,"count":1},{"bucketMax":26,"count":15},{"bucketMax":46,"count":13},{"bucketMax":53,"count":2},{"bucketMax":63,"count":2},{"bucketMax":22,"count":11},{"bucketMax":33,"count":79},{"bucketMax":25,"count":8},{"bucketMax":30,"count":209},{"bucketMax":39,"count":23},{"bucketMax":48,"count":0},{"bucketMax":36,"count":39},{"bucketMax":59,"count":2},{"bucketMax":52,"count":4},{"bucketMax":47,"count":2},{"bucketMax":21,"count":3},{"bucketMax":32,"count":7},{"bucketMax":43,"count":9},{"bucketMax":49,"count":6},{"bucketMax":67,"count":0},{"bucketMax":31,"count":76},{"bucketMax":28,"count":38},{"bucketMax":70,"count":1},{"bucketMax":42,"count":4},{"bucketMax":54,"count":0},{"bucketMax":50,"count":2},{"bucketMax":29,"count":66},{"bucketMax":51,"count":5},{"bucketMax":41,"count":6},{"bucketMax":45,"count":2},{"bucketMax":58,"count":2},{"bucketMax":24,"count":48},{"bucketMax":55,"count":0},{"bucketMax":34,"count":35},{"bucketMax":44,"count":4},{"bucketMax":27,"count":113},{"bucketMax":38,"count":12},{"bucketMax":37,"count":42},{"bucketMax":72,"count":2}]},"Multiplication":{"cyclesExecutedBySolution":[{"bucketMax":199,"count":0},{"bucketMax":92,"count":12},{"bucketMax":95,"count":25},{"bucketMax":136,"count":0},{"bucketMax":53,"count":1},{"bucketMax":57,"count":3},{"bucketMax":75,"count":11},{"bucketMax":70,"count":9},{"bucketMax":99,"count":8},{"bucketMax":73,"count":7},{"bucketMax":109,"count":4},{"bucketMax":116,"count":2},{"bucketMax":72,"count":2},{"bucketMax":146,"count":2},{"bucketMax":74,"count":44},{"bucketMax":56,"count":0},{"bucketMax":87,"count":26},{"bucketMax":108,"count":1},{"bucketMax":89,"count":8},{"bucketMax":101,"count":16},{"bucketMax":97,"count":11},{"bucketMax":79,"count":18},{"bucketMax":125,"count":4},{"bucketMax":76,"count":26},{"bucketMax":100,"count":10},{"bucketMax":143,"count":0},{"bucketMax":50,"count":2},{"bucketMax":67,"count":4},{"bucketMax":82,"count":12},{"bucketMax":117,"count":0},{"bucketMax":144,"count":2},{"bucketMax":119,"count":2},{"bucketMax":105,"count":19},{"bucketMax":96,"count":25},{"bucketMax":71,"count":7},{"bucketMax":128,"count":2},{"bucketMax":126,"count":2},{"bucketMax":107,"count":4},{"bucketMax":122,"count":4},{"bucketMax":52,"count":2},{"bucketMax":88,"count":15},{"bucketMax":54,"count":2},{"bucketMax":60,"count":13},{"bucketMax":110,"count":4},{"bucketMax":111,"count":7},{"bucketMax":49,"count":3},{"bucketMax":104,"count":5},{"bucketMax":190,"count":2},{"bucketMax":81,"count":26},{"bucketMax":65,"count":10},{"bucketMax":223,"count":2},{"bucketMax":113,"count":4},{"bucketMax":77,"count":17},{"bucketMax":69,"count":5},{"bucketMax":114,"count":6},{"bucketMax":62,"count":2},{"bucketMax":156,"count":0},{"bucketMax":93,"count":11},{"bucketMax":90,"count":11},{"bucketMax":51,"count":0},{"bucketMax":55,"count":1},{"bucketMax":103,"count":2},{"bucketMax":106,"count":2},{"bucketMax":205,"count":2},{"bucketMax":61,"count":9},{"bucketMax":118,"count":0},{"bucketMax":102,"count":4},{"bucketMax":94,"count":6},{"bucketMax":59,"count":4},{"bucketMax":66,"count":12},{"bucketMax":36,"count":2},{"bucketMax":91,"count":11},{"bucketMax":58,"count":5},{"bucketMax":63,"count":10},{"bucketMax":123,"count":2},{"bucketMax":84,"count":4},{"bucketMax":98,"count":10},{"bucketMax":80,"count":25},{"bucketMax":78,"count":34},{"bucketMax":375,"count":0},{"bucketMax":64,"count":23},{"bucketMax":68,"count":17},{"bucketMax":83,"count":13},{"bucketMax":86,"count":13},{"bucketMax":154,"count":0},{"bucketMax":85,"count":25}],"memoryBytesAccessedBySolution":[{"bucketMax":75,"count":2},{"bucketMax":56,"count":14},{"bucketMax":67,"count":0},{"bucketMax":57,"count":4},{"bucketMax":164,"count":2},{"bucketMax":61,"count":6},{"bucketMax":78,"count":0},{"bucketMax":94,"count":0},{"bucketMax":63,"count":6},{"bucketMax":59,"count":8},{"bucketMax":79,"count":0},{"bucketMax":46,"count":71},{"bucketMax":84,"count":0},{"bucketMax":50,"count":51},{"bucketMax":65,"count":3},{"bucketMax":68,"count":2},{"bucketMax":47,"count":57},{"bucketMax":49,"count":26},{"bucketMax":58,"count":3},{"bucketMax":39,"count":29},{"bucketMax":45,"count":27},{"bucketMax":52,"count":6},{"bucketMax":37,"count":37},{"bucketMax":44,"count":37},{"bucketMax":36,"count":44},{"bucketMax":60,"count":9},{"bucketMax":70,"count":2},{"bucketMax":41,"count":17},{"bucketMax":42,"count":30},{"bucketMax":77,"count":1},{"bucketMax":115,"count":2},{"bucketMax":43,"count":42},{"bucketMax":33,"count":5},{"bucketMax":71,"count":0},{"bucketMax":35,"count":4},{"bucketMax":54,"count":14},{"bucketMax":69,"count":0},{"bucketMax":40,"count":59},{"bucketMax":76,"count":0},{"bucketMax":66,"count":1},{"bucketMax":55,"count":12},{"bucketMax":51,"count":33},{"bucketMax":64,"count":2},{"bucketMax":83,"count":4},{"bucketMax":99,"count":2},{"bucketMax":72,"count":2},{"bucketMax":62,"count":10},{"bucketMax":48,"count":18},{"bucketMax":73,"count":2},{"bucketMax":53,"count":12}]},"Division":{"cyclesExecutedBySolution":[{"bucketMax":188,"count":2},{"bucketMax":253,"count":4},{"bucketMax":183,"count":2},{"bucketMax":104,"count":2},{"bucketMax":132,"count":7},{"bucketMax":122,"count":2},{"bucketMax":250,"count":2},{"bucketMax":130,"count":4},{"bucketMax":113,"count":5},{"bucketMax":102,"count":18},{"bucketMax":116,"count":4},{"bucketMax":109,"count":7},{"bucketMax":125,"count":0},{"bucketMax":148,"count":0},{"bucketMax":278,"count":2},{"bucketMax":81,"count":8},{"bucketMax":93,"count":6},{"bucketMax":312,"count":4},{"bucketMax":129,"count":4},{"bucketMax":217,"count":2},{"bucketMax":970,"count":2},{"bucketMax":137,"count":4},{"bucketMax":101,"count":12},{"bucketMax":84,"count":2},{"bucketMax":119,"count":4},{"bucketMax":181,"count":2},{"bucketMax":82,"count":6},{"bucketMax":89,"count":20},{"bucketMax":258,"count":2},{"bucketMax":98,"count":4},{"bucketMax":141,"count":2},{"bucketMax":100,"count":4},{"bucketMax":92,"count":1},{"bucketMax":118,"count":7},{"bucketMax":105,"count":2},{"bucketMax":175,"count":2},{"bucketMax":103,"count":6},{"bucketMax":123,"count":10},{"bucketMax":140,"count":2},{"bucketMax":150,"count":2},{"bucketMax":126,"count":2},{"bucketMax":79,"count":48},{"bucketMax":255,"count":2},{"bucketMax":96,"count":0},{"bucketMax":114,"count":3},{"bucketMax":107,"count":12},{"bucketMax":177,"count":2},{"bucketMax":87,"count":36},{"bucketMax":90,"count":14},{"bucketMax":86,"count":56},{"bucketMax":85,"count":25},{"bucketMax":115,"count":8},{"bucketMax":117,"count":6},{"bucketMax":110,"count":3},{"bucketMax":95,"count":2},{"bucketMax":94,"count":4},{"bucketMax":131,"count":0},{"bucketMax":97,"count":18},{"bucketMax":246,"count":2},{"bucketMax":112,"count":2},{"bucketMax":91,"count":0},{"bucketMax":169,"count":2},{"bucketMax":111,"count":2},{"bucketMax":78,"count":40},{"bucketMax":83,"count":6},{"bucketMax":127,"count":8},{"bucketMax":144,"count":2},{"bucketMax":133,"count":2},{"bucketMax":172,"count":0},{"bucketMax":88,"count":10},{"bucketMax":121,"count":2},{"bucketMax":76,"count":2},{"bucketMax":120,"count":8},{"bucketMax":80,"count":4},{"bucketMax":154,"count":2}],"memoryBytesAccessedBySolution":[{"bucketMax":71,"count":9},{"bucketMax":90,"count":4},{"bucketMax":83,"count":2},{"bucketMax":63,"count":7},{"bucketMax":54,"count":2},{"bucketMax":95,"count":2},{"bucketMax":89,"count":2},{"bucketMax":74,"count":12},{"bucketMax":59,"count":6},{"bucketMax":51,"count":6},{"bucketMax":99,"count":2},{"bucketMax":204,"count":2},{"bucketMax":72,"count":5},{"bucketMax":55,"count":2},{"bucketMax":47,"count":84},{"bucketMax":61,"count":1},{"bucketMax":60,"count":2},{"bucketMax":73,"count":6},{"bucketMax":50,"count":19},{"bucketMax":52,"count":5},{"bucketMax":68,"count":2},{"bucketMax":57,"count":4},{"bucketMax":77,"count":6},{"bucketMax":96,"count":2},{"bucketMax":78,"count":6},{"bucketMax":65,"count":9},{"bucketMax":104,"count":2},{"bucketMax":56,"count":4},{"bucketMax":64,"count":11},{"bucketMax":70,"count":20},{"bucketMax":67,"count":7},{"bucketMax":48,"count":2},{"bucketMax":53,"count":7},{"bucketMax":127,"count":2},{"bucketMax":45,"count":12},{"bucketMax":79,"count":5},{"bucketMax":114,"count":6},{"bucketMax":62,"count":12},{"bucketMax":84,"count":12},{"bucketMax":75,"count":2},{"bucketMax":86,"count":4},{"bucketMax":66,"count":2},{"bucketMax":49,"count":18},{"bucketMax":85,"count":2},{"bucketMax":69,"count":3},{"bucketMax":43,"count":49},{"bucketMax":41,"count":2},{"bucketMax":98,"count":4},{"bucketMax":80,"count":14},{"bucketMax":42,"count":29},{"bucketMax":103,"count":2},{"bucketMax":39,"count":2},{"bucketMax":46,"count":60},{"bucketMax":91,"count":2},{"bucketMax":81,"count":6},{"bucketMax":58,"count":4}]},"Sequence Sum":{"cyclesExecutedBySolution":[{"bucketMax":90,"count":4},{"bucketMax":121,"count":0},{"bucketMax":116,"count":4},{"bucketMax":104,"count":0},{"bucketMax":93,"count":20},{"bucketMax":123,"count":3},{"bucketMax":119,"count":0},{"bucketMax":86,"count":10},{"bucketMax":113,"count":2},{"bucketMax":120,"count":2},{"bucketMax":83,"count":1},{"bucketMax":97,"count":8},{"bucketMax":85,"count":178},{"bucketMax":92,"count":20},{"bucketMax":133,"count":6},{"bucketMax":99,"count":7},{"bucketMax":105,"count":4},{"bucketMax":102,"count":4},{"bucketMax":118,"count":2},{"bucketMax":111,"count":3},{"bucketMax":103,"count":5},{"bucketMax":73,"count":0},{"bucketMax":109,"count":4},{"bucketMax":87,"count":6},{"bucketMax":128,"count":2},{"bucketMax":131,"count":2},{"bucketMax":89,"count":19},{"bucketMax":110,"count":7},{"bucketMax":91,"count":87},{"bucketMax":101,"count":4},{"bucketMax":106,"count":0},{"bucketMax":78,"count":1},{"bucketMax":129,"count":3},{"bucketMax":57,"count":1},{"bucketMax":95,"count":11},{"bucketMax":96,"count":11},{"bucketMax":114,"count":5},{"bucketMax":142,"count":2},{"bucketMax":88,"count":21},{"bucketMax":125,"count":0},{"bucketMax":107,"count":7},{"bucketMax":94,"count":2},{"bucketMax":115,"count":2},{"bucketMax":100,"count":8}],"memoryBytesAccessedBySolution":[{"bucketMax":32,"count":85},{"bucketMax":40,"count":2},{"bucketMax":37,"count":4},{"bucketMax":34,"count":0},{"bucketMax":36,"count":18},{"bucketMax":29,"count":50},{"bucketMax":50,"count":6},{"bucketMax":26,"count":219},{"bucketMax":43,"count":0},{"bucketMax":24,"count":9},{"bucketMax":38,"count":4},{"bucketMax":35,"count":19},{"bucketMax":22,"count":1},{"bucketMax":30,"count":25},{"bucketMax":33,"count":14},{"bucketMax":44,"count":2},{"bucketMax":31,"count":0},{"bucketMax":42,"count":4},{"bucketMax":23,"count":1},{"bucketMax":47,"count":2},{"bucketMax":46,"count":0},{"bucketMax":39,"count":7},{"bucketMax":27,"count":0},{"bucketMax":28,"count":2},{"bucketMax":25,"count":14}]},"Sequence Cardinality":{"cyclesExecutedBySolution":[{"bucketMax":56,"count":2},{"bucketMax":50,"count":26},{"bucketMax":75,"count":2},{"bucketMax":47,"count":0},{"bucketMax":107,"count":2},{"bucketMax":62,"count":6},{"bucketMax":49,"count":10},{"bucketMax":61,"count":94},{"bucketMax":97,"count":2},{"bucketMax":54,"count":4},{"bucketMax":78,"count":4},{"bucketMax":71,"count":9},{"bucketMax":55,"count":178},{"bucketMax":74,"count":12},{"bucketMax":59,"count":25},{"bucketMax":66,"count":6},{"bucketMax":60,"count":2},{"bucketMax":57,"count":4},{"bucketMax":73,"count":2},{"bucketMax":58,"count":23},{"bucketMax":69,"count":2},{"bucketMax":89,"count":2},{"bucketMax":65,"count":2},{"bucketMax":26,"count":2},{"bucketMax":35,"count":0},{"bucketMax":67,"count":7},{"bucketMax":27,"count":6},{"bucketMax":51,"count":13},{"bucketMax":86,"count":2},{"bucketMax":63,"count":26},{"bucketMax":43,"count":5}],"memoryBytesAccessedBySolution":[{"bucketMax":17,"count":6},{"bucketMax":48,"count":2},{"bucketMax":19,"count":0},{"bucketMax":28,"count":2},{"bucketMax":43,"count":4},{"bucketMax":39,"count":2},{"bucketMax":21,"count":0},{"bucketMax":40,"count":2},{"bucketMax":30,"count":42},{"bucketMax":15,"count":2},{"bucketMax":31,"count":15},{"bucketMax":36,"count":8},{"bucketMax":25,"count":11},{"bucketMax":38,"count":2},{"bucketMax":16,"count":0},{"bucketMax":37,"count":2},{"bucketMax":24,"count":20},{"bucketMax":26,"count":11},{"bucketMax":29,"count":0},{"bucketMax":27,"count":272},{"bucketMax":33,"count":61},{"bucketMax":34,"count":12},{"bucketMax":23,"count":2},{"bucketMax":32,"count":2}]},"Number to Sequence":{"cyclesExecutedBySolution":[{"bucketMax":62,"count":2},{"bucketMax":64,"count":1},{"bucketMax":86,"count":4},{"bucketMax":83,"count":10},{"bucketMax":102,"count":2},{"bucketMax":113,"count":4},{"bucketMax":96,"count":20},{"bucketMax":59,"count":39},{"bucketMax":82,"count":3},{"bucketMax":98,"count":2},{"bucketMax":75,"count":3},{"bucketMax":117,"count":2},{"bucketMax":90,"count":16},{"bucketMax":66,"count":2},{"bucketMax":87,"count":0},{"bucketMax":48,"count":15},{"bucketMax":73,"count":12},{"bucketMax":95,"count":12},{"bucketMax":49,"count":4},{"bucketMax":136,"count":2},{"bucketMax":107,"count":2},{"bucketMax":72,"count":34},{"bucketMax":71,"count":3},{"bucketMax":60,"count":57},{"bucketMax":65,"count":6},{"bucketMax":81,"count":2},{"bucketMax":50,"count":0},{"bucketMax":100,"count":8},{"bucketMax":78,"count":38},{"bucketMax":76,"count":2},{"bucketMax":77,"count":78},{"bucketMax":89,"count":5},{"bucketMax":108,"count":6},{"bucketMax":111,"count":2},{"bucketMax":119,"count":2},{"bucketMax":105,"count":0},{"bucketMax":69,"count":11},{"bucketMax":106,"count":4},{"bucketMax":61,"count":2},{"bucketMax":94,"count":6},{"bucketMax":101,"count":10},{"bucketMax":124,"count":0},{"bucketMax":79,"count":12},{"bucketMax":112,"count":2},{"bucketMax":70,"count":8},{"bucketMax":84,"count":6},{"bucketMax":68,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":36,"count":4},{"bucketMax":33,"count":15},{"bucketMax":28,"count":24},{"bucketMax":37,"count":4},{"bucketMax":23,"count":92},{"bucketMax":49,"count":2},{"bucketMax":27,"count":40},{"bucketMax":17,"count":1},{"bucketMax":45,"count":2},{"bucketMax":22,"count":7},{"bucketMax":26,"count":37},{"bucketMax":40,"count":4},{"bucketMax":18,"count":4},{"bucketMax":21,"count":6},{"bucketMax":29,"count":29},{"bucketMax":47,"count":2},{"bucketMax":31,"count":23},{"bucketMax":25,"count":19},{"bucketMax":32,"count":2},{"bucketMax":30,"count":39},{"bucketMax":35,"count":4},{"bucketMax":19,"count":42},{"bucketMax":20,"count":28},{"bucketMax":34,"count":22},{"bucketMax":24,"count":8},{"bucketMax":41,"count":2}]},"Self-Modifying Code":{"cyclesExecutedBySolution":[{"bucketMax":12,"count":8},{"bucketMax":34,"count":1},{"bucketMax":46,"count":453}],"memoryBytesAccessedBySolution":[{"bucketMax":15,"count":453},{"bucketMax":44,"count":3},{"bucketMax":23,"count":1},{"bucketMax":45,"count":4},{"bucketMax":49,"count":1}]},"Stack Memory":{"cyclesExecutedBySolution":[{"bucketMax":3,"count":33},{"bucketMax":19,"count":392},{"bucketMax":5,"count":7},{"bucketMax":6,"count":4},{"bucketMax":16,"count":2},{"bucketMax":4,"count":0}],"memoryBytesAccessedBySolution":[{"bucketMax":26,"count":2},{"bucketMax":24,"count":2},{"bucketMax":16,"count":0},{"bucketMax":20,"count":0},{"bucketMax":9,"count":3},{"bucketMax":11,"count":0},{"bucketMax":23,"count":2},{"bucketMax":12,"count":1},{"bucketMax":7,"count":1},{"bucketMax":10,"count":5},{"bucketMax":8,"count":2},{"bucketMax":13,"count":28},{"bucketMax":36,"count":392}]},"Reverse Sequence":{"cyclesExecutedBySolution":[{"bucketMax":159,"count":4},{"bucketMax":164,"count":2},{"bucketMax":240,"count":2},{"bucketMax":263,"count":2},{"bucketMax":348,"count":1},{"bucketMax":191,"count":0},{"bucketMax":145,"count":4},{"bucketMax":189,"count":2},{"bucketMax":233,"count":1},{"bucketMax":259,"count":2},{"bucketMax":351,"count":0},{"bucketMax":160,"count":4},{"bucketMax":195,"count":2},{"bucketMax":221,"count":2},{"bucketMax":117,"count":0},{"bucketMax":128,"count":3},{"bucketMax":194,"count":0},{"bucketMax":228,"count":2},{"bucketMax":258,"count":0},{"bucketMax":186,"count":5},{"bucketMax":197,"count":4},{"bucketMax":207,"count":2},{"bucketMax":217,"count":2},{"bucketMax":248,"count":0},{"bucketMax":272,"count":2},{"bucketMax":241,"count":8},{"bucketMax":441,"count":2},{"bucketMax":269,"count":0},{"bucketMax":239,"count":4},{"bucketMax":199,"count":4},{"bucketMax":156,"count":2},{"bucketMax":379,"count":1},{"bucketMax":153,"count":2},{"bucketMax":386,"count":2},{"bucketMax":382,"count":0},{"bucketMax":176,"count":3},{"bucketMax":237,"count":2},{"bucketMax":754,"count":0},{"bucketMax":198,"count":0},{"bucketMax":320,"count":2},{"bucketMax":264,"count":2},{"bucketMax":175,"count":2},{"bucketMax":390,"count":2},{"bucketMax":223,"count":2},{"bucketMax":329,"count":2},{"bucketMax":142,"count":2},{"bucketMax":139,"count":0},{"bucketMax":260,"count":2},{"bucketMax":1063,"count":2},{"bucketMax":209,"count":4},{"bucketMax":247,"count":2},{"bucketMax":251,"count":16},{"bucketMax":203,"count":0},{"bucketMax":238,"count":2},{"bucketMax":226,"count":2},{"bucketMax":183,"count":0},{"bucketMax":185,"count":6},{"bucketMax":135,"count":0},{"bucketMax":161,"count":2},{"bucketMax":129,"count":1},{"bucketMax":292,"count":2},{"bucketMax":235,"count":2},{"bucketMax":211,"count":0},{"bucketMax":201,"count":8},{"bucketMax":210,"count":0},{"bucketMax":398,"count":2},{"bucketMax":278,"count":2},{"bucketMax":136,"count":0},{"bucketMax":224,"count":2},{"bucketMax":204,"count":1},{"bucketMax":196,"count":2},{"bucketMax":169,"count":0},{"bucketMax":190,"count":3},{"bucketMax":249,"count":0},{"bucketMax":271,"count":2},{"bucketMax":118,"count":0},{"bucketMax":134,"count":2},{"bucketMax":215,"count":2},{"bucketMax":267,"count":2},{"bucketMax":179,"count":4},{"bucketMax":262,"count":6},{"bucketMax":213,"count":2},{"bucketMax":285,"count":2},{"bucketMax":314,"count":2},{"bucketMax":132,"count":1},{"bucketMax":236,"count":2},{"bucketMax":133,"count":2},{"bucketMax":246,"count":8},{"bucketMax":279,"count":2},{"bucketMax":220,"count":2},{"bucketMax":219,"count":2},{"bucketMax":242,"count":4},{"bucketMax":232,"count":4},{"bucketMax":230,"count":2},{"bucketMax":222,"count":2},{"bucketMax":231,"count":2},{"bucketMax":244,"count":2},{"bucketMax":174,"count":0},{"bucketMax":324,"count":2},{"bucketMax":206,"count":1},{"bucketMax":166,"count":2},{"bucketMax":205,"count":1},{"bucketMax":171,"count":2},{"bucketMax":255,"count":4},{"bucketMax":234,"count":2},{"bucketMax":181,"count":0},{"bucketMax":266,"count":2},{"bucketMax":225,"count":6},{"bucketMax":294,"count":2},{"bucketMax":227,"count":2},{"bucketMax":172,"count":0},{"bucketMax":265,"count":5},{"bucketMax":202,"count":4},{"bucketMax":115,"count":1},{"bucketMax":214,"count":6}],"memoryBytesAccessedBySolution":[{"bucketMax":62,"count":6},{"bucketMax":88,"count":16},{"bucketMax":59,"count":3},{"bucketMax":103,"count":8},{"bucketMax":80,"count":10},{"bucketMax":121,"count":2},{"bucketMax":113,"count":0},{"bucketMax":71,"count":6},{"bucketMax":75,"count":5},{"bucketMax":104,"count":6},{"bucketMax":100,"count":16},{"bucketMax":117,"count":3},{"bucketMax":96,"count":2},{"bucketMax":85,"count":0},{"bucketMax":98,"count":2},{"bucketMax":133,"count":0},{"bucketMax":70,"count":0},{"bucketMax":132,"count":2},{"bucketMax":63,"count":2},{"bucketMax":68,"count":8},{"bucketMax":57,"count":4},{"bucketMax":92,"count":0},{"bucketMax":94,"count":6},{"bucketMax":79,"count":0},{"bucketMax":65,"count":1},{"bucketMax":112,"count":2},{"bucketMax":83,"count":2},{"bucketMax":105,"count":6},{"bucketMax":111,"count":4},{"bucketMax":86,"count":6},{"bucketMax":127,"count":1},{"bucketMax":106,"count":8},{"bucketMax":87,"count":15},{"bucketMax":69,"count":3},{"bucketMax":89,"count":6},{"bucketMax":115,"count":4},{"bucketMax":102,"count":4},{"bucketMax":84,"count":5},{"bucketMax":119,"count":2},{"bucketMax":90,"count":2},{"bucketMax":74,"count":4},{"bucketMax":61,"count":2},{"bucketMax":64,"count":3},{"bucketMax":60,"count":2},{"bucketMax":110,"count":2},{"bucketMax":97,"count":0},{"bucketMax":93,"count":8},{"bucketMax":109,"count":2},{"bucketMax":76,"count":4},{"bucketMax":114,"count":6},{"bucketMax":58,"count":1},{"bucketMax":82,"count":2},{"bucketMax":66,"count":4},{"bucketMax":73,"count":0},{"bucketMax":128,"count":2},{"bucketMax":72,"count":5},{"bucketMax":67,"count":0},{"bucketMax":51,"count":4},{"bucketMax":99,"count":4},{"bucketMax":101,"count":2},{"bucketMax":81,"count":11},{"bucketMax":78,"count":2},{"bucketMax":77,"count":8},{"bucketMax":153,"count":2}]},"Interleave":{"cyclesExecutedBySolution":[{"bucketMax":338,"count":0},{"bucketMax":98,"count":3},{"bucketMax":255,"count":1},{"bucketMax":312,"count":2},{"bucketMax":279,"count":2},{"bucketMax":375,"count":2},{"bucketMax":270,"count":2},{"bucketMax":371,"count":4},{"bucketMax":257,"count":6},{"bucketMax":292,"count":2},{"bucketMax":323,"count":4},{"bucketMax":145,"count":0},{"bucketMax":326,"count":2},{"bucketMax":437,"count":0},{"bucketMax":538,"count":0},{"bucketMax":242,"count":2},{"bucketMax":245,"count":2},{"bucketMax":280,"count":2},{"bucketMax":318,"count":0},{"bucketMax":463,"count":2},{"bucketMax":195,"count":2},{"bucketMax":364,"count":2},{"bucketMax":186,"count":0},{"bucketMax":415,"count":2},{"bucketMax":359,"count":2},{"bucketMax":661,"count":2},{"bucketMax":111,"count":1},{"bucketMax":176,"count":1},{"bucketMax":302,"count":2},{"bucketMax":333,"count":2},{"bucketMax":153,"count":0},{"bucketMax":539,"count":0},{"bucketMax":339,"count":0},{"bucketMax":420,"count":2},{"bucketMax":324,"count":2},{"bucketMax":263,"count":2},{"bucketMax":317,"count":2},{"bucketMax":327,"count":2},{"bucketMax":173,"count":2},{"bucketMax":184,"count":0},{"bucketMax":289,"count":2},{"bucketMax":519,"count":2},{"bucketMax":179,"count":4},{"bucketMax":250,"count":0},{"bucketMax":141,"count":0},{"bucketMax":309,"count":0},{"bucketMax":165,"count":3},{"bucketMax":315,"count":0},{"bucketMax":188,"count":2},{"bucketMax":175,"count":4},{"bucketMax":248,"count":0},{"bucketMax":187,"count":3},{"bucketMax":236,"count":0},{"bucketMax":419,"count":1},{"bucketMax":149,"count":4},{"bucketMax":445,"count":0},{"bucketMax":215,"count":2},{"bucketMax":219,"count":2},{"bucketMax":352,"count":2},{"bucketMax":393,"count":4},{"bucketMax":265,"count":0},{"bucketMax":483,"count":0},{"bucketMax":303,"count":2},{"bucketMax":439,"count":1},{"bucketMax":222,"count":2},{"bucketMax":205,"count":6},{"bucketMax":254,"count":2},{"bucketMax":213,"count":2},{"bucketMax":218,"count":1},{"bucketMax":336,"count":2},{"bucketMax":297,"count":2},{"bucketMax":170,"count":2},{"bucketMax":341,"count":4},{"bucketMax":177,"count":0},{"bucketMax":247,"count":2},{"bucketMax":211,"count":0},{"bucketMax":185,"count":2},{"bucketMax":190,"count":0},{"bucketMax":357,"count":0},{"bucketMax":362,"count":0},{"bucketMax":252,"count":2},{"bucketMax":368,"count":2},{"bucketMax":220,"count":1},{"bucketMax":536,"count":0},{"bucketMax":356,"count":8},{"bucketMax":462,"count":2},{"bucketMax":244,"count":2},{"bucketMax":633,"count":2},{"bucketMax":328,"count":2},{"bucketMax":331,"count":0},{"bucketMax":285,"count":0},{"bucketMax":160,"count":1},{"bucketMax":438,"count":0},{"bucketMax":208,"count":0},{"bucketMax":258,"count":0},{"bucketMax":144,"count":6},{"bucketMax":354,"count":2},{"bucketMax":174,"count":2},{"bucketMax":178,"count":4},{"bucketMax":274,"count":2},{"bucketMax":310,"count":2},{"bucketMax":304,"count":0},{"bucketMax":238,"count":1},{"bucketMax":283,"count":0},{"bucketMax":189,"count":2},{"bucketMax":313,"count":2},{"bucketMax":282,"count":4},{"bucketMax":276,"count":2},{"bucketMax":385,"count":2},{"bucketMax":264,"count":0},{"bucketMax":520,"count":0},{"bucketMax":296,"count":0},{"bucketMax":293,"count":0},{"bucketMax":337,"count":2},{"bucketMax":124,"count":2},{"bucketMax":197,"count":0}],"memoryBytesAccessedBySolution":[{"bucketMax":48,"count":1},{"bucketMax":159,"count":2},{"bucketMax":113,"count":4},{"bucketMax":156,"count":2},{"bucketMax":80,"count":2},{"bucketMax":86,"count":4},{"bucketMax":142,"count":2},{"bucketMax":57,"count":2},{"bucketMax":96,"count":2},{"bucketMax":74,"count":0},{"bucketMax":118,"count":1},{"bucketMax":128,"count":4},{"bucketMax":134,"count":0},{"bucketMax":98,"count":2},{"bucketMax":160,"count":0},{"bucketMax":105,"count":2},{"bucketMax":97,"count":8},{"bucketMax":114,"count":2},{"bucketMax":101,"count":2},{"bucketMax":104,"count":2},{"bucketMax":181,"count":4},{"bucketMax":115,"count":2},{"bucketMax":75,"count":2},{"bucketMax":127,"count":2},{"bucketMax":195,"count":2},{"bucketMax":110,"count":2},{"bucketMax":108,"count":6},{"bucketMax":61,"count":1},{"bucketMax":152,"count":2},{"bucketMax":99,"count":4},{"bucketMax":88,"count":2},{"bucketMax":83,"count":2},{"bucketMax":106,"count":2},{"bucketMax":138,"count":2},{"bucketMax":92,"count":2},{"bucketMax":71,"count":1},{"bucketMax":51,"count":2},{"bucketMax":55,"count":3},{"bucketMax":93,"count":6},{"bucketMax":140,"count":0},{"bucketMax":139,"count":3},{"bucketMax":162,"count":0},{"bucketMax":123,"count":2},{"bucketMax":107,"count":2},{"bucketMax":73,"count":3},{"bucketMax":103,"count":0},{"bucketMax":133,"count":4},{"bucketMax":145,"count":0},{"bucketMax":168,"count":10},{"bucketMax":109,"count":6},{"bucketMax":131,"count":0},{"bucketMax":129,"count":2},{"bucketMax":130,"count":0},{"bucketMax":56,"count":0},{"bucketMax":135,"count":2},{"bucketMax":84,"count":4},{"bucketMax":179,"count":4},{"bucketMax":81,"count":4},{"bucketMax":124,"count":0},{"bucketMax":148,"count":4},{"bucketMax":174,"count":0},{"bucketMax":95,"count":2},{"bucketMax":125,"count":4},{"bucketMax":89,"count":2},{"bucketMax":69,"count":2},{"bucketMax":63,"count":2},{"bucketMax":116,"count":2},{"bucketMax":62,"count":8},{"bucketMax":150,"count":2},{"bucketMax":119,"count":2},{"bucketMax":121,"count":6},{"bucketMax":72,"count":3},{"bucketMax":136,"count":2},{"bucketMax":66,"count":4},{"bucketMax":94,"count":4},{"bucketMax":102,"count":0}]},"Indicator Function":{"cyclesExecutedBySolution":[{"bucketMax":263,"count":1},{"bucketMax":531,"count":0},{"bucketMax":297,"count":2},{"bucketMax":278,"count":1},{"bucketMax":258,"count":0},{"bucketMax":272,"count":2},{"bucketMax":201,"count":2},{"bucketMax":205,"count":0},{"bucketMax":197,"count":2},{"bucketMax":243,"count":2},{"bucketMax":149,"count":2},{"bucketMax":136,"count":0},{"bucketMax":330,"count":2},{"bucketMax":84,"count":1},{"bucketMax":217,"count":2},{"bucketMax":345,"count":2},{"bucketMax":346,"count":0},{"bucketMax":222,"count":2},{"bucketMax":425,"count":2},{"bucketMax":276,"count":2},{"bucketMax":250,"count":0},{"bucketMax":269,"count":1},{"bucketMax":287,"count":4},{"bucketMax":645,"count":2},{"bucketMax":247,"count":2},{"bucketMax":375,"count":1},{"bucketMax":242,"count":2},{"bucketMax":186,"count":4},{"bucketMax":273,"count":2},{"bucketMax":73,"count":0},{"bucketMax":90,"count":1},{"bucketMax":270,"count":1},{"bucketMax":349,"count":3},{"bucketMax":57,"count":4},{"bucketMax":106,"count":0},{"bucketMax":246,"count":2},{"bucketMax":209,"count":1},{"bucketMax":177,"count":2},{"bucketMax":211,"count":2},{"bucketMax":524,"count":0},{"bucketMax":924,"count":0},{"bucketMax":208,"count":2},{"bucketMax":154,"count":2},{"bucketMax":203,"count":0},{"bucketMax":145,"count":2},{"bucketMax":544,"count":0},{"bucketMax":76,"count":0},{"bucketMax":179,"count":3},{"bucketMax":199,"count":8},{"bucketMax":533,"count":4},{"bucketMax":189,"count":4},{"bucketMax":360,"count":2},{"bucketMax":317,"count":2},{"bucketMax":184,"count":2},{"bucketMax":194,"count":2},{"bucketMax":266,"count":2},{"bucketMax":166,"count":2},{"bucketMax":196,"count":0},{"bucketMax":1016,"count":2},{"bucketMax":289,"count":0},{"bucketMax":295,"count":2},{"bucketMax":202,"count":2},{"bucketMax":235,"count":2},{"bucketMax":288,"count":2},{"bucketMax":322,"count":2},{"bucketMax":509,"count":2},{"bucketMax":204,"count":4},{"bucketMax":277,"count":2}],"memoryBytesAccessedBySolution":[{"bucketMax":177,"count":3},{"bucketMax":139,"count":4},{"bucketMax":121,"count":0},{"bucketMax":117,"count":5},{"bucketMax":123,"count":2},{"bucketMax":158,"count":2},{"bucketMax":125,"count":0},{"bucketMax":218,"count":0},{"bucketMax":163,"count":4},{"bucketMax":146,"count":2},{"bucketMax":225,"count":4},{"bucketMax":169,"count":2},{"bucketMax":110,"count":4},{"bucketMax":151,"count":0},{"bucketMax":174,"count":1},{"bucketMax":155,"count":2},{"bucketMax":130,"count":2},{"bucketMax":214,"count":2},{"bucketMax":171,"count":4},{"bucketMax":198,"count":2},{"bucketMax":152,"count":0},{"bucketMax":126,"count":2},{"bucketMax":167,"count":4},{"bucketMax":103,"count":2},{"bucketMax":166,"count":2},{"bucketMax":208,"count":2},{"bucketMax":107,"count":2},{"bucketMax":111,"count":2},{"bucketMax":197,"count":4},{"bucketMax":196,"count":2},{"bucketMax":133,"count":2},{"bucketMax":115,"count":2},{"bucketMax":203,"count":0},{"bucketMax":122,"count":4},{"bucketMax":81,"count":0},{"bucketMax":168,"count":2},{"bucketMax":191,"count":2},{"bucketMax":90,"count":3},{"bucketMax":106,"count":2},{"bucketMax":132,"count":10},{"bucketMax":57,"count":4},{"bucketMax":97,"count":6},{"bucketMax":148,"count":4},{"bucketMax":101,"count":0},{"bucketMax":102,"count":1},{"bucketMax":172,"count":0},{"bucketMax":98,"count":2},{"bucketMax":61,"count":1},{"bucketMax":82,"count":2},{"bucketMax":204,"count":0},{"bucketMax":108,"count":3},{"bucketMax":62,"count":1},{"bucketMax":71,"count":0}]},"Sort":{"cyclesExecutedBySolution":[{"bucketMax":1699,"count":0},{"bucketMax":433,"count":2},{"bucketMax":565,"count":2},{"bucketMax":2071,"count":2},{"bucketMax":574,"count":1},{"bucketMax":1688,"count":0},{"bucketMax":861,"count":2},{"bucketMax":572,"count":1},{"bucketMax":720,"count":2},{"bucketMax":1174,"count":2},{"bucketMax":631,"count":4},{"bucketMax":810,"count":2},{"bucketMax":1260,"count":2},{"bucketMax":724,"count":2},{"bucketMax":959,"count":4},{"bucketMax":665,"count":2},{"bucketMax":835,"count":2},{"bucketMax":723,"count":2},{"bucketMax":1027,"count":2},{"bucketMax":1202,"count":4},{"bucketMax":757,"count":2},{"bucketMax":614,"count":0},{"bucketMax":2107,"count":0},{"bucketMax":1134,"count":2},{"bucketMax":886,"count":2},{"bucketMax":1485,"count":2},{"bucketMax":731,"count":0},{"bucketMax":599,"count":2},{"bucketMax":486,"count":2},{"bucketMax":6129,"count":2},{"bucketMax":512,"count":2},{"bucketMax":624,"count":2},{"bucketMax":866,"count":2}],"memoryBytesAccessedBySolution":[{"bucketMax":139,"count":2},{"bucketMax":168,"count":2},{"bucketMax":121,"count":2},{"bucketMax":213,"count":2},{"bucketMax":180,"count":2},{"bucketMax":164,"count":4},{"bucketMax":178,"count":2},{"bucketMax":203,"count":4},{"bucketMax":224,"count":2},{"bucketMax":202,"count":0},{"bucketMax":182,"count":2},{"bucketMax":96,"count":1},{"bucketMax":156,"count":2},{"bucketMax":171,"count":0},{"bucketMax":219,"count":4},{"bucketMax":192,"count":0},{"bucketMax":209,"count":2},{"bucketMax":199,"count":2},{"bucketMax":197,"count":6},{"bucketMax":232,"count":2},{"bucketMax":208,"count":0},{"bucketMax":241,"count":4},{"bucketMax":250,"count":4},{"bucketMax":87,"count":2},{"bucketMax":95,"count":1},{"bucketMax":248,"count":2},{"bucketMax":157,"count":4}]},"Mode":{"cyclesExecutedBySolution":[{"bucketMax":625,"count":2},{"bucketMax":786,"count":2},{"bucketMax":2144,"count":2},{"bucketMax":1774,"count":2},{"bucketMax":310,"count":2},{"bucketMax":815,"count":0},{"bucketMax":3316,"count":2},{"bucketMax":669,"count":3},{"bucketMax":2989,"count":4},{"bucketMax":687,"count":4},{"bucketMax":1605,"count":1},{"bucketMax":754,"count":2},{"bucketMax":731,"count":2},{"bucketMax":749,"count":2},{"bucketMax":1127,"count":2},{"bucketMax":545,"count":2},{"bucketMax":814,"count":2},{"bucketMax":1008,"count":2},{"bucketMax":1472,"count":4}],"memoryBytesAccessedBySolution":[{"bucketMax":186,"count":2},{"bucketMax":218,"count":2},{"bucketMax":171,"count":2},{"bucketMax":167,"count":4},{"bucketMax":230,"count":4},{"bucketMax":235,"count":2},{"bucketMax":193,"count":2},{"bucketMax":190,"count":2},{"bucketMax":208,"count":2},{"bucketMax":196,"count":2},{"bucketMax":142,"count":2},{"bucketMax":205,"count":2},{"bucketMax":197,"count":4},{"bucketMax":158,"count":1},{"bucketMax":221,"count":0},{"bucketMax":252,"count":2},{"bucketMax":251,"count":2},{"bucketMax":178,"count":3},{"bucketMax":126,"count":2}]},"Characters":{"cyclesExecutedBySolution":[{"bucketMax":2,"count":44}],"memoryBytesAccessedBySolution":[{"bucketMax":9,"count":40},{"bucketMax":8,"count":0},{"bucketMax":7,"count":4}]},"Decimal Digits":{"cyclesExecutedBySolution":[{"bucketMax":11,"count":44},{"bucketMax":13,"count":2}],"memoryBytesAccessedBySolution":[{"bucketMax":18,"count":2},{"bucketMax":15,"count":8},{"bucketMax":14,"count":2},{"bucketMax":16,"count":34}]},"Uppercase":{"cyclesExecutedBySolution":[{"bucketMax":48,"count":3},{"bucketMax":65,"count":2},{"bucketMax":58,"count":1},{"bucketMax":34,"count":6},{"bucketMax":76,"count":2},{"bucketMax":66,"count":4},{"bucketMax":63,"count":2},{"bucketMax":67,"count":4},{"bucketMax":45,"count":4},{"bucketMax":52,"count":2},{"bucketMax":46,"count":4},{"bucketMax":50,"count":6}],"memoryBytesAccessedBySolution":[{"bucketMax":30,"count":5},{"bucketMax":59,"count":4},{"bucketMax":33,"count":2},{"bucketMax":25,"count":1},{"bucketMax":31,"count":5},{"bucketMax":37,"count":6},{"bucketMax":66,"count":2},{"bucketMax":47,"count":2},{"bucketMax":24,"count":4},{"bucketMax":29,"count":1},{"bucketMax":27,"count":5},{"bucketMax":43,"count":0},{"bucketMax":50,"count":0},{"bucketMax":28,"count":1},{"bucketMax":40,"count":0},{"bucketMax":35,"count":2}]},"Strings":{"cyclesExecutedBySolution":[{"bucketMax":14,"count":2},{"bucketMax":27,"count":5},{"bucketMax":40,"count":37}],"memoryBytesAccessedBySolution":[{"bucketMax":26,"count":35},{"bucketMax":43,"count":1},{"bucketMax":23,"count":2},{"bucketMax":22,"count":5},{"bucketMax":25,"count":0},{"bucketMax":57,"count":1},{"bucketMax":24,"count":0}]},"Tokenizer":{"cyclesExecutedBySolution":[{"bucketMax":235,"count":0},{"bucketMax":264,"count":2},{"bucketMax":226,"count":10},{"bucketMax":227,"count":4},{"bucketMax":183,"count":2},{"bucketMax":233,"count":4},{"bucketMax":225,"count":0},{"bucketMax":184,"count":2},{"bucketMax":189,"count":3},{"bucketMax":182,"count":3},{"bucketMax":320,"count":2},{"bucketMax":234,"count":2},{"bucketMax":268,"count":0},{"bucketMax":219,"count":6}],"memoryBytesAccessedBySolution":[{"bucketMax":30,"count":5},{"bucketMax":36,"count":2},{"bucketMax":31,"count":5},{"bucketMax":22,"count":2},{"bucketMax":25,"count":2},{"bucketMax":32,"count":3},{"bucketMax":28,"count":3},{"bucketMax":23,"count":2},{"bucketMax":26,"count":11},{"bucketMax":29,"count":0},{"bucketMax":27,"count":1},{"bucketMax":38,"count":2},{"bucketMax":33,"count":2}]},"Parse Decimal":{"cyclesExecutedBySolution":[{"bucketMax":136,"count":0},{"bucketMax":138,"count":2},{"bucketMax":60,"count":2},{"bucketMax":68,"count":0},{"bucketMax":129,"count":4},{"bucketMax":106,"count":2},{"bucketMax":82,"count":2},{"bucketMax":71,"count":1},{"bucketMax":101,"count":2},{"bucketMax":77,"count":0},{"bucketMax":61,"count":2},{"bucketMax":152,"count":1},{"bucketMax":117,"count":2},{"bucketMax":163,"count":1},{"bucketMax":47,"count":2},{"bucketMax":75,"count":0},{"bucketMax":79,"count":0},{"bucketMax":132,"count":0},{"bucketMax":58,"count":2},{"bucketMax":81,"count":2},{"bucketMax":96,"count":2},{"bucketMax":113,"count":2},{"bucketMax":104,"count":0},{"bucketMax":94,"count":2},{"bucketMax":49,"count":0},{"bucketMax":151,"count":0},{"bucketMax":70,"count":2},{"bucketMax":116,"count":2},{"bucketMax":100,"count":1},{"bucketMax":268,"count":0}],"memoryBytesAccessedBySolution":[{"bucketMax":48,"count":1},{"bucketMax":114,"count":0},{"bucketMax":80,"count":4},{"bucketMax":69,"count":5},{"bucketMax":59,"count":0},{"bucketMax":125,"count":2},{"bucketMax":66,"count":0},{"bucketMax":52,"count":3},{"bucketMax":90,"count":2},{"bucketMax":111,"count":0},{"bucketMax":60,"count":1},{"bucketMax":76,"count":2},{"bucketMax":73,"count":0},{"bucketMax":79,"count":2},{"bucketMax":54,"count":4},{"bucketMax":56,"count":3},{"bucketMax":63,"count":1},{"bucketMax":51,"count":6},{"bucketMax":167,"count":0},{"bucketMax":67,"count":2},{"bucketMax":62,"count":0}]},"Print Decimal":{"cyclesExecutedBySolution":[{"bucketMax":138,"count":2},{"bucketMax":143,"count":2},{"bucketMax":162,"count":2},{"bucketMax":253,"count":2},{"bucketMax":49,"count":2},{"bucketMax":81,"count":2},{"bucketMax":75,"count":4},{"bucketMax":54,"count":2},{"bucketMax":80,"count":0},{"bucketMax":78,"count":0},{"bucketMax":70,"count":2},{"bucketMax":100,"count":2},{"bucketMax":122,"count":2},{"bucketMax":56,"count":0},{"bucketMax":124,"count":2},{"bucketMax":118,"count":2},{"bucketMax":101,"count":2},{"bucketMax":166,"count":6}],"memoryBytesAccessedBySolution":[{"bucketMax":70,"count":1},{"bucketMax":93,"count":2},{"bucketMax":95,"count":2},{"bucketMax":78,"count":2},{"bucketMax":84,"count":2},{"bucketMax":154,"count":4},{"bucketMax":125,"count":2},{"bucketMax":186,"count":2},{"bucketMax":71,"count":3},{"bucketMax":103,"count":2},{"bucketMax":81,"count":0},{"bucketMax":112,"count":2},{"bucketMax":117,"count":2},{"bucketMax":59,"count":2},{"bucketMax":86,"count":2},{"bucketMax":116,"count":2},{"bucketMax":52,"count":2},{"bucketMax":62,"count":0},{"bucketMax":76,"count":2}]},"Calculator":{"cyclesExecutedBySolution":[{"bucketMax":224,"count":2},{"bucketMax":159,"count":2},{"bucketMax":372,"count":0},{"bucketMax":352,"count":0},{"bucketMax":276,"count":2},{"bucketMax":246,"count":2},{"bucketMax":354,"count":4},{"bucketMax":150,"count":2},{"bucketMax":329,"count":2},{"bucketMax":194,"count":2},{"bucketMax":310,"count":2},{"bucketMax":371,"count":1},{"bucketMax":270,"count":2},{"bucketMax":311,"count":2},{"bucketMax":308,"count":2},{"bucketMax":348,"count":1},{"bucketMax":358,"count":0},{"bucketMax":332,"count":2},{"bucketMax":162,"count":2},{"bucketMax":382,"count":0}],"memoryBytesAccessedBySolution":[{"bucketMax":205,"count":2},{"bucketMax":158,"count":1},{"bucketMax":144,"count":2},{"bucketMax":221,"count":2},{"bucketMax":166,"count":2},{"bucketMax":186,"count":2},{"bucketMax":159,"count":2},{"bucketMax":156,"count":2},{"bucketMax":113,"count":2},{"bucketMax":222,"count":2},{"bucketMax":187,"count":2},{"bucketMax":181,"count":0},{"bucketMax":145,"count":1},{"bucketMax":164,"count":4},{"bucketMax":184,"count":4},{"bucketMax":170,"count":0},{"bucketMax":202,"count":0},{"bucketMax":200,"count":2}]},"Multi-Line Strings":{"cyclesExecutedBySolution":[{"bucketMax":145,"count":4},{"bucketMax":119,"count":2},{"bucketMax":144,"count":2},{"bucketMax":118,"count":2},{"bucketMax":167,"count":2},{"bucketMax":116,"count":6},{"bucketMax":143,"count":4},{"bucketMax":117,"count":2},{"bucketMax":142,"count":6},{"bucketMax":140,"count":2},{"bucketMax":158,"count":0}],"memoryBytesAccessedBySolution":[{"bucketMax":33,"count":2},{"bucketMax":25,"count":3},{"bucketMax":28,"count":1},{"bucketMax":23,"count":4},{"bucketMax":31,"count":4},{"bucketMax":22,"count":2},{"bucketMax":27,"count":2},{"bucketMax":26,"count":6},{"bucketMax":29,"count":0},{"bucketMax":30,"count":4},{"bucketMax":32,"count":2},{"bucketMax":34,"count":2}]},"Parse Data Directives":{"cyclesExecutedBySolution":[{"bucketMax":190,"count":2},{"bucketMax":221,"count":0},{"bucketMax":94,"count":2},{"bucketMax":205,"count":4},{"bucketMax":206,"count":0},{"bucketMax":224,"count":0},{"bucketMax":131,"count":2},{"bucketMax":223,"count":0},{"bucketMax":137,"count":2},{"bucketMax":213,"count":1},{"bucketMax":198,"count":2},{"bucketMax":214,"count":0},{"bucketMax":216,"count":2},{"bucketMax":193,"count":1},{"bucketMax":359,"count":0},{"bucketMax":143,"count":2},{"bucketMax":154,"count":2},{"bucketMax":83,"count":2},{"bucketMax":231,"count":0},{"bucketMax":243,"count":0},{"bucketMax":244,"count":0},{"bucketMax":188,"count":2},{"bucketMax":226,"count":0},{"bucketMax":176,"count":2}],"memoryBytesAccessedBySolution":[{"bucketMax":120,"count":2},{"bucketMax":163,"count":0},{"bucketMax":144,"count":0},{"bucketMax":142,"count":2},{"bucketMax":177,"count":0},{"bucketMax":172,"count":1},{"bucketMax":132,"count":4},{"bucketMax":136,"count":2},{"bucketMax":169,"count":0},{"bucketMax":161,"count":0},{"bucketMax":176,"count":0},{"bucketMax":166,"count":0},{"bucketMax":141,"count":0},{"bucketMax":99,"count":2},{"bucketMax":135,"count":1},{"bucketMax":156,"count":0},{"bucketMax":168,"count":2},{"bucketMax":107,"count":2},{"bucketMax":171,"count":2},{"bucketMax":137,"count":2},{"bucketMax":155,"count":2},{"bucketMax":114,"count":2},{"bucketMax":160,"count":0},{"bucketMax":138,"count":0},{"bucketMax":90,"count":2}]},"Parse Subleq Instructions":{"cyclesExecutedBySolution":[{"bucketMax":517,"count":2},{"bucketMax":485,"count":0},{"bucketMax":451,"count":1},{"bucketMax":1184,"count":0},{"bucketMax":464,"count":1},{"bucketMax":317,"count":2},{"bucketMax":584,"count":2},{"bucketMax":499,"count":2},{"bucketMax":751,"count":0},{"bucketMax":586,"count":0},{"bucketMax":407,"count":2},{"bucketMax":423,"count":2},{"bucketMax":181,"count":2},{"bucketMax":1014,"count":2},{"bucketMax":2213,"count":2},{"bucketMax":338,"count":4},{"bucketMax":221,"count":2},{"bucketMax":361,"count":2}],"memoryBytesAccessedBySolution":[{"bucketMax":94,"count":2},{"bucketMax":141,"count":0},{"bucketMax":133,"count":1},{"bucketMax":142,"count":2},{"bucketMax":137,"count":0},{"bucketMax":158,"count":2},{"bucketMax":108,"count":2},{"bucketMax":103,"count":2},{"bucketMax":132,"count":0},{"bucketMax":116,"count":2},{"bucketMax":118,"count":4},{"bucketMax":171,"count":2},{"bucketMax":79,"count":2},{"bucketMax":73,"count":2},{"bucketMax":125,"count":2},{"bucketMax":126,"count":1},{"bucketMax":83,"count":2}]},"Self-Hosting":{"cyclesExecutedBySolution":[{"bucketMax":438,"count":2},{"bucketMax":652,"count":2},{"bucketMax":681,"count":2},{"bucketMax":1561,"count":4},{"bucketMax":1059,"count":0},{"bucketMax":914,"count":0},{"bucketMax":895,"count":0},{"bucketMax":861,"count":0},{"bucketMax":492,"count":2},{"bucketMax":1157,"count":2},{"bucketMax":913,"count":0},{"bucketMax":1048,"count":0},{"bucketMax":708,"count":2},{"bucketMax":1074,"count":0},{"bucketMax":1063,"count":2},{"bucketMax":848,"count":4},{"bucketMax":988,"count":0},{"bucketMax":854,"count":1},{"bucketMax":1006,"count":1},{"bucketMax":984,"count":0},{"bucketMax":926,"count":0},{"bucketMax":477,"count":0},{"bucketMax":1037,"count":2},{"bucketMax":892,"count":1},{"bucketMax":962,"count":1},{"bucketMax":1004,"count":0}],"memoryBytesAccessedBySolution":[{"bucketMax":212,"count":0},{"bucketMax":181,"count":2},{"bucketMax":231,"count":0},{"bucketMax":218,"count":0},{"bucketMax":170,"count":2},{"bucketMax":215,"count":0},{"bucketMax":190,"count":1},{"bucketMax":180,"count":2},{"bucketMax":224,"count":2},{"bucketMax":187,"count":2},{"bucketMax":216,"count":0},{"bucketMax":217,"count":2},{"bucketMax":243,"count":0},{"bucketMax":206,"count":5},{"bucketMax":204,"count":0},{"bucketMax":244,"count":2},{"bucketMax":178,"count":1},{"bucketMax":184,"count":0},{"bucketMax":195,"count":2},{"bucketMax":197,"count":0},{"bucketMax":196,"count":1},{"bucketMax":193,"count":0},{"bucketMax":202,"count":4}]}}};
-
-const steamStatsCache: Sic1StatsCache = {"userStats":{"solutionsByUser":[{"bucketMax":1,"count":113},{"bucketMax":2,"count":169},{"bucketMax":3,"count":61},{"bucketMax":4,"count":33},{"bucketMax":5,"count":51},{"bucketMax":6,"count":43},{"bucketMax":7,"count":42},{"bucketMax":8,"count":6},{"bucketMax":9,"count":1},{"bucketMax":10,"count":3},{"bucketMax":11,"count":1},{"bucketMax":12,"count":2},{"bucketMax":13,"count":23},{"bucketMax":14,"count":12},{"bucketMax":15,"count":10},{"bucketMax":16,"count":5},{"bucketMax":17,"count":3},{"bucketMax":22,"count":1},{"bucketMax":24,"count":1},{"bucketMax":25,"count":1},{"bucketMax":27,"count":1},{"bucketMax":30,"count":9}],"userSolvedCount":0},"puzzleStats":{"Subleq Instruction and Output":{"cyclesExecutedBySolution":[{"bucketMax":1,"count":587},{"bucketMax":4,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":4,"count":10},{"bucketMax":5,"count":577},{"bucketMax":8,"count":1}]},"Data Directive and Looping":{"cyclesExecutedBySolution":[{"bucketMax":3,"count":144},{"bucketMax":4,"count":1},{"bucketMax":5,"count":331}],"memoryBytesAccessedBySolution":[{"bucketMax":5,"count":130},{"bucketMax":8,"count":1},{"bucketMax":9,"count":343},{"bucketMax":11,"count":1}]},"First Assessment":{"cyclesExecutedBySolution":[{"bucketMax":6,"count":24},{"bucketMax":8,"count":252},{"bucketMax":10,"count":32},{"bucketMax":11,"count":3},{"bucketMax":12,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":11,"count":24},{"bucketMax":12,"count":251},{"bucketMax":15,"count":4},{"bucketMax":16,"count":31},{"bucketMax":18,"count":1}]},"Addition":{"cyclesExecutedBySolution":[{"bucketMax":15,"count":15},{"bucketMax":18,"count":2},{"bucketMax":19,"count":197},{"bucketMax":23,"count":6},{"bucketMax":24,"count":1},{"bucketMax":28,"count":1},{"bucketMax":37,"count":11},{"bucketMax":38,"count":2},{"bucketMax":41,"count":1},{"bucketMax":46,"count":4},{"bucketMax":47,"count":2},{"bucketMax":48,"count":1},{"bucketMax":49,"count":1},{"bucketMax":50,"count":3},{"bucketMax":60,"count":1},{"bucketMax":63,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":14,"count":18},{"bucketMax":15,"count":194},{"bucketMax":17,"count":1},{"bucketMax":18,"count":1},{"bucketMax":19,"count":5},{"bucketMax":22,"count":1},{"bucketMax":24,"count":1},{"bucketMax":28,"count":2},{"bucketMax":29,"count":10},{"bucketMax":33,"count":1},{"bucketMax":34,"count":1},{"bucketMax":35,"count":1},{"bucketMax":36,"count":6},{"bucketMax":39,"count":1},{"bucketMax":40,"count":2},{"bucketMax":46,"count":2}]},"Subtraction":{"cyclesExecutedBySolution":[{"bucketMax":20,"count":10},{"bucketMax":28,"count":157},{"bucketMax":29,"count":3},{"bucketMax":31,"count":1},{"bucketMax":32,"count":7},{"bucketMax":34,"count":1},{"bucketMax":36,"count":1},{"bucketMax":37,"count":11},{"bucketMax":38,"count":11},{"bucketMax":39,"count":1},{"bucketMax":41,"count":1},{"bucketMax":43,"count":1},{"bucketMax":44,"count":1},{"bucketMax":46,"count":1},{"bucketMax":50,"count":1},{"bucketMax":55,"count":3},{"bucketMax":56,"count":1},{"bucketMax":57,"count":1},{"bucketMax":59,"count":3}],"memoryBytesAccessedBySolution":[{"bucketMax":18,"count":1},{"bucketMax":20,"count":4},{"bucketMax":21,"count":7},{"bucketMax":22,"count":158},{"bucketMax":25,"count":1},{"bucketMax":26,"count":8},{"bucketMax":28,"count":12},{"bucketMax":29,"count":11},{"bucketMax":30,"count":1},{"bucketMax":32,"count":1},{"bucketMax":33,"count":2},{"bucketMax":36,"count":1},{"bucketMax":40,"count":1},{"bucketMax":41,"count":1},{"bucketMax":42,"count":1},{"bucketMax":43,"count":3},{"bucketMax":47,"count":3}]},"Sign Function":{"cyclesExecutedBySolution":[{"bucketMax":14,"count":1},{"bucketMax":18,"count":3},{"bucketMax":24,"count":55},{"bucketMax":25,"count":3},{"bucketMax":26,"count":24},{"bucketMax":27,"count":8},{"bucketMax":28,"count":20},{"bucketMax":29,"count":5},{"bucketMax":30,"count":6},{"bucketMax":31,"count":7},{"bucketMax":32,"count":2},{"bucketMax":33,"count":1},{"bucketMax":34,"count":1},{"bucketMax":35,"count":4},{"bucketMax":36,"count":3},{"bucketMax":37,"count":3},{"bucketMax":38,"count":5},{"bucketMax":40,"count":1},{"bucketMax":42,"count":1},{"bucketMax":43,"count":1},{"bucketMax":45,"count":2},{"bucketMax":47,"count":1},{"bucketMax":50,"count":1},{"bucketMax":52,"count":1},{"bucketMax":55,"count":1},{"bucketMax":56,"count":2},{"bucketMax":60,"count":1},{"bucketMax":89,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":19,"count":1},{"bucketMax":21,"count":6},{"bucketMax":23,"count":8},{"bucketMax":24,"count":7},{"bucketMax":26,"count":2},{"bucketMax":27,"count":19},{"bucketMax":28,"count":5},{"bucketMax":29,"count":14},{"bucketMax":30,"count":40},{"bucketMax":31,"count":11},{"bucketMax":32,"count":1},{"bucketMax":33,"count":6},{"bucketMax":34,"count":11},{"bucketMax":36,"count":8},{"bucketMax":37,"count":10},{"bucketMax":39,"count":2},{"bucketMax":40,"count":4},{"bucketMax":41,"count":1},{"bucketMax":42,"count":1},{"bucketMax":43,"count":2},{"bucketMax":46,"count":2},{"bucketMax":47,"count":1},{"bucketMax":50,"count":1},{"bucketMax":69,"count":1}]},"Multiplication":{"cyclesExecutedBySolution":[{"bucketMax":7,"count":1},{"bucketMax":45,"count":1},{"bucketMax":50,"count":1},{"bucketMax":51,"count":1},{"bucketMax":56,"count":1},{"bucketMax":59,"count":1},{"bucketMax":61,"count":1},{"bucketMax":63,"count":1},{"bucketMax":64,"count":2},{"bucketMax":65,"count":3},{"bucketMax":66,"count":1},{"bucketMax":67,"count":4},{"bucketMax":68,"count":1},{"bucketMax":70,"count":2},{"bucketMax":71,"count":3},{"bucketMax":73,"count":2},{"bucketMax":74,"count":2},{"bucketMax":75,"count":5},{"bucketMax":76,"count":3},{"bucketMax":77,"count":2},{"bucketMax":78,"count":3},{"bucketMax":79,"count":6},{"bucketMax":80,"count":2},{"bucketMax":81,"count":3},{"bucketMax":83,"count":2},{"bucketMax":85,"count":2},{"bucketMax":86,"count":1},{"bucketMax":87,"count":7},{"bucketMax":88,"count":3},{"bucketMax":89,"count":1},{"bucketMax":90,"count":3},{"bucketMax":91,"count":3},{"bucketMax":92,"count":6},{"bucketMax":93,"count":6},{"bucketMax":95,"count":7},{"bucketMax":96,"count":2},{"bucketMax":97,"count":2},{"bucketMax":98,"count":1},{"bucketMax":99,"count":1},{"bucketMax":100,"count":1},{"bucketMax":103,"count":1},{"bucketMax":105,"count":5},{"bucketMax":106,"count":1},{"bucketMax":109,"count":3},{"bucketMax":110,"count":1},{"bucketMax":111,"count":2},{"bucketMax":113,"count":2},{"bucketMax":114,"count":1},{"bucketMax":115,"count":2},{"bucketMax":116,"count":1},{"bucketMax":117,"count":1},{"bucketMax":131,"count":1},{"bucketMax":136,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":28,"count":1},{"bucketMax":31,"count":1},{"bucketMax":33,"count":1},{"bucketMax":36,"count":3},{"bucketMax":37,"count":5},{"bucketMax":39,"count":3},{"bucketMax":40,"count":14},{"bucketMax":41,"count":1},{"bucketMax":42,"count":9},{"bucketMax":43,"count":9},{"bucketMax":44,"count":6},{"bucketMax":45,"count":5},{"bucketMax":46,"count":5},{"bucketMax":47,"count":15},{"bucketMax":48,"count":3},{"bucketMax":49,"count":4},{"bucketMax":50,"count":4},{"bucketMax":51,"count":2},{"bucketMax":52,"count":1},{"bucketMax":53,"count":6},{"bucketMax":54,"count":2},{"bucketMax":56,"count":3},{"bucketMax":57,"count":3},{"bucketMax":58,"count":4},{"bucketMax":59,"count":1},{"bucketMax":60,"count":3},{"bucketMax":62,"count":1},{"bucketMax":63,"count":1},{"bucketMax":67,"count":1},{"bucketMax":68,"count":1},{"bucketMax":72,"count":1},{"bucketMax":73,"count":1},{"bucketMax":74,"count":1},{"bucketMax":117,"count":1}]},"Division":{"cyclesExecutedBySolution":[{"bucketMax":78,"count":5},{"bucketMax":79,"count":3},{"bucketMax":81,"count":1},{"bucketMax":82,"count":2},{"bucketMax":84,"count":1},{"bucketMax":85,"count":3},{"bucketMax":86,"count":7},{"bucketMax":87,"count":7},{"bucketMax":89,"count":3},{"bucketMax":90,"count":3},{"bucketMax":92,"count":3},{"bucketMax":93,"count":3},{"bucketMax":94,"count":2},{"bucketMax":96,"count":1},{"bucketMax":97,"count":3},{"bucketMax":98,"count":1},{"bucketMax":100,"count":2},{"bucketMax":102,"count":1},{"bucketMax":105,"count":1},{"bucketMax":108,"count":1},{"bucketMax":109,"count":1},{"bucketMax":110,"count":1},{"bucketMax":111,"count":1},{"bucketMax":112,"count":1},{"bucketMax":113,"count":1},{"bucketMax":114,"count":1},{"bucketMax":117,"count":1},{"bucketMax":118,"count":1},{"bucketMax":122,"count":3},{"bucketMax":123,"count":3},{"bucketMax":124,"count":1},{"bucketMax":127,"count":3},{"bucketMax":134,"count":1},{"bucketMax":145,"count":1},{"bucketMax":153,"count":1},{"bucketMax":164,"count":1},{"bucketMax":169,"count":1},{"bucketMax":179,"count":1},{"bucketMax":186,"count":1},{"bucketMax":189,"count":1},{"bucketMax":203,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":38,"count":2},{"bucketMax":42,"count":2},{"bucketMax":43,"count":5},{"bucketMax":45,"count":1},{"bucketMax":46,"count":9},{"bucketMax":47,"count":11},{"bucketMax":49,"count":1},{"bucketMax":51,"count":1},{"bucketMax":52,"count":4},{"bucketMax":53,"count":2},{"bucketMax":54,"count":2},{"bucketMax":56,"count":1},{"bucketMax":57,"count":2},{"bucketMax":58,"count":1},{"bucketMax":59,"count":2},{"bucketMax":60,"count":1},{"bucketMax":61,"count":1},{"bucketMax":62,"count":1},{"bucketMax":63,"count":2},{"bucketMax":64,"count":1},{"bucketMax":65,"count":2},{"bucketMax":66,"count":1},{"bucketMax":68,"count":1},{"bucketMax":69,"count":3},{"bucketMax":71,"count":1},{"bucketMax":72,"count":1},{"bucketMax":73,"count":4},{"bucketMax":76,"count":2},{"bucketMax":77,"count":1},{"bucketMax":78,"count":1},{"bucketMax":80,"count":2},{"bucketMax":82,"count":1},{"bucketMax":85,"count":1},{"bucketMax":86,"count":1},{"bucketMax":91,"count":1},{"bucketMax":92,"count":1},{"bucketMax":93,"count":1},{"bucketMax":109,"count":1},{"bucketMax":121,"count":1}]},"Sequence Sum":{"cyclesExecutedBySolution":[{"bucketMax":85,"count":23},{"bucketMax":86,"count":2},{"bucketMax":87,"count":3},{"bucketMax":88,"count":3},{"bucketMax":89,"count":6},{"bucketMax":91,"count":9},{"bucketMax":92,"count":6},{"bucketMax":93,"count":6},{"bucketMax":95,"count":2},{"bucketMax":98,"count":1},{"bucketMax":99,"count":1},{"bucketMax":100,"count":2},{"bucketMax":101,"count":1},{"bucketMax":103,"count":1},{"bucketMax":107,"count":1},{"bucketMax":111,"count":2},{"bucketMax":113,"count":1},{"bucketMax":117,"count":1},{"bucketMax":128,"count":1},{"bucketMax":140,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":22,"count":1},{"bucketMax":23,"count":1},{"bucketMax":24,"count":3},{"bucketMax":25,"count":1},{"bucketMax":26,"count":30},{"bucketMax":29,"count":7},{"bucketMax":30,"count":5},{"bucketMax":32,"count":12},{"bucketMax":33,"count":3},{"bucketMax":35,"count":3},{"bucketMax":36,"count":1},{"bucketMax":38,"count":2},{"bucketMax":39,"count":2},{"bucketMax":42,"count":1},{"bucketMax":43,"count":1}]},"Sequence Cardinality":{"cyclesExecutedBySolution":[{"bucketMax":26,"count":1},{"bucketMax":27,"count":2},{"bucketMax":43,"count":1},{"bucketMax":50,"count":9},{"bucketMax":51,"count":3},{"bucketMax":54,"count":1},{"bucketMax":55,"count":19},{"bucketMax":57,"count":1},{"bucketMax":58,"count":3},{"bucketMax":59,"count":7},{"bucketMax":61,"count":10},{"bucketMax":62,"count":2},{"bucketMax":63,"count":8},{"bucketMax":65,"count":1},{"bucketMax":73,"count":1},{"bucketMax":75,"count":2},{"bucketMax":94,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":15,"count":1},{"bucketMax":16,"count":1},{"bucketMax":17,"count":1},{"bucketMax":23,"count":2},{"bucketMax":24,"count":6},{"bucketMax":25,"count":3},{"bucketMax":26,"count":1},{"bucketMax":27,"count":38},{"bucketMax":30,"count":5},{"bucketMax":32,"count":1},{"bucketMax":33,"count":7},{"bucketMax":34,"count":2},{"bucketMax":36,"count":1},{"bucketMax":37,"count":1},{"bucketMax":43,"count":1},{"bucketMax":44,"count":1}]},"Number to Sequence":{"cyclesExecutedBySolution":[{"bucketMax":48,"count":1},{"bucketMax":53,"count":1},{"bucketMax":59,"count":6},{"bucketMax":60,"count":4},{"bucketMax":61,"count":2},{"bucketMax":65,"count":1},{"bucketMax":69,"count":2},{"bucketMax":71,"count":1},{"bucketMax":72,"count":5},{"bucketMax":77,"count":12},{"bucketMax":78,"count":12},{"bucketMax":79,"count":2},{"bucketMax":82,"count":1},{"bucketMax":83,"count":3},{"bucketMax":84,"count":1},{"bucketMax":85,"count":1},{"bucketMax":89,"count":1},{"bucketMax":90,"count":2},{"bucketMax":94,"count":2},{"bucketMax":95,"count":2},{"bucketMax":97,"count":1},{"bucketMax":99,"count":1},{"bucketMax":100,"count":1},{"bucketMax":117,"count":1},{"bucketMax":119,"count":2},{"bucketMax":130,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":16,"count":1},{"bucketMax":18,"count":2},{"bucketMax":19,"count":4},{"bucketMax":20,"count":2},{"bucketMax":21,"count":1},{"bucketMax":22,"count":3},{"bucketMax":23,"count":16},{"bucketMax":24,"count":2},{"bucketMax":25,"count":3},{"bucketMax":26,"count":5},{"bucketMax":27,"count":3},{"bucketMax":28,"count":1},{"bucketMax":29,"count":3},{"bucketMax":30,"count":2},{"bucketMax":31,"count":8},{"bucketMax":32,"count":1},{"bucketMax":33,"count":2},{"bucketMax":34,"count":3},{"bucketMax":35,"count":1},{"bucketMax":37,"count":3},{"bucketMax":40,"count":2},{"bucketMax":41,"count":1}]},"Self-Modifying Code":{"cyclesExecutedBySolution":[{"bucketMax":12,"count":3},{"bucketMax":46,"count":66}],"memoryBytesAccessedBySolution":[{"bucketMax":15,"count":69}]},"Stack Memory":{"cyclesExecutedBySolution":[{"bucketMax":3,"count":5},{"bucketMax":6,"count":2},{"bucketMax":19,"count":60}],"memoryBytesAccessedBySolution":[{"bucketMax":7,"count":1},{"bucketMax":8,"count":1},{"bucketMax":9,"count":2},{"bucketMax":13,"count":1},{"bucketMax":23,"count":2},{"bucketMax":36,"count":60}]},"Reverse Sequence":{"cyclesExecutedBySolution":[{"bucketMax":131,"count":1},{"bucketMax":148,"count":2},{"bucketMax":156,"count":1},{"bucketMax":164,"count":1},{"bucketMax":168,"count":1},{"bucketMax":173,"count":1},{"bucketMax":180,"count":2},{"bucketMax":183,"count":1},{"bucketMax":188,"count":1},{"bucketMax":191,"count":1},{"bucketMax":193,"count":1},{"bucketMax":195,"count":1},{"bucketMax":198,"count":1},{"bucketMax":200,"count":1},{"bucketMax":201,"count":1},{"bucketMax":202,"count":1},{"bucketMax":206,"count":1},{"bucketMax":213,"count":1},{"bucketMax":217,"count":1},{"bucketMax":218,"count":1},{"bucketMax":223,"count":2},{"bucketMax":225,"count":1},{"bucketMax":226,"count":1},{"bucketMax":228,"count":1},{"bucketMax":234,"count":1},{"bucketMax":247,"count":1},{"bucketMax":257,"count":1},{"bucketMax":262,"count":1},{"bucketMax":263,"count":1},{"bucketMax":265,"count":1},{"bucketMax":271,"count":1},{"bucketMax":279,"count":2},{"bucketMax":283,"count":1},{"bucketMax":294,"count":1},{"bucketMax":307,"count":1},{"bucketMax":345,"count":1},{"bucketMax":381,"count":1},{"bucketMax":401,"count":1},{"bucketMax":448,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":58,"count":1},{"bucketMax":59,"count":2},{"bucketMax":66,"count":2},{"bucketMax":68,"count":1},{"bucketMax":69,"count":1},{"bucketMax":72,"count":2},{"bucketMax":75,"count":1},{"bucketMax":76,"count":1},{"bucketMax":78,"count":1},{"bucketMax":80,"count":1},{"bucketMax":83,"count":1},{"bucketMax":84,"count":1},{"bucketMax":85,"count":1},{"bucketMax":86,"count":2},{"bucketMax":87,"count":3},{"bucketMax":88,"count":1},{"bucketMax":90,"count":2},{"bucketMax":92,"count":2},{"bucketMax":95,"count":1},{"bucketMax":96,"count":1},{"bucketMax":97,"count":1},{"bucketMax":101,"count":1},{"bucketMax":102,"count":1},{"bucketMax":103,"count":1},{"bucketMax":105,"count":2},{"bucketMax":107,"count":1},{"bucketMax":109,"count":2},{"bucketMax":110,"count":1},{"bucketMax":117,"count":2},{"bucketMax":118,"count":1},{"bucketMax":135,"count":1},{"bucketMax":143,"count":1}]},"Interleave":{"cyclesExecutedBySolution":[{"bucketMax":111,"count":1},{"bucketMax":129,"count":2},{"bucketMax":132,"count":1},{"bucketMax":142,"count":1},{"bucketMax":170,"count":1},{"bucketMax":177,"count":1},{"bucketMax":194,"count":1},{"bucketMax":197,"count":1},{"bucketMax":198,"count":2},{"bucketMax":214,"count":1},{"bucketMax":232,"count":1},{"bucketMax":233,"count":1},{"bucketMax":247,"count":1},{"bucketMax":250,"count":1},{"bucketMax":300,"count":2},{"bucketMax":305,"count":1},{"bucketMax":324,"count":1},{"bucketMax":329,"count":1},{"bucketMax":346,"count":1},{"bucketMax":360,"count":1},{"bucketMax":361,"count":1},{"bucketMax":367,"count":1},{"bucketMax":407,"count":1},{"bucketMax":419,"count":1},{"bucketMax":470,"count":1},{"bucketMax":532,"count":1},{"bucketMax":951,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":48,"count":1},{"bucketMax":56,"count":1},{"bucketMax":57,"count":2},{"bucketMax":61,"count":1},{"bucketMax":64,"count":1},{"bucketMax":75,"count":1},{"bucketMax":76,"count":1},{"bucketMax":87,"count":1},{"bucketMax":90,"count":1},{"bucketMax":93,"count":1},{"bucketMax":96,"count":2},{"bucketMax":98,"count":2},{"bucketMax":100,"count":1},{"bucketMax":101,"count":1},{"bucketMax":105,"count":1},{"bucketMax":114,"count":1},{"bucketMax":121,"count":1},{"bucketMax":124,"count":1},{"bucketMax":125,"count":1},{"bucketMax":128,"count":1},{"bucketMax":138,"count":1},{"bucketMax":147,"count":1},{"bucketMax":152,"count":1},{"bucketMax":175,"count":1},{"bucketMax":190,"count":1},{"bucketMax":205,"count":1},{"bucketMax":231,"count":1}]},"Indicator Function":{"cyclesExecutedBySolution":[{"bucketMax":101,"count":1},{"bucketMax":160,"count":1},{"bucketMax":163,"count":1},{"bucketMax":179,"count":1},{"bucketMax":184,"count":1},{"bucketMax":192,"count":1},{"bucketMax":196,"count":1},{"bucketMax":217,"count":1},{"bucketMax":227,"count":1},{"bucketMax":240,"count":1},{"bucketMax":248,"count":1},{"bucketMax":257,"count":1},{"bucketMax":258,"count":1},{"bucketMax":280,"count":1},{"bucketMax":289,"count":1},{"bucketMax":293,"count":1},{"bucketMax":347,"count":1},{"bucketMax":408,"count":1},{"bucketMax":514,"count":1},{"bucketMax":533,"count":1},{"bucketMax":643,"count":1},{"bucketMax":829,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":75,"count":1},{"bucketMax":106,"count":1},{"bucketMax":110,"count":1},{"bucketMax":113,"count":1},{"bucketMax":114,"count":1},{"bucketMax":119,"count":1},{"bucketMax":120,"count":1},{"bucketMax":121,"count":1},{"bucketMax":129,"count":1},{"bucketMax":131,"count":1},{"bucketMax":146,"count":1},{"bucketMax":160,"count":1},{"bucketMax":162,"count":1},{"bucketMax":166,"count":1},{"bucketMax":169,"count":1},{"bucketMax":185,"count":1},{"bucketMax":190,"count":1},{"bucketMax":195,"count":1},{"bucketMax":207,"count":1},{"bucketMax":213,"count":1},{"bucketMax":225,"count":1}]},"Sort":{"cyclesExecutedBySolution":[{"bucketMax":294,"count":1},{"bucketMax":412,"count":1},{"bucketMax":496,"count":1},{"bucketMax":509,"count":1},{"bucketMax":534,"count":1},{"bucketMax":544,"count":1},{"bucketMax":632,"count":2},{"bucketMax":679,"count":1},{"bucketMax":757,"count":1},{"bucketMax":829,"count":1},{"bucketMax":969,"count":1},{"bucketMax":1027,"count":1},{"bucketMax":1113,"count":1},{"bucketMax":1237,"count":1},{"bucketMax":2357,"count":1},{"bucketMax":2518,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":95,"count":1},{"bucketMax":104,"count":1},{"bucketMax":119,"count":1},{"bucketMax":138,"count":1},{"bucketMax":154,"count":1},{"bucketMax":160,"count":1},{"bucketMax":164,"count":1},{"bucketMax":171,"count":1},{"bucketMax":182,"count":1},{"bucketMax":196,"count":1},{"bucketMax":197,"count":1},{"bucketMax":200,"count":1},{"bucketMax":202,"count":1},{"bucketMax":223,"count":1},{"bucketMax":226,"count":1},{"bucketMax":229,"count":1},{"bucketMax":236,"count":1}]},"Mode":{"cyclesExecutedBySolution":[{"bucketMax":730,"count":1},{"bucketMax":868,"count":1},{"bucketMax":930,"count":1},{"bucketMax":957,"count":1},{"bucketMax":1127,"count":1},{"bucketMax":1166,"count":1},{"bucketMax":2058,"count":1},{"bucketMax":2576,"count":1},{"bucketMax":2900,"count":1},{"bucketMax":3540,"count":1},{"bucketMax":3680,"count":1},{"bucketMax":3714,"count":1},{"bucketMax":5801,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":173,"count":1},{"bucketMax":194,"count":2},{"bucketMax":195,"count":1},{"bucketMax":211,"count":2},{"bucketMax":223,"count":1},{"bucketMax":232,"count":1},{"bucketMax":240,"count":1},{"bucketMax":244,"count":1},{"bucketMax":247,"count":1},{"bucketMax":251,"count":2}]},"Characters":{"cyclesExecutedBySolution":[{"bucketMax":2,"count":13}],"memoryBytesAccessedBySolution":[{"bucketMax":7,"count":3},{"bucketMax":9,"count":10}]},"Decimal Digits":{"cyclesExecutedBySolution":[{"bucketMax":11,"count":13}],"memoryBytesAccessedBySolution":[{"bucketMax":12,"count":1},{"bucketMax":14,"count":2},{"bucketMax":15,"count":1},{"bucketMax":16,"count":9}]},"Uppercase":{"cyclesExecutedBySolution":[{"bucketMax":39,"count":2},{"bucketMax":49,"count":1},{"bucketMax":50,"count":2},{"bucketMax":51,"count":1},{"bucketMax":53,"count":1},{"bucketMax":56,"count":1},{"bucketMax":61,"count":2},{"bucketMax":66,"count":2},{"bucketMax":71,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":28,"count":2},{"bucketMax":30,"count":1},{"bucketMax":31,"count":3},{"bucketMax":33,"count":1},{"bucketMax":37,"count":3},{"bucketMax":42,"count":1},{"bucketMax":44,"count":1},{"bucketMax":51,"count":1}]},"Strings":{"cyclesExecutedBySolution":[{"bucketMax":14,"count":2},{"bucketMax":27,"count":1},{"bucketMax":40,"count":10}],"memoryBytesAccessedBySolution":[{"bucketMax":21,"count":2},{"bucketMax":25,"count":1},{"bucketMax":26,"count":10}]},"Tokenizer":{"cyclesExecutedBySolution":[{"bucketMax":182,"count":2},{"bucketMax":183,"count":1},{"bucketMax":189,"count":1},{"bucketMax":225,"count":1},{"bucketMax":226,"count":1},{"bucketMax":227,"count":1},{"bucketMax":234,"count":1},{"bucketMax":241,"count":1},{"bucketMax":252,"count":1},{"bucketMax":270,"count":1},{"bucketMax":325,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":18,"count":1},{"bucketMax":21,"count":1},{"bucketMax":23,"count":1},{"bucketMax":24,"count":1},{"bucketMax":26,"count":1},{"bucketMax":28,"count":1},{"bucketMax":30,"count":2},{"bucketMax":36,"count":3},{"bucketMax":39,"count":1}]},"Parse Decimal":{"cyclesExecutedBySolution":[{"bucketMax":57,"count":1},{"bucketMax":65,"count":1},{"bucketMax":68,"count":1},{"bucketMax":70,"count":1},{"bucketMax":82,"count":1},{"bucketMax":84,"count":1},{"bucketMax":89,"count":1},{"bucketMax":91,"count":1},{"bucketMax":94,"count":1},{"bucketMax":101,"count":1},{"bucketMax":106,"count":1},{"bucketMax":135,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":41,"count":1},{"bucketMax":45,"count":1},{"bucketMax":48,"count":2},{"bucketMax":53,"count":1},{"bucketMax":63,"count":1},{"bucketMax":67,"count":1},{"bucketMax":69,"count":2},{"bucketMax":74,"count":1},{"bucketMax":96,"count":1},{"bucketMax":111,"count":1}]},"Print Decimal":{"cyclesExecutedBySolution":[{"bucketMax":55,"count":1},{"bucketMax":67,"count":1},{"bucketMax":68,"count":1},{"bucketMax":78,"count":1},{"bucketMax":97,"count":1},{"bucketMax":100,"count":1},{"bucketMax":108,"count":1},{"bucketMax":123,"count":1},{"bucketMax":140,"count":1},{"bucketMax":149,"count":1},{"bucketMax":253,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":54,"count":1},{"bucketMax":59,"count":1},{"bucketMax":72,"count":1},{"bucketMax":77,"count":1},{"bucketMax":82,"count":1},{"bucketMax":90,"count":1},{"bucketMax":103,"count":1},{"bucketMax":107,"count":1},{"bucketMax":123,"count":1},{"bucketMax":124,"count":1},{"bucketMax":186,"count":1}]},"Calculator":{"cyclesExecutedBySolution":[{"bucketMax":183,"count":1},{"bucketMax":194,"count":1},{"bucketMax":225,"count":1},{"bucketMax":229,"count":1},{"bucketMax":310,"count":1},{"bucketMax":344,"count":1},{"bucketMax":355,"count":1},{"bucketMax":365,"count":1},{"bucketMax":418,"count":1},{"bucketMax":437,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":106,"count":2},{"bucketMax":111,"count":1},{"bucketMax":136,"count":1},{"bucketMax":149,"count":1},{"bucketMax":152,"count":1},{"bucketMax":166,"count":1},{"bucketMax":169,"count":1},{"bucketMax":195,"count":1},{"bucketMax":221,"count":1}]},"Multi-Line Strings":{"cyclesExecutedBySolution":[{"bucketMax":116,"count":2},{"bucketMax":117,"count":2},{"bucketMax":143,"count":2},{"bucketMax":145,"count":1},{"bucketMax":161,"count":2},{"bucketMax":171,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":18,"count":1},{"bucketMax":21,"count":1},{"bucketMax":23,"count":1},{"bucketMax":24,"count":1},{"bucketMax":27,"count":2},{"bucketMax":28,"count":1},{"bucketMax":29,"count":1},{"bucketMax":34,"count":1},{"bucketMax":36,"count":1}]},"Parse Data Directives":{"cyclesExecutedBySolution":[{"bucketMax":93,"count":1},{"bucketMax":99,"count":1},{"bucketMax":116,"count":1},{"bucketMax":119,"count":1},{"bucketMax":126,"count":1},{"bucketMax":179,"count":1},{"bucketMax":194,"count":1},{"bucketMax":216,"count":1},{"bucketMax":242,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":63,"count":1},{"bucketMax":89,"count":1},{"bucketMax":96,"count":1},{"bucketMax":105,"count":1},{"bucketMax":112,"count":1},{"bucketMax":116,"count":1},{"bucketMax":139,"count":1},{"bucketMax":149,"count":1},{"bucketMax":155,"count":1}]},"Parse Subleq Instructions":{"cyclesExecutedBySolution":[{"bucketMax":255,"count":1},{"bucketMax":311,"count":1},{"bucketMax":329,"count":1},{"bucketMax":380,"count":1},{"bucketMax":488,"count":1},{"bucketMax":572,"count":1},{"bucketMax":584,"count":1},{"bucketMax":965,"count":1},{"bucketMax":1014,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":59,"count":1},{"bucketMax":68,"count":1},{"bucketMax":69,"count":1},{"bucketMax":84,"count":1},{"bucketMax":100,"count":1},{"bucketMax":104,"count":1},{"bucketMax":116,"count":1},{"bucketMax":127,"count":1},{"bucketMax":178,"count":1}]},"Self-Hosting":{"cyclesExecutedBySolution":[{"bucketMax":545,"count":1},{"bucketMax":675,"count":1},{"bucketMax":848,"count":1},{"bucketMax":879,"count":1},{"bucketMax":900,"count":1},{"bucketMax":918,"count":1},{"bucketMax":1082,"count":1},{"bucketMax":1325,"count":1},{"bucketMax":1561,"count":1}],"memoryBytesAccessedBySolution":[{"bucketMax":126,"count":1},{"bucketMax":172,"count":1},{"bucketMax":173,"count":1},{"bucketMax":175,"count":1},{"bucketMax":192,"count":1},{"bucketMax":193,"count":1},{"bucketMax":202,"count":1},{"bucketMax":234,"count":1},{"bucketMax":250,"count":1}]}}};
+const steamStatsCache = decodeStatsCache("ABYC4gEC0gICegJCAmYCVgJUAgwCAgIGAgICBAIuAhgCFAIKAgYKAgQCAgIEAgYSHh1TdWJsZXEgSW5zdHJ1Y3Rpb24gYW5kIE91dHB1dA4aRGF0YSBEaXJlY3RpdmUgYW5kIExvb3BpbmcUEEZpcnN0IEFzc2Vzc21lbnQYCEFkZGl0aW9uRAtTdWJ0cmFjdGlvbkwNU2lnbiBGdW5jdGlvbmoOTXVsdGlwbGljYXRpb26wAQhEaXZpc2lvbqMBDFNlcXVlbmNlIFN1bUkUU2VxdWVuY2UgQ2FyZGluYWxpdHlEEk51bWJlciB0byBTZXF1ZW5jZWITU2VsZi1Nb2RpZnlpbmcgQ29kZQoMU3RhY2sgTWVtb3J5FBBSZXZlcnNlIFNlcXVlbmNlkQEKSW50ZXJsZWF2ZXASSW5kaWNhdG9yIEZ1bmN0aW9uXQRTb3J0UARNb2RlOgpDaGFyYWN0ZXJzCA5EZWNpbWFsIERpZ2l0cwwJVXBwZXJjYXNlJAdTdHJpbmdzDglUb2tlbml6ZXIrDVBhcnNlIERlY2ltYWwuDVByaW50IERlY2ltYWwvCkNhbGN1bGF0b3IrEk11bHRpLUxpbmUgU3RyaW5ncyEVUGFyc2UgRGF0YSBEaXJlY3RpdmVzJxlQYXJzZSBTdWJsZXEgSW5zdHJ1Y3Rpb25zKgxTZWxmLUhvc3RpbmctAgKWCQYCAwgUAoIJBgIDBqACAgIClgUECoQCBgICrgUEAgUMMAT4AwRAAgYCAgUWMAL2AwYIAj4EAhAeHgYEAooDCAwCAggCEhYCBAYCCggCBAICAgICBhQCBgIQHCQChAMEAgICAgoGAgQCCAQCFAgCAgICAgIMBgICBAwEEygUELoCAgYEAgIOBAIEAgIWAhYCAgQCBAICAgQCCAIKBgICAgIEBhEkAgQIAg4CvAIGAgIQBBgCFgICBAICBAYCCAICAgICAgYIBhwcAggGDG4CBgIwAhACKAIKAgwCDgIEAgICAgIIAgYCBgIKBAIEAgICBAQEAgYCBAIGAgIECAI6AhgmAgQMBBACDgQEAiYCCgIcAlACFgICAgwCFgQQAhQEBAIIAgICAgIEBgQCAgYCJgI1DgJMAgoCAgIKAgYCBAIEAgIEAgYCAgIIAgIEBAIGBAQCBAIKAgYCBAIGAgwCBAIGBAQEBAICAg4CBgICAgYCBgIMAgwEDgIEAgQCAgICAgIGAgQKAgIGBgICAgQEBAICAgQCAgICHAIKAiI4AgYCBAIGBgIKBAYCHAICAhICEgIMAgoCCgIeAgYCCAIIAgQCAgIMAgQEBgIGAggCAgIGBAICAggCAgIIAgICAgJWAimcAQoCBgQCAgQEAgIGAg4CDgQGAgYEBgIGAgQEAgIGAgIEBAQCBgIGAgICAgICAgICAgICAgYCAgIIBgIGAgIGBg4CFgIQAhYCCgIUAg4CBgIcAidMBAgEAgoEAgISAhYEAgQCAggCBAIEBAICBAICAgQCAgICAgICBAICAgQCAgQCAgYEAgICAggGBAICAgIEBAQCBgICAgoCAgICAiACGAIUqgEuAgQCBgIGAgwEEgIMAgwEBAYCAgICBAICBAIIAggEBAIIAhYCGAIPLAICAgIGAgICPAYOAgoEGAIGBAYCAgQEAgQGAgICETQCAgQgAg4SAgYGAgImBAICBgIOBBQCBAIQBAIQAgQEJgIQHgICAgICDAQCDAIGAgICTAYKBAICDgIEBAICAgwCAgIaYAIKAgwMAggCBAgCCAQEAgIKChgCGAIEBgICBgICAgIIAgIECAQCBAQCBAICAiICBAQWAhYgAgQEAggCBAICAgYCIAIEAgYCCgIGAgICBgIEAhACAgIEAgYCAgQGBgQCAgIYBkSEAQEeigEDBgoGBBp4Bg4CAgICBAgCFAQaeCeGAgIiBBACEAIIAgoCDgQGAgoCBgIEAgQCBgIEAgICAgIIAg4CCAICAgoEBAICAgQCDAIaAhQCCgICAgQCDAIQBAgCFgIaAkwCSAIoAl4CIHQCAgQOBAQCAgIGBAYCAgIEAgQCBgICAgICAgQCBgICBAQEBAYCAgICAggCAgICAgQEBAIEBAICDgQCAiICEAIb3gECJAQGAhQCOAIOAiICBgICBCACJAICAhwCBgJkBAoCJgIKAiICHAICAgwCUAIYAmYCfALGBgIbYAIQAgIECAIGAhYCAgIWAgYCBgIGBAQEBAICAggCEgIOAgYCAgIGAhQCEgIKAi4CHgIeAjQCFsoBAnYCBgIgAgoCEAIIAioCFAIaAhACEgICAiwCEgIIAmwCegLUAQImAtwBAvQCAhWWAQI+AggCBgICAgoCAgICAhACBAIeAhwCBAIIAgYCIAIKAgoCGAIMAhgCEMwEAuwBAqgBAhoCMgIUArABBF4CnAECkAECmAICdAKsAQL4AQLAEQLCAgIRvgECEgIeAiYCIAIMAggCDgIWAhwCAgIGAgQCKgIGAgYCDgINtAsClAICfAI2AtQCAk4C+A0CjAgCiAUCgAoCmAICRALOIAIK2gICKgQCAiAEGAISAhACCAIGAggEAQQaAg4GBBQBFhoEGAIEBAICAhIJTgQUAgIEAgIEAgYCCgQKBAoCCDgEBAICBgQCCAYKAgQCDgIDHAQaAhoUAyoECAICFAvsAgQCAgwCSAICAgICDgIOAhYCJAJuAgkkAgYCBAICAgQCBAIEBAwGBgIMcgIQAgYCBAIYAgQCCgIEAgYCDgIKAjoCClICCAIGBAoCFAIIAgQECgIsAh4CC24CGAICAhQCJgIGAhACHgIiAhIC0AECC2wCCgIaAgoCCgIQAhoCCAIgAgICfAIK7gICFgI+AggCogECRAIWAhQCagImAgnUAQQKAjICGgIGAhwCBgI0AjQCBugBBAIENAQEAiAEFAIJJAIGAgQCAgIGBAICAgIKAgQCCboBAgwCIgIGAg4CagIeAiwCNAIJfgI0Ag4CEgIOAggCLgIUAgwCCf4DAnACJAJmAtgBAqgBAhgC+gUCYgIJdgISAgICHgIgAggCGAIWAmYCCcIIAoQCAtoCAj4CKgIkAsgCAuYDAtgDAgn8AQJcAgICBAIiAgICEgJAAiAC");
 
 export { steamStatsCache, webStatsCache };
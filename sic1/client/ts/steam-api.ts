@@ -1,5 +1,8 @@
 import { TaskManager, TaskManagerJson, TaskManagerOptions } from "crs_queue";
 import { wrapNativePromise } from "./native-promise-wrapper";
+import { decodeFriendLeaderboardEntries, FriendLeaderboardEntry, toBinaryString } from "./leaderboard-codec";
+
+export { FriendLeaderboardEntry } from "./leaderboard-codec";
 
 interface LeaderboardQueueUpdate {
     id: string;
@@ -8,11 +11,6 @@ interface LeaderboardQueueUpdate {
     details?: number[];
 }
 
-export interface FriendLeaderboardEntry {
-    name: string;
-    score: number;
-}
-
 interface SteamApiJson {
     leaderboardQueue: TaskManagerJson<LeaderboardQueueUpdate>;
 }
@@ -60,7 +58,7 @@ export class SteamApi {
 
     private async runLeaderboardTaskAsync(task: LeaderboardQueueUpdate): Promise<void> {
         const leaderboard = await this.getLeaderboardHandleAsync(task.id);
-        await wrapNativePromise(this.steam.ResolveSetLeaderboardEntry, leaderboard, task.score, task.details);
+        await wrapNativePromise(this.steam.ResolveSetLeaderboardEntry, leaderboard, task.score, task.details ? toBinaryString(task.details) : "");
         this.onPersistRequested();
     }
 
@@ -104,11 +102,7 @@ export class SteamApi {
 
     public async getFriendLeaderboardAsync(leaderboardName: string): Promise<FriendLeaderboardEntry[]> {
         const leaderboard = await this.getLeaderboardHandleAsync(leaderboardName);
-        const flatArray = await wrapNativePromise(this.steam.ResolveGetFriendLeaderboardEntries, leaderboard);
-        const result: FriendLeaderboardEntry[] = [];
-        for (let i = 0; i < flatArray.length; i += 2) {
-            result.push({ name: (flatArray[i] as string), score: (flatArray[i + 1] as number) });
-        }
-        return result;
+        const encodedEntries = await wrapNativePromise(this.steam.ResolveGetFriendLeaderboardEntries, leaderboard);
+        return decodeFriendLeaderboardEntries(encodedEntries);
     }
 }
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Portable (i.e. no Windows dependencies) name lookup tables for IDispatch. The tables are generated from
+// host-objects.idl by build/build-dispatch.ts: each one maps member names (case-insensitively, as ITypeInfo does) to
+// DISPIDs using a perfect hash, i.e. a seed that was chosen so that no two names share a slot. Lookups are then a
+// single hash, a single slot read, and a single string comparison.
+namespace Dispatch {
+    // Note: this must match hashName in build/dispatch-generator.ts
+    template<typename TChar>
+    constexpr uint32_t HashName(const TChar* name, uint32_t seed) {
+        uint32_t hash = 2166136261u ^ seed;
+        for (; *name != 0; name++) {
+            uint32_t c = static_cast<uint32_t>(*name);
+            if (c >= 'A' && c <= 'Z') {
+                c += 'a' - 'A';
+            }
+
+            hash ^= c;
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    template<typename TChar>
+    constexpr bool NamesEqualIgnoringCase(const char* expected, const TChar* name) {
+        for (; *expected != 0; expected++, name++) {
+            uint32_t a = static_cast<uint32_t>(static_cast<unsigned char>(*expected));
+            uint32_t b = static_cast<uint32_t>(*name);
+            if (a >= 'A' && a <= 'Z') {
+                a += 'a' - 'A';
+            }
+            if (b >= 'A' && b <= 'Z') {
+                b += 'a' - 'A';
+            }
+            if (a != b) {
+                return false;
+            }
+        }
+        return *name == 0;
+    }
+
+    struct Member {
+        const char* name;
+        int32_t dispId;
+    };
+
+    // Returned for names that aren't in the table (same value as DISPID_UNKNOWN)
+    constexpr int32_t unknownDispId = -1;
+
+    // Each slot holds an index into members, or -1 if the slot is empty; SlotCount must be a power of two
+    template<size_t MemberCount, size_t SlotCount>
+    struct NameTable {
+        static_assert((SlotCount & (SlotCount - 1)) == 0, "Slot count must be a power of two");
+
+        uint32_t seed;
+        Member members[MemberCount];
+        int8_t slots[SlotCount];
+
+        template<typename TChar>
+        constexpr int32_t Find(const TChar* name) const {
+            const int8_t index = slots[HashName(name, seed) & (SlotCount - 1)];
+            if (index >= 0 && NamesEqualIgnoringCase(members[index].name, name)) {
+                return members[index].dispId;
+            }
+            return unknownDispId;
+        }
+
+        // True if every member is found in its own slot (checked at compile time by the generated code)
+        constexpr bool IsPerfect() const {
+            for (size_t i = 0; i < MemberCount; i++) {
+                if (slots[HashName(members[i].name, seed) & (SlotCount - 1)] != static_cast<int8_t>(i)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+}
@@ -4,6 +4,8 @@
 #include <memory>
 #include <wrl.h>
 #include <wil/com.h>
+#include <wil/resource.h>
+#include "dispatch-table.h"
 
 inline std::wstring GetExecutablePath() {
     wchar_t buffer[MAX_PATH];
@@ -13,6 +15,121 @@ inline std::wstring GetExecutablePath() {
     return executablePath;
 }
 
+namespace Dispatch {
+    // Specialized (in host-objects-dispatch.h, which is generated from host-objects.idl) with a name table and direct
+    // invoke thunks; interfaces without a specialization fall back to the type library
+    template<typename T>
+    struct Traits {
+        static constexpr bool generated = false;
+    };
+
+    // Maps automation types to the VARIANT fields that hold them
+    template<VARTYPE vt>
+    struct VariantType;
+
+    template<>
+    struct VariantType<VT_I4> {
+        using Type = LONG;
+        static Type Load(const VARIANT& v) { return v.lVal; }
+        static void Store(VARIANT& v, Type value) { v.vt = VT_I4; v.lVal = value; }
+    };
+
+    template<>
+    struct VariantType<VT_UI4> {
+        using Type = ULONG;
+        static Type Load(const VARIANT& v) { return v.ulVal; }
+        static void Store(VARIANT& v, Type value) { v.vt = VT_UI4; v.ulVal = value; }
+    };
+
+    template<>
+    struct VariantType<VT_BSTR> {
+        using Type = BSTR;
+        static Type Load(const VARIANT& v) { return v.bstrVal; }
+        static void Store(VARIANT& v, Type value) { v.vt = VT_BSTR; v.bstrVal = value; }
+    };
+
+    template<>
+    struct VariantType<VT_DISPATCH> {
+        using Type = IDispatch*;
+        static Type Load(const VARIANT& v) { return v.pdispVal; }
+        static void Store(VARIANT& v, Type value) { v.vt = VT_DISPATCH; v.pdispVal = value; }
+    };
+
+    template<>
+    struct VariantType<VT_VARIANT> {
+        using Type = VARIANT;
+        static Type Load(const VARIANT& v) { return v; }
+        static void Store(VARIANT& v, Type value) { v = value; }
+    };
+
+    // Note: named arguments aren't supported (other than for property puts), matching the IDL
+    inline HRESULT CheckArguments(const DISPPARAMS* params, UINT count) {
+        const UINT argumentCount = (params != nullptr) ? params->cArgs : 0;
+        if (params != nullptr && params->cNamedArgs != 0) {
+            return DISP_E_NONAMEDARGS;
+        }
+        return (argumentCount == count) ? S_OK : DISP_E_BADPARAMCOUNT;
+    }
+
+    inline HRESULT CheckPropertyPutArguments(const DISPPARAMS* params) {
+        if (params == nullptr || params->cArgs != 1) {
+            return DISP_E_BADPARAMCOUNT;
+        }
+        if (params->cNamedArgs > 1 || (params->cNamedArgs == 1 && params->rgdispidNamedArgs[0] != DISPID_PROPERTYPUT)) {
+            return DISP_E_NONAMEDARGS;
+        }
+        return S_OK;
+    }
+
+    // Reads an [in] argument (by declaration order), coercing it to the declared type the same way the type library
+    // would; arguments that already have the right type are used in place, without copying
+    template<VARTYPE vt>
+    class Argument {
+    public:
+        HRESULT Load(const DISPPARAMS* params, UINT position, UINT* argErr) {
+            // Note: arguments are passed in reverse order
+            const UINT index = params->cArgs - 1 - position;
+            const VARIANT* value = &params->rgvarg[index];
+            if (value->vt == (VT_BYREF | VT_VARIANT)) {
+                value = value->pvarVal;
+            }
+
+            if (vt == VT_VARIANT || value->vt == vt) {
+                m_value = value;
+                return S_OK;
+            }
+
+            if (FAILED(VariantChangeType(m_converted.reset_and_addressof(), value, 0, vt))) {
+                if (argErr != nullptr) {
+                    *argErr = index;
+                }
+                return DISP_E_TYPEMISMATCH;
+            }
+
+            m_value = &m_converted;
+            return S_OK;
+        }
+
+        typename VariantType<vt>::Type Get() const {
+            return VariantType<vt>::Load(*m_value);
+        }
+
+    private:
+        const VARIANT* m_value = nullptr;
+        wil::unique_variant m_converted;
+    };
+
+    // Takes ownership of the value, releasing it if the caller didn't ask for a result
+    template<VARTYPE vt>
+    void SetResult(VARIANT* result, typename VariantType<vt>::Type value) {
+        wil::unique_variant owner;
+        VariantType<vt>::Store(*owner.reset_and_addressof(), value);
+        if (result != nullptr) {
+            *result = owner.release();
+        }
+    }
+}
+
 template<typename T>
 class Dispatchable: public Microsoft::WRL::RuntimeClass<
     Microsoft::WRL::RuntimeClassFlags<Microsoft::WRL::ClassicCom>,
@@ -37,16 +154,42 @@ public:
     CATCH_RETURN();
 
     STDMETHODIMP GetIDsOfNames(REFIID riid, LPOLESTR* rgszNames, UINT cNames, LCID lcid, DISPID* rgDispId) override {
+        if constexpr (Dispatch::Traits<T>::generated) {
+            // Note: parameter names (i.e. cNames > 1) are only supported by the type library
+            if (cNames == 1) {
+                const DISPID dispId = Dispatch::Traits<T>::names.Find(rgszNames[0]);
+                if (dispId != DISPID_UNKNOWN) {
+                    rgDispId[0] = dispId;
+                    return S_OK;
+                }
+            }
+        }
+
         wil::com_ptr<ITypeInfo> typeInfo;
         RETURN_IF_FAILED(GetTypeInfo(0, lcid, &typeInfo));
         return typeInfo->GetIDsOfNames(rgszNames, cNames, rgDispId);
     }
 
-    STDMETHODIMP Invoke(DISPID dispIdMember, REFIID riid, LCID lcid, WORD wFlags, DISPPARAMS* pDispParams, VARIANT* pVarResult, EXCEPINFO* pExcepInfo, UINT* puArgErr) override {
+    STDMETHODIMP Invoke(DISPID dispIdMember, REFIID riid, LCID lcid, WORD wFlags, DISPPARAMS* pDispParams, VARIANT* pVarResult, EXCEPINFO* pExcepInfo, UINT* puArgErr) override try {
+        if constexpr (Dispatch::Traits<T>::generated) {
+            if (Dispatch::Traits<T>::Contains(dispIdMember)) {
+                const HRESULT hr = Dispatch::Traits<T>::Invoke(static_cast<T*>(this), dispIdMember, wFlags, pDispParams, pVarResult, puArgErr);
+
+                // Like ITypeInfo::Invoke, report failures from the member itself (as opposed to dispatch errors) as exceptions
+                if (FAILED(hr) && HRESULT_FACILITY(hr) != FACILITY_DISPATCH && pExcepInfo != nullptr) {
+                    *pExcepInfo = {};
+                    pExcepInfo->scode = hr;
+                    return DISP_E_EXCEPTION;
+                }
+                return hr;
+            }
+        }
+
         wil::com_ptr<ITypeInfo> typeInfo;
         RETURN_IF_FAILED(GetTypeInfo(0, lcid, &typeInfo));
         return typeInfo->Invoke(this, dispIdMember, wFlags, pDispParams, pVarResult, pExcepInfo, puArgErr);
     }
+    CATCH_RETURN();
 
 private:
     wil::com_ptr<ITypeLib> m_typeLib;
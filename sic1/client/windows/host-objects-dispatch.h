@@ -0,0 +1,289 @@
+#pragma once
+
+// Generated from host-objects.idl by build/build-dispatch.ts (npm run build:dispatch); do not edit by hand
+
+#include "host-objects_h.h"
+#include "dispatchable.h"
+
+namespace Dispatch {
+    template<>
+    struct Traits<IWebViewWindow> {
+        static constexpr bool generated = true;
+
+        static constexpr NameTable<10, 32> names = {
+            4u,
+            {
+                { "Fullscreen", 1 },
+                { "LocalStorageDataString", 2 },
+                { "OnClosing", 3 },
+                { "IsDebuggerPresent", 4 },
+                { "GetPresentationSetting", 5 },
+                { "SetPresentationSetting", 6 },
+                { "ResolvePersistLocalStorageChanges", 7 },
+                { "ResolvePersistPresentationSettings", 8 },
+                { "OpenManual", 9 },
+                { "GetMetrics", 10 },
+            },
+            { 1, -1, -1, -1, 9, 5, 6, -1, -1, 4, -1, 2, 7, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, 8, 0, -1, -1, -1 },
+        };
+
+        static constexpr bool Contains(DISPID dispId) {
+            return dispId >= 1 && dispId <= 10;
+        }
+
+        static HRESULT Invoke(IWebViewWindow* object, DISPID dispId, WORD flags, DISPPARAMS* params, VARIANT* result, UINT* argErr) {
+            switch (dispId) {
+            case 1: // Fullscreen
+                if ((flags & DISPATCH_PROPERTYGET) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 0));
+                    BOOL fullscreenValue = FALSE;
+                    RETURN_IF_FAILED(object->get_Fullscreen(&fullscreenValue));
+                    SetResult<VT_I4>(result, fullscreenValue);
+                    return S_OK;
+                }
+                if ((flags & (DISPATCH_PROPERTYPUT | DISPATCH_PROPERTYPUTREF)) != 0) {
+                    RETURN_IF_FAILED(CheckPropertyPutArguments(params));
+                    Argument<VT_I4> fullscreenArgument;
+                    RETURN_IF_FAILED(fullscreenArgument.Load(params, 0, argErr));
+                    return object->put_Fullscreen(fullscreenArgument.Get());
+                }
+                break;
+
+            case 2: // LocalStorageDataString
+                if ((flags & DISPATCH_PROPERTYGET) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 0));
+                    wil::unique_bstr dataValue;
+                    RETURN_IF_FAILED(object->get_LocalStorageDataString(dataValue.put()));
+                    SetResult<VT_BSTR>(result, dataValue.release());
+                    return S_OK;
+                }
+                if ((flags & (DISPATCH_PROPERTYPUT | DISPATCH_PROPERTYPUTREF)) != 0) {
+                    RETURN_IF_FAILED(CheckPropertyPutArguments(params));
+                    Argument<VT_BSTR> dataArgument;
+                    RETURN_IF_FAILED(dataArgument.Load(params, 0, argErr));
+                    return object->put_LocalStorageDataString(dataArgument.Get());
+                }
+                break;
+
+            case 3: // OnClosing
+                if ((flags & DISPATCH_PROPERTYGET) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 0));
+                    wil::com_ptr<IDispatch> callbackValue;
+                    RETURN_IF_FAILED(object->get_OnClosing(callbackValue.put()));
+                    SetResult<VT_DISPATCH>(result, callbackValue.detach());
+                    return S_OK;
+                }
+                if ((flags & (DISPATCH_PROPERTYPUT | DISPATCH_PROPERTYPUTREF)) != 0) {
+                    RETURN_IF_FAILED(CheckPropertyPutArguments(params));
+                    Argument<VT_DISPATCH> callbackArgument;
+                    RETURN_IF_FAILED(callbackArgument.Load(params, 0, argErr));
+                    return object->put_OnClosing(callbackArgument.Get());
+                }
+                break;
+
+            case 4: // IsDebuggerPresent
+                if ((flags & DISPATCH_PROPERTYGET) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 0));
+                    BOOL debuggerPresentValue = FALSE;
+                    RETURN_IF_FAILED(object->get_IsDebuggerPresent(&debuggerPresentValue));
+                    SetResult<VT_I4>(result, debuggerPresentValue);
+                    return S_OK;
+                }
+                break;
+
+            case 5: // GetPresentationSetting
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 1));
+                    Argument<VT_BSTR> nameArgument;
+                    RETURN_IF_FAILED(nameArgument.Load(params, 0, argErr));
+                    wil::unique_variant dataValue;
+                    RETURN_IF_FAILED(object->GetPresentationSetting(nameArgument.Get(), dataValue.addressof()));
+                    SetResult<VT_VARIANT>(result, dataValue.release());
+                    return S_OK;
+                }
+                break;
+
+            case 6: // SetPresentationSetting
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 2));
+                    Argument<VT_BSTR> nameArgument;
+                    RETURN_IF_FAILED(nameArgument.Load(params, 0, argErr));
+                    Argument<VT_VARIANT> dataArgument;
+                    RETURN_IF_FAILED(dataArgument.Load(params, 1, argErr));
+                    return object->SetPresentationSetting(nameArgument.Get(), dataArgument.Get());
+                }
+                break;
+
+            case 7: // ResolvePersistLocalStorageChanges
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 4));
+                    Argument<VT_VARIANT> resolveArgument;
+                    RETURN_IF_FAILED(resolveArgument.Load(params, 0, argErr));
+                    Argument<VT_VARIANT> rejectArgument;
+                    RETURN_IF_FAILED(rejectArgument.Load(params, 1, argErr));
+                    Argument<VT_UI4> sequenceArgument;
+                    RETURN_IF_FAILED(sequenceArgument.Load(params, 2, argErr));
+                    Argument<VT_BSTR> changesArgument;
+                    RETURN_IF_FAILED(changesArgument.Load(params, 3, argErr));
+                    return object->ResolvePersistLocalStorageChanges(resolveArgument.Get(), rejectArgument.Get(), sequenceArgument.Get(), changesArgument.Get());
+                }
+                break;
+
+            case 8: // ResolvePersistPresentationSettings
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 2));
+                    Argument<VT_VARIANT> resolveArgument;
+                    RETURN_IF_FAILED(resolveArgument.Load(params, 0, argErr));
+                    Argument<VT_VARIANT> rejectArgument;
+                    RETURN_IF_FAILED(rejectArgument.Load(params, 1, argErr));
+                    return object->ResolvePersistPresentationSettings(resolveArgument.Get(), rejectArgument.Get());
+                }
+                break;
+
+            case 9: // OpenManual
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 0));
+                    return object->OpenManual();
+                }
+                break;
+
+            case 10: // GetMetrics
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 0));
+                    wil::unique_bstr jsonValue;
+                    RETURN_IF_FAILED(object->GetMetrics(jsonValue.put()));
+                    SetResult<VT_BSTR>(result, jsonValue.release());
+                    return S_OK;
+                }
+                break;
+
+            default:
+                break;
+            }
+            return DISP_E_MEMBERNOTFOUND;
+        }
+    };
+
+    static_assert(Traits<IWebViewWindow>::names.IsPerfect(), "Name table for IWebViewWindow has collisions");
+
+    template<>
+    struct Traits<ISteam> {
+        static constexpr bool generated = true;
+
+        static constexpr NameTable<7, 32> names = {
+            11u,
+            {
+                { "UserName", 1 },
+                { "ResolveGetLeaderboard", 2 },
+                { "ResolveSetLeaderboardEntry", 3 },
+                { "ResolveGetFriendLeaderboardEntries", 4 },
+                { "GetAchievement", 5 },
+                { "SetAchievement", 6 },
+                { "ResolveStoreAchievements", 7 },
+            },
+            { -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6, -1, 1, -1, 2, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, 0, -1, -1, 5, -1, -1 },
+        };
+
+        static constexpr bool Contains(DISPID dispId) {
+            return dispId >= 1 && dispId <= 7;
+        }
+
+        static HRESULT Invoke(ISteam* object, DISPID dispId, WORD flags, DISPPARAMS* params, VARIANT* result, UINT* argErr) {
+            switch (dispId) {
+            case 1: // UserName
+                if ((flags & DISPATCH_PROPERTYGET) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 0));
+                    wil::unique_bstr stringResultValue;
+                    RETURN_IF_FAILED(object->get_UserName(stringResultValue.put()));
+                    SetResult<VT_BSTR>(result, stringResultValue.release());
+                    return S_OK;
+                }
+                break;
+
+            case 2: // ResolveGetLeaderboard
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 3));
+                    Argument<VT_VARIANT> resolveArgument;
+                    RETURN_IF_FAILED(resolveArgument.Load(params, 0, argErr));
+                    Argument<VT_VARIANT> rejectArgument;
+                    RETURN_IF_FAILED(rejectArgument.Load(params, 1, argErr));
+                    Argument<VT_BSTR> leaderboardNameArgument;
+                    RETURN_IF_FAILED(leaderboardNameArgument.Load(params, 2, argErr));
+                    return object->ResolveGetLeaderboard(resolveArgument.Get(), rejectArgument.Get(), leaderboardNameArgument.Get());
+                }
+                break;
+
+            case 3: // ResolveSetLeaderboardEntry
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 5));
+                    Argument<VT_VARIANT> resolveArgument;
+                    RETURN_IF_FAILED(resolveArgument.Load(params, 0, argErr));
+                    Argument<VT_VARIANT> rejectArgument;
+                    RETURN_IF_FAILED(rejectArgument.Load(params, 1, argErr));
+                    Argument<VT_UI4> jsHandleArgument;
+                    RETURN_IF_FAILED(jsHandleArgument.Load(params, 2, argErr));
+                    Argument<VT_I4> scoreArgument;
+                    RETURN_IF_FAILED(scoreArgument.Load(params, 3, argErr));
+                    Argument<VT_BSTR> detailBytesArgument;
+                    RETURN_IF_FAILED(detailBytesArgument.Load(params, 4, argErr));
+                    return object->ResolveSetLeaderboardEntry(resolveArgument.Get(), rejectArgument.Get(), jsHandleArgument.Get(), scoreArgument.Get(), detailBytesArgument.Get());
+                }
+                break;
+
+            case 4: // ResolveGetFriendLeaderboardEntries
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 3));
+                    Argument<VT_VARIANT> resolveArgument;
+                    RETURN_IF_FAILED(resolveArgument.Load(params, 0, argErr));
+                    Argument<VT_VARIANT> rejectArgument;
+                    RETURN_IF_FAILED(rejectArgument.Load(params, 1, argErr));
+                    Argument<VT_UI4> jsHandleArgument;
+                    RETURN_IF_FAILED(jsHandleArgument.Load(params, 2, argErr));
+                    return object->ResolveGetFriendLeaderboardEntries(resolveArgument.Get(), rejectArgument.Get(), jsHandleArgument.Get());
+                }
+                break;
+
+            case 5: // GetAchievement
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 1));
+                    Argument<VT_BSTR> achievementIdArgument;
+                    RETURN_IF_FAILED(achievementIdArgument.Load(params, 0, argErr));
+                    BOOL achievedValue = FALSE;
+                    RETURN_IF_FAILED(object->GetAchievement(achievementIdArgument.Get(), &achievedValue));
+                    SetResult<VT_I4>(result, achievedValue);
+                    return S_OK;
+                }
+                break;
+
+            case 6: // SetAchievement
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 1));
+                    Argument<VT_BSTR> achievementIdArgument;
+                    RETURN_IF_FAILED(achievementIdArgument.Load(params, 0, argErr));
+                    BOOL newlyAchievedValue = FALSE;
+                    RETURN_IF_FAILED(object->SetAchievement(achievementIdArgument.Get(), &newlyAchievedValue));
+                    SetResult<VT_I4>(result, newlyAchievedValue);
+                    return S_OK;
+                }
+                break;
+
+            case 7: // ResolveStoreAchievements
+                if ((flags & DISPATCH_METHOD) != 0) {
+                    RETURN_IF_FAILED(CheckArguments(params, 2));
+                    Argument<VT_VARIANT> resolveArgument;
+                    RETURN_IF_FAILED(resolveArgument.Load(params, 0, argErr));
+                    Argument<VT_VARIANT> rejectArgument;
+                    RETURN_IF_FAILED(rejectArgument.Load(params, 1, argErr));
+                    return object->ResolveStoreAchievements(resolveArgument.Get(), rejectArgument.Get());
+                }
+                break;
+
+            default:
+                break;
+            }
+            return DISP_E_MEMBERNOTFOUND;
+        }
+    };
+
+    static_assert(Traits<ISteam>::names.IsPerfect(), "Name table for ISteam has collisions");
+}
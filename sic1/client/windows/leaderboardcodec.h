@@ -0,0 +1,91 @@
+#pragma once
+
+// Portable (i.e. no Windows dependencies) binary encoding for leaderboard data passed to and from the page (see
+// ts/leaderboard-codec.ts for the other side). Blobs cross the host object bridge as "binary strings", i.e. strings with
+// one byte per character, so that a whole friend list or program is a single string allocation instead of an array of
+// VARIANTs.
+//
+// Friend leaderboard entries are encoded as a uint32 entry count followed by, for each entry: int32 score, uint16 name
+// length (in bytes), and then the UTF-8 name; all integers are little-endian.
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace LeaderboardCodec {
+    // Steam limits score details to 64 int32s
+    constexpr size_t maxDetailBytes = 256;
+    constexpr size_t maxNameBytes = 0xffff;
+
+    namespace Internal {
+        // Truncates to at most maxNameBytes, without splitting a UTF-8 sequence
+        inline size_t GetEncodedNameLength(std::string_view name) {
+            if (name.size() <= maxNameBytes) {
+                return name.size();
+            }
+
+            size_t length = maxNameBytes;
+            while (length > 0 && (static_cast<unsigned char>(name[length]) & 0xc0) == 0x80) {
+                length--;
+            }
+            return length;
+        }
+
+        template<typename TChar>
+        TChar* WriteUInt(TChar* buffer, uint32_t value, size_t byteCount) {
+            for (size_t i = 0; i < byteCount; i++) {
+                *buffer++ = static_cast<TChar>((value >> (8 * i)) & 0xff);
+            }
+            return buffer;
+        }
+    }
+
+    // Rows must have "name" (UTF-8, convertible to std::string_view) and "score" members
+    template<typename TRows>
+    size_t GetEncodedEntriesSize(const TRows& rows) {
+        size_t size = 4;
+        for (const auto& row : rows) {
+            size += 4 + 2 + Internal::GetEncodedNameLength(row.name);
+        }
+        return size;
+    }
+
+    // Writes exactly GetEncodedEntriesSize(rows) characters (one per byte) to the buffer
+    template<typename TRows, typename TChar>
+    void EncodeEntries(const TRows& rows, TChar* buffer) {
+        buffer = Internal::WriteUInt(buffer, static_cast<uint32_t>(rows.size()), 4);
+        for (const auto& row : rows) {
+            const std::string_view name(row.name);
+            const size_t nameLength = Internal::GetEncodedNameLength(name);
+            buffer = Internal::WriteUInt(buffer, static_cast<uint32_t>(row.score), 4);
+            buffer = Internal::WriteUInt(buffer, static_cast<uint32_t>(nameLength), 2);
+            for (size_t i = 0; i < nameLength; i++) {
+                *buffer++ = static_cast<TChar>(static_cast<unsigned char>(name[i]));
+            }
+        }
+    }
+
+    // Packs a binary string of score detail bytes into little-endian int32s (the last one zero-padded), as expected by
+    // Steam; returns false (leaving the output empty) if the input is too long or contains a character above 0xff
+    template<typename TChar>
+    bool TryPackDetails(std::basic_string_view<TChar> bytes, std::vector<int32_t>& packed) {
+        packed.clear();
+        if (bytes.size() > maxDetailBytes) {
+            return false;
+        }
+
+        packed.resize((bytes.size() + 3) / 4);
+        for (size_t i = 0; i < bytes.size(); i++) {
+            const uint32_t byte = static_cast<uint32_t>(bytes[i]);
+            if (byte > 0xff) {
+                packed.clear();
+                return false;
+            }
+
+            const uint32_t word = static_cast<uint32_t>(packed[i / 4]) | (byte << (8 * (i % 4)));
+            packed[i / 4] = static_cast<int32_t>(word);
+        }
+        return true;
+    }
+}
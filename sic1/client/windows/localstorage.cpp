@@ -0,0 +1,284 @@
+#include "localstorage.h"
+
+using namespace LocalStorage;
+
+namespace {
+    class Parser {
+    public:
+        explicit Parser(std::wstring_view json) : m_json(json), m_position(0) {
+        }
+
+        bool TryParseObject(Changes& changes, bool allowNull) {
+            if (!TryConsume(L'{')) {
+                return false;
+            }
+
+            SkipWhitespace();
+            if (TryConsume(L'}')) {
+                return AtEnd();
+            }
+
+            do {
+                std::wstring key;
+                if (!TryParseString(key) || !TryConsume(L':')) {
+                    return false;
+                }
+
+                SkipWhitespace();
+                if (allowNull && m_json.substr(m_position, 4) == L"null") {
+                    m_position += 4;
+                    changes[key] = std::nullopt;
+                }
+                else {
+                    std::wstring value;
+                    if (!TryParseString(value)) {
+                        return false;
+                    }
+                    changes[key] = std::move(value);
+                }
+            } while (TryConsume(L','));
+
+            return TryConsume(L'}') && AtEnd();
+        }
+
+    private:
+        std::wstring_view m_json;
+        size_t m_position;
+
+        void SkipWhitespace() {
+            while (m_position < m_json.size() && (m_json[m_position] == L' ' || m_json[m_position] == L'\t' || m_json[m_position] == L'\r' || m_json[m_position] == L'\n')) {
+                m_position++;
+            }
+        }
+
+        bool TryConsume(wchar_t c) {
+            SkipWhitespace();
+            if (m_position < m_json.size() && m_json[m_position] == c) {
+                m_position++;
+                return true;
+            }
+            return false;
+        }
+
+        bool AtEnd() {
+            SkipWhitespace();
+            return m_position == m_json.size();
+        }
+
+        static int GetHexDigitValue(wchar_t c) {
+            if (c >= L'0' && c <= L'9') {
+                return c - L'0';
+            }
+            if (c >= L'a' && c <= L'f') {
+                return c - L'a' + 10;
+            }
+            if (c >= L'A' && c <= L'F') {
+                return c - L'A' + 10;
+            }
+            return -1;
+        }
+
+        bool TryParseString(std::wstring& result) {
+            if (!TryConsume(L'"')) {
+                return false;
+            }
+
+            while (m_position < m_json.size()) {
+                // Copy runs of unescaped characters all at once
+                const size_t runStart = m_position;
+                while (m_position < m_json.size() && m_json[m_position] != L'"' && m_json[m_position] != L'\\' && m_json[m_position] >= 0x20) {
+                    m_position++;
+                }
+                result.append(m_json.substr(runStart, m_position - runStart));
+
+                if (m_position >= m_json.size() || m_json[m_position] < 0x20) {
+                    return false;
+                }
+
+                const wchar_t c = m_json[m_position++];
+                if (c == L'"') {
+                    return true;
+                }
+
+                // Escape sequence
+                if (m_position >= m_json.size()) {
+                    return false;
+                }
+
+                switch (m_json[m_position++]) {
+                case L'"': result.push_back(L'"'); break;
+                case L'\\': result.push_back(L'\\'); break;
+                case L'/': result.push_back(L'/'); break;
+                case L'b': result.push_back(L'\b'); break;
+                case L'f': result.push_back(L'\f'); break;
+                case L'n': result.push_back(L'\n'); break;
+                case L'r': result.push_back(L'\r'); break;
+                case L't': result.push_back(L'\t'); break;
+
+                case L'u': {
+                    if (m_position + 4 > m_json.size()) {
+                        return false;
+                    }
+
+                    // Note: surrogate pairs arrive as two separate escapes, which naturally recombine in UTF-16
+                    unsigned int codeUnit = 0;
+                    for (int i = 0; i < 4; i++) {
+                        const int digit = GetHexDigitValue(m_json[m_position++]);
+                        if (digit < 0) {
+                            return false;
+                        }
+                        codeUnit = (codeUnit << 4) | static_cast<unsigned int>(digit);
+                    }
+                    result.push_back(static_cast<wchar_t>(codeUnit));
+                }
+                break;
+
+                default:
+                    return false;
+                }
+            }
+            return false;
+        }
+    };
+
+    bool IsHighSurrogate(wchar_t c) {
+        return c >= 0xd800 && c <= 0xdbff;
+    }
+
+    bool IsLowSurrogate(wchar_t c) {
+        return c >= 0xdc00 && c <= 0xdfff;
+    }
+
+    void AppendEscapedCodeUnit(std::wstring& json, unsigned int c) {
+        static const wchar_t hexDigits[] = L"0123456789abcdef";
+        json.append(L"\\u");
+        for (int shift = 12; shift >= 0; shift -= 4) {
+            json.push_back(hexDigits[(c >> shift) & 0xf]);
+        }
+    }
+
+    void AppendString(std::wstring& json, const std::wstring& value) {
+        json.push_back(L'"');
+        for (size_t i = 0; i < value.size(); i++) {
+            const wchar_t c = value[i];
+            switch (c) {
+            case L'"': json.append(L"\\\""); break;
+            case L'\\': json.append(L"\\\\"); break;
+            case L'\b': json.append(L"\\b"); break;
+            case L'\f': json.append(L"\\f"); break;
+            case L'\n': json.append(L"\\n"); break;
+            case L'\r': json.append(L"\\r"); break;
+            case L'\t': json.append(L"\\t"); break;
+
+            default:
+                if (c < 0x20) {
+                    AppendEscapedCodeUnit(json, c);
+                }
+                else if (IsHighSurrogate(c) && i + 1 < value.size() && IsLowSurrogate(value[i + 1])) {
+                    json.push_back(c);
+                    json.push_back(value[++i]);
+                }
+                else if (IsHighSurrogate(c) || IsLowSurrogate(c)) {
+                    AppendEscapedCodeUnit(json, c);
+                }
+                else {
+                    json.push_back(c);
+                }
+                break;
+            }
+        }
+        json.push_back(L'"');
+    }
+}
+
+bool LocalStorage::TryParse(std::wstring_view json, Changes& changes, bool allowNull) {
+    changes.clear();
+    Parser parser(json);
+    if (!parser.TryParseObject(changes, allowNull)) {
+        changes.clear();
+        return false;
+    }
+    return true;
+}
+
+std::wstring LocalStorage::Serialize(const Entries& entries) {
+    size_t sizeEstimate = 2;
+    for (const auto& entry : entries) {
+        sizeEstimate += entry.first.size() + entry.second.size() + 6;
+    }
+
+    std::wstring json;
+    json.reserve(sizeEstimate);
+    json.push_back(L'{');
+    bool first = true;
+    for (const auto& entry : entries) {
+        if (!first) {
+            json.push_back(L',');
+        }
+        first = false;
+
+        AppendString(json, entry.first);
+        json.push_back(L':');
+        AppendString(json, entry.second);
+    }
+    json.push_back(L'}');
+    return json;
+}
+
+bool Store::TryLoad(std::wstring_view json) {
+    Changes changes;
+    const bool empty = json.find_first_not_of(L" \t\r\n") == std::wstring_view::npos;
+    const bool parsed = !empty && TryParse(json, changes, false);
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_entries.clear();
+    for (auto& change : changes) {
+        m_entries.emplace(change.first, std::move(*change.second));
+    }
+
+    m_synchronized = empty || parsed;
+    m_sequence = 0;
+    m_version++;
+    return m_synchronized;
+}
+
+bool Store::TryApplyChanges(uint32_t sequence, std::wstring_view changesJson) {
+    // Parse before taking the lock, since this is the expensive part
+    Changes changes;
+    if (!TryParse(changesJson, changes, true)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (sequence == 0) {
+        m_entries.clear();
+    }
+    else if (!m_synchronized || sequence != m_sequence + 1) {
+        return false;
+    }
+
+    for (auto& change : changes) {
+        if (change.second) {
+            m_entries[change.first] = std::move(*change.second);
+        }
+        else {
+            m_entries.erase(change.first);
+        }
+    }
+
+    m_synchronized = true;
+    m_sequence = sequence;
+    m_version++;
+    return true;
+}
+
+std::wstring Store::Serialize(uint64_t* version) const {
+    std::lock_guard<std::mutex> lock(m_lock);
+    *version = m_version;
+    return LocalStorage::Serialize(m_entries);
+}
+
+uint64_t Store::GetVersion() const {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_version;
+}
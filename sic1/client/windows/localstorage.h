@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Portable (i.e. no Windows dependencies) host-side copy of the page's localStorage. The page sends only the keys that
+// changed since its last update (see ts/platform.ts), tagged with a sequence number; the host applies them here and
+// persists the merged result, so an edit to a single puzzle doesn't require re-sending every other puzzle's data.
+//
+// The saved file format is unchanged: a JSON object mapping keys to (string) values.
+namespace LocalStorage {
+    using Entries = std::map<std::wstring, std::wstring>;
+
+    // Changes map keys to new values, or to nullopt for removed keys
+    using Changes = std::map<std::wstring, std::optional<std::wstring>>;
+
+    // Parses a JSON object whose values are all strings (or null, when allowNull is set)
+    bool TryParse(std::wstring_view json, Changes& changes, bool allowNull);
+
+    // Note: like JSON.stringify, unpaired surrogates are escaped, so that the output is always valid UTF-16
+    std::wstring Serialize(const Entries& entries);
+
+    class Store {
+    public:
+        // Replaces the contents with previously-saved data (an empty string means no data); on failure, the store is
+        // left empty and only accepts a full update (sequence 0) until one arrives
+        bool TryLoad(std::wstring_view json);
+
+        // Applies changes that follow the last applied sequence number. Sequence 0 is a full update that replaces the
+        // contents entirely (and restarts the sequence). Returns false (without changing anything) on an out-of-order
+        // sequence number or malformed changes; the page responds by sending a full update.
+        bool TryApplyChanges(uint32_t sequence, std::wstring_view changesJson);
+
+        // Returns the serialized contents, along with a version number that increases with each applied change (so
+        // writers can skip saving a version that was already saved)
+        std::wstring Serialize(uint64_t* version) const;
+        uint64_t GetVersion() const;
+
+    private:
+        mutable std::mutex m_lock;
+        Entries m_entries;
+        bool m_synchronized = true;
+        uint32_t m_sequence = 0;
+        uint64_t m_version = 0;
+    };
+}
@@ -0,0 +1,147 @@
+#include "logger.h"
+
+using namespace Logging;
+
+Logger::Logger(LoggerOptions options)
+    : m_options(std::move(options)),
+    m_queue(m_options.queueCapacity),
+    m_stopping(false),
+    m_exiting(false),
+    m_activeWriters(0),
+    m_signaled(false),
+    m_droppedSinceLastReport(0),
+    m_droppedTotal(0),
+    m_fileSize(0) {
+    m_thread = std::thread([this]() { Run(); });
+}
+
+Logger::~Logger() {
+    Stop();
+}
+
+bool Logger::Write(std::string line) {
+    // Note: Stop waits for active writers, so a line is either rejected here or included in the final batch
+    m_activeWriters.fetch_add(1, std::memory_order_seq_cst);
+    const bool queued = !m_stopping.load(std::memory_order_seq_cst) && m_queue.TryEnqueue(line);
+    m_activeWriters.fetch_sub(1, std::memory_order_release);
+    if (!queued) {
+        m_droppedSinceLastReport.fetch_add(1, std::memory_order_relaxed);
+        m_droppedTotal.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Only wake the writer for the first line of a batch. Note: the lock isn't taken here (so callers never block), which
+    // means a wake-up can occasionally be missed; the writer's periodic flush bounds the resulting delay.
+    if (!m_signaled.exchange(true, std::memory_order_acq_rel)) {
+        m_wake.notify_one();
+    }
+    return true;
+}
+
+void Logger::Stop() {
+    std::lock_guard<std::mutex> stopLock(m_stopLock);
+    if (m_thread.joinable()) {
+        // Reject new lines, then wait for lines that are already being queued (this is brief, since Write never blocks)
+        m_stopping.store(true, std::memory_order_seq_cst);
+        while (m_activeWriters.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_wakeLock);
+            m_exiting.store(true, std::memory_order_relaxed);
+        }
+        m_wake.notify_one();
+        m_thread.join();
+    }
+}
+
+void Logger::Run() {
+    std::string batch;
+    std::string line;
+    bool exiting = false;
+    do {
+        {
+            std::unique_lock<std::mutex> lock(m_wakeLock);
+            m_wake.wait_for(lock, m_options.flushInterval, [this]() {
+                return m_signaled.load(std::memory_order_relaxed) || m_exiting.load(std::memory_order_relaxed);
+            });
+            exiting = m_exiting.load(std::memory_order_relaxed);
+        }
+
+        m_signaled.store(false, std::memory_order_release);
+
+        // Drain everything that's queued into a single write
+        batch.clear();
+        while (m_queue.TryDequeue(line)) {
+            batch.append(line);
+            batch.push_back('\n');
+        }
+
+        const uint64_t dropped = m_droppedSinceLastReport.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) {
+            batch.append("[").append(std::to_string(dropped)).append(" log message(s) dropped]\n");
+        }
+
+        if (!batch.empty()) {
+            WriteBatch(batch);
+        }
+    } while (!exiting);
+
+    m_file.close();
+}
+
+void Logger::OpenFile() {
+    std::error_code error;
+    std::filesystem::create_directories(m_options.path.parent_path(), error);
+
+    m_file.open(m_options.path, std::ios::out | std::ios::binary | std::ios::app);
+    m_fileSize = std::filesystem::file_size(m_options.path, error);
+    if (error) {
+        m_fileSize = 0;
+    }
+}
+
+std::filesystem::path Logger::GetRotatedPath(unsigned int index) const {
+    // E.g. log.txt -> log.1.txt
+    std::filesystem::path fileName = m_options.path.stem();
+    fileName += "." + std::to_string(index);
+    fileName += m_options.path.extension();
+    return m_options.path.parent_path() / fileName;
+}
+
+void Logger::RotateFile() {
+    m_file.close();
+
+    // Note: failures are ignored; in the worst case, the current log just keeps growing
+    std::error_code error;
+    if (m_options.maxRotatedFiles > 0) {
+        std::filesystem::remove(GetRotatedPath(m_options.maxRotatedFiles), error);
+        for (unsigned int i = m_options.maxRotatedFiles - 1; i >= 1; i--) {
+            std::filesystem::rename(GetRotatedPath(i), GetRotatedPath(i + 1), error);
+        }
+        std::filesystem::rename(m_options.path, GetRotatedPath(1), error);
+    }
+    else {
+        std::filesystem::remove(m_options.path, error);
+    }
+
+    OpenFile();
+}
+
+void Logger::WriteBatch(const std::string& batch) {
+    if (!m_file.is_open()) {
+        OpenFile();
+    }
+
+    // Note: this also applies to the first batch, in case a previous session left a large log behind
+    if (m_fileSize > 0 && m_fileSize + batch.size() > m_options.maxFileBytes) {
+        RotateFile();
+    }
+
+    if (m_file.is_open()) {
+        m_file.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+        m_file.flush();
+        m_fileSize += batch.size();
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Portable (i.e. no Windows dependencies) asynchronous logger. Callers push lines into a lock-free bounded queue and a
+// background thread batches them into a log file that stays open (and is rotated once it grows too large). When the
+// queue is full, lines are counted and dropped instead of blocking the caller.
+namespace Logging {
+    // Bounded multi-producer queue (after Dmitry Vyukov's design: each cell carries a sequence number that tells
+    // producers and the consumer whose turn it is, so neither side ever takes a lock)
+    template<typename T>
+    class BoundedQueue {
+    public:
+        explicit BoundedQueue(size_t capacity) {
+            size_t roundedCapacity = 2;
+            while (roundedCapacity < capacity) {
+                roundedCapacity <<= 1;
+            }
+
+            m_mask = roundedCapacity - 1;
+            m_cells = std::make_unique<Cell[]>(roundedCapacity);
+            for (size_t i = 0; i < roundedCapacity; i++) {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            m_enqueuePosition.store(0, std::memory_order_relaxed);
+            m_dequeuePosition.store(0, std::memory_order_relaxed);
+        }
+
+        // Returns false (leaving item untouched) if the queue is full
+        bool TryEnqueue(T& item) {
+            size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = m_cells[position & m_mask];
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (difference == 0) {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        cell.data = std::move(item);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0) {
+                    return false;
+                }
+                else {
+                    position = m_enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Returns false if the queue is empty
+        bool TryDequeue(T& item) {
+            size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = m_cells[position & m_mask];
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+                if (difference == 0) {
+                    if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        item = std::move(cell.data);
+                        cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0) {
+                    return false;
+                }
+                else {
+                    position = m_dequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        size_t m_mask;
+        alignas(64) std::atomic<size_t> m_enqueuePosition;
+        alignas(64) std::atomic<size_t> m_dequeuePosition;
+    };
+
+    struct LoggerOptions {
+        std::filesystem::path path;
+
+        // Once the log reaches this size, it is renamed (e.g. log.txt -> log.1.txt) and a new file is started
+        uintmax_t maxFileBytes = 1024 * 1024;
+        unsigned int maxRotatedFiles = 2;
+
+        // Lines beyond this many pending ones are dropped
+        size_t queueCapacity = 1024;
+
+        // Upper bound on how long a line can sit in the queue before being written
+        std::chrono::milliseconds flushInterval{ 250 };
+    };
+
+    class Logger {
+    public:
+        explicit Logger(LoggerOptions options);
+        ~Logger();
+
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+
+        // Queues a line (a newline is appended); never blocks. Returns false if the line was dropped.
+        bool Write(std::string line);
+
+        // Writes out everything that was queued and closes the file; subsequent writes are dropped
+        void Stop();
+
+        uint64_t GetDroppedCount() const {
+            return m_droppedTotal.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void Run();
+        void OpenFile();
+        void RotateFile();
+        void WriteBatch(const std::string& batch);
+        std::filesystem::path GetRotatedPath(unsigned int index) const;
+
+        const LoggerOptions m_options;
+        BoundedQueue<std::string> m_queue;
+        std::atomic<bool> m_stopping; // New lines are rejected (and counted as dropped)
+        std::atomic<bool> m_exiting; // The writer thread does one last drain and exits
+        std::atomic<unsigned int> m_activeWriters; // Calls to Write that may still be queueing a line
+        std::atomic<bool> m_signaled;
+        std::atomic<uint64_t> m_droppedSinceLastReport;
+        std::atomic<uint64_t> m_droppedTotal;
+
+        // Only used by the writer thread (and Stop, after the writer thread has exited)
+        std::ofstream m_file;
+        uintmax_t m_fileSize;
+
+        std::mutex m_wakeLock;
+        std::condition_variable m_wake;
+        std::mutex m_stopLock;
+        std::thread m_thread;
+    };
+}
@@ -1,6 +1,6 @@
 #include "stdafx.h"
 
-#include <fstream>
+#include <future>
 #include <wrl.h>
 #include <wil/com.h>
 #include <shlobj_core.h>
@@ -17,6 +17,10 @@
 #include "common.h"
 #include "wvwindow.h"
 #include "promisehandler.h"
+#include "logger.h"
+#include "tracer.h"
+#include "metrics.h"
+#include "localstorage.h"
 
 #ifdef _DEBUG
 #define ENABLE_DEV_TOOLS TRUE
@@ -42,13 +46,18 @@ static com_ptr<ISteam> steam;
 static com_ptr<WebViewWindow> webViewWindow;
 static PresentationSettings presentationSettings;
 static critical_section localStorageIOLock;
+static LocalStorage::Store localStorageStore;
+static uint64_t localStorageSavedVersion = 0;
 static critical_section presentationSettingsIOLock;
-static critical_section logFileLock;
+static std::unique_ptr<Logging::Logger> logger;
+static Tracing::Tracer startupTracer;
+static bool startupTraceRequested = false;
 
 // For cleanup
 static critical_section cleanupLock;
 static HWND mainWindowForCleanup;
 static bool cleanedUp = false;
+static bool networkTasksAbandoned = false;
 
 LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
 
@@ -80,16 +89,27 @@ unique_cotaskmem_string GetLogFilePath() {
 	return GetDataPath(L"log.txt");
 }
 
+unique_cotaskmem_string GetStartupTraceFilePath() {
+	return GetDataPath(L"startup-trace.json");
+}
+
 // Logging
+void StartLogging() {
+	Logging::LoggerOptions options;
+	options.path = GetLogFilePath().get();
+	logger = std::make_unique<Logging::Logger>(std::move(options));
+}
+
+// Note: the logger is stopped rather than reset, so that any late calls to Log (e.g. from the thread pool) are just dropped
+void StopLogging() {
+	if (logger) {
+		logger->Stop();
+	}
+}
+
 void LogInternal(const wchar_t* str) {
-	auto lock = logFileLock.lock();
-
-	std::wofstream logFile;
-	logFile.open(GetLogFilePath().get(), std::ios::out | std::ios::app);
-	if (logFile.is_open()) {
-		logFile.imbue(File::GetLocaleUtf8());
-		logFile.write(str, wcslen(str));
-		logFile.flush();
+	if (logger) {
+		logger->Write(String::Narrow(str));
 	}
 }
 
@@ -99,7 +119,7 @@ void Log(const wchar_t* str) {
 		SYSTEMTIME time;
 		GetSystemTime(&time);
 		LogInternal(str_printf<unique_cotaskmem_string>(
-			L"%u-%02u-%02uT%02u:%02u:%02u.%03u %ws\n",
+			L"%u-%02u-%02uT%02u:%02u:%02u.%03u %ws",
 			static_cast<unsigned int>(time.wYear),
 			static_cast<unsigned int>(time.wMonth),
 			static_cast<unsigned int>(time.wDay),
@@ -120,12 +140,27 @@ std::wstring LoadLocalStorageData() {
 	auto lock = localStorageIOLock.lock();
 	std::wstring result;
 	File::TryReadAllTextUtf8(GetLocalStorageDataFileName().get(), result);
+
+	// The page is given the raw data, but the host keeps its own copy, so that the page only has to send changes
+	if (!localStorageStore.TryLoad(result)) {
+		Log(L"Could not parse saved localStorage data; waiting for a full update");
+	}
+
+	localStorageSavedVersion = localStorageStore.GetVersion();
 	return result;
 }
 
-void SaveLocalStorageData(const wchar_t* localStorageData) {
+void SaveLocalStorageData() {
+	static Metrics::Histogram& saveTime = Metrics::GetRegistry().GetHistogram("storage.save_local_storage_us");
 	auto lock = localStorageIOLock.lock();
-	File::TryWriteAllTextUtf8(GetLocalStorageDataFileName().get(), localStorageData);
+	Metrics::ScopedTimer timer(saveTime);
+
+	// Note: when saves are requested in quick succession, the first one may already include later changes
+	uint64_t version = 0;
+	const std::wstring data = localStorageStore.Serialize(&version);
+	if (version != localStorageSavedVersion && File::TryWriteAllTextUtf8(GetLocalStorageDataFileName().get(), data)) {
+		localStorageSavedVersion = version;
+	}
 }
 
 // Presentation settings
@@ -165,6 +200,21 @@ void SavePresentationSettings(PresentationSettings settings) {
 	Ini::StructToIni(&settings, GetPresentationSettingsFileName().get(), presentationSettingsFields, ARRAYSIZE(presentationSettingsFields));
 }
 
+// Startup tracing (enabled with the --trace-startup command line argument)
+void CompleteStartupTrace() {
+	static bool completed = false;
+	if (!completed) {
+		completed = true;
+		startupTracer.AddInstant("FirstNavigationCompleted");
+		if (startupTraceRequested) {
+			auto path = GetStartupTraceFilePath();
+			if (startupTracer.TryWriteChromeTrace(path.get())) {
+				Log(str_printf<unique_cotaskmem_string>(L"Startup trace written to: %ws", path.get()).get());
+			}
+		}
+	}
+}
+
 // Default window size
 typedef struct {
 	int width;
@@ -224,56 +274,43 @@ int CALLBACK WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 	}
 #endif
 
-	// Pre-load localStorage data
-	std::wstring loadedLocalStorageData = LoadLocalStorageData();
-	presentationSettings = LoadPresentationSettings();
+	// Start the background log writer
+	StartLogging();
+
+	// Record startup phases (only written out if requested)
+	startupTraceRequested = (lpCmdLine != nullptr && strstr(lpCmdLine, "--trace-startup") != nullptr);
+
+	// Read and decode saved data in parallel with the rest of startup
+	auto localStorageDataFuture = std::async(std::launch::async, []() {
+		auto trace = startupTracer.Trace("LoadLocalStorageData");
+		return LoadLocalStorageData();
+	});
+
+	auto presentationSettingsFuture = std::async(std::launch::async, []() {
+		auto trace = startupTracer.Trace("LoadPresentationSettings");
+		return LoadPresentationSettings();
+	});
 
 	// Check for WebView2 runtime first
 	{
+		auto trace = startupTracer.Trace("CheckWebView2Runtime");
 		unique_cotaskmem_string versionInfo;
 		THROW_IF_FAILED_MSG(GetAvailableCoreWebView2BrowserVersionString(nullptr, &versionInfo), ERROR_STRING_NO_WEBVIEW2);
 		THROW_HR_IF_NULL_MSG(E_NOINTERFACE, versionInfo, ERROR_STRING_NO_WEBVIEW2);
 	}
 
 	// Initialize Steam API
-	THROW_HR_IF_MSG(E_FAIL, !SteamAPI_Init(), "Failed to initialize Steam API! Please ensure Steam is running.");
-
-	// Initialize thread pool
-	Promise::Initialize();
-
-	// Create and show a window
-	WNDCLASSEX wcex;
-	wcex.cbSize = sizeof(WNDCLASSEX);
-	wcex.style = CS_HREDRAW | CS_VREDRAW;
-	wcex.lpfnWndProc = WndProc;
-	wcex.cbClsExtra = 0;
-	wcex.cbWndExtra = 0;
-	wcex.hInstance = hInstance;
-	wcex.hIcon = LoadIcon(hInstance, MAKEINTRESOURCE(IDI_ICON1));
-	wcex.hCursor = LoadCursor(NULL, IDC_ARROW);
-	wcex.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1);
-	wcex.lpszMenuName = NULL;
-	wcex.lpszClassName = szWindowClass;
-	wcex.hIconSm = NULL;
-
-	// Attempt to use a solid black background to minimize white flashes when resizing
-	unique_hbrush solidBlack(CreateSolidBrush(RGB(0, 0, 0)));
-	if (solidBlack) {
-		wcex.hbrBackground = solidBlack.get();
+	{
+		auto trace = startupTracer.Trace("SteamAPI_Init");
+		THROW_HR_IF_MSG(E_FAIL, !SteamAPI_Init(), "Failed to initialize Steam API! Please ensure Steam is running.");
 	}
 
-	HWND hWnd = nullptr;
-	FAIL_FAST_LAST_ERROR_IF_MSG(RegisterClassEx(&wcex) == 0, "RegisterClassEx failed!");
-	FAIL_FAST_LAST_ERROR_IF_NULL_MSG(hWnd = CreateWindow(szWindowClass, szTitle, WS_OVERLAPPEDWINDOW, CW_USEDEFAULT, CW_USEDEFAULT, defaultWindowBounds.width, defaultWindowBounds.height, NULL, NULL, hInstance, NULL), "CreateWindow failed!");
-
-	ShowWindow(hWnd, nCmdShow);
-
-	if (!presentationSettings.fullscreen) {
-		ScaleWindowIfNeeded(hWnd);
+	// Initialize thread pool
+	{
+		auto trace = startupTracer.Trace("Promise::Initialize");
+		Promise::Initialize();
 	}
 
-	UpdateWindow(hWnd);
-
 	// Store user data in %LocalAppData%\SIC-1
 	auto userDataFolder = GetDataPath(L"internal");
 
@@ -281,15 +318,22 @@ int CALLBACK WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 	auto webView2Options = Make<CoreWebView2EnvironmentOptions>();
 	webView2Options->put_AdditionalBrowserArguments(L"--autoplay-policy=no-user-gesture-required");
 
-	// Create the web view
+	// Start creating the web view (which launches the browser process) before creating the window, so the two overlap.
+	// Note: the completion handlers are only run from the message loop, i.e. after hWnd has been set below.
+	HWND hWnd = nullptr;
+	const auto environmentStart = Tracing::Tracer::Now();
 	FAIL_FAST_IF_FAILED_MSG(CreateCoreWebView2EnvironmentWithOptions(nullptr, userDataFolder.get(), webView2Options.Get(),
 		Callback<ICoreWebView2CreateCoreWebView2EnvironmentCompletedHandler>(
-			[hWnd, &loadedLocalStorageData](HRESULT result, ICoreWebView2Environment* env) -> HRESULT {
+			[&hWnd, &localStorageDataFuture, environmentStart](HRESULT result, ICoreWebView2Environment* env) -> HRESULT {
 				try {
+					const auto controllerStart = Tracing::Tracer::Now();
+					startupTracer.AddSpan("CreateCoreWebView2Environment", environmentStart, controllerStart);
+
 					FAIL_FAST_IF_FAILED_MSG(result, "Failed to create WebView2 environment!");
 					env->CreateCoreWebView2Controller(hWnd, Callback<ICoreWebView2CreateCoreWebView2ControllerCompletedHandler>(
-						[hWnd, &loadedLocalStorageData](HRESULT result, ICoreWebView2Controller* controller) -> HRESULT {
+						[hWnd, &localStorageDataFuture, controllerStart](HRESULT result, ICoreWebView2Controller* controller) -> HRESULT {
 							try {
+								startupTracer.AddSpan("CreateCoreWebView2Controller", controllerStart, Tracing::Tracer::Now());
 								FAIL_FAST_HR_IF_NULL_MSG(result, controller, "Failed to create WebView2 controller!");
 
 								webViewController = controller;
@@ -381,8 +425,9 @@ int CALLBACK WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 								webViewWindow = Make<WebViewWindow>(
 									hWnd,
 									&presentationSettings,
-									[](const wchar_t* data) {
-										SaveLocalStorageData(data);
+									&localStorageStore,
+									[]() {
+										SaveLocalStorageData();
 									},
 									[]() {
 										SavePresentationSettings(presentationSettings);
@@ -390,6 +435,12 @@ int CALLBACK WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 								);
 
 								// Provide any loaded localStorage data
+								std::wstring loadedLocalStorageData;
+								{
+									auto trace = startupTracer.Trace("WaitForLocalStorageData");
+									loadedLocalStorageData = localStorageDataFuture.get();
+								}
+
 								if (!loadedLocalStorageData.empty()) {
 									FAIL_FAST_IF_FAILED_MSG(webViewWindow->put_LocalStorageDataString(make_bstr(loadedLocalStorageData.c_str()).get()), "Failed to provide loaded localStorage data string!");
 								}
@@ -421,7 +472,20 @@ int CALLBACK WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 								auto webView3 = webView.query<ICoreWebView2_3>();
 								FAIL_FAST_IF_FAILED_MSG(webView3->SetVirtualHostNameToFolderMapping(SIC1_DOMAIN, L"assets", COREWEBVIEW2_HOST_RESOURCE_ACCESS_KIND_ALLOW), "Failed to setup folder mapping!");
 
+								// Note when the first page load has completed (for startup tracing)
+								FAIL_FAST_IF_FAILED_MSG(webView->add_NavigationCompleted(Callback<ICoreWebView2NavigationCompletedEventHandler>(
+									[](ICoreWebView2* sender, ICoreWebView2NavigationCompletedEventArgs* args) -> HRESULT {
+										try {
+											CompleteStartupTrace();
+										}
+										catch (...) {
+											// Ignore tracing failures
+										}
+										return S_OK;
+									}).Get(), nullptr), "Failed to hook navigation completed event!");
+
 								// Initial navigation
+								startupTracer.AddInstant("Navigate");
 								FAIL_FAST_IF_FAILED_MSG(webView->Navigate(SIC1_ROOT), "Failed to navigate!");
 
 								return S_OK;
@@ -433,6 +497,47 @@ int CALLBACK WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 				CATCH_FAIL_FAST();
 			}).Get()), "CreateCoreWebView2EnvironmentWithOptions failed!");
 
+	// Create and show a window
+	WNDCLASSEX wcex;
+	wcex.cbSize = sizeof(WNDCLASSEX);
+	wcex.style = CS_HREDRAW | CS_VREDRAW;
+	wcex.lpfnWndProc = WndProc;
+	wcex.cbClsExtra = 0;
+	wcex.cbWndExtra = 0;
+	wcex.hInstance = hInstance;
+	wcex.hIcon = LoadIcon(hInstance, MAKEINTRESOURCE(IDI_ICON1));
+	wcex.hCursor = LoadCursor(NULL, IDC_ARROW);
+	wcex.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1);
+	wcex.lpszMenuName = NULL;
+	wcex.lpszClassName = szWindowClass;
+	wcex.hIconSm = NULL;
+
+	// Attempt to use a solid black background to minimize white flashes when resizing
+	unique_hbrush solidBlack(CreateSolidBrush(RGB(0, 0, 0)));
+	if (solidBlack) {
+		wcex.hbrBackground = solidBlack.get();
+	}
+
+	{
+		auto trace = startupTracer.Trace("CreateWindow");
+		FAIL_FAST_LAST_ERROR_IF_MSG(RegisterClassEx(&wcex) == 0, "RegisterClassEx failed!");
+		FAIL_FAST_LAST_ERROR_IF_NULL_MSG(hWnd = CreateWindow(szWindowClass, szTitle, WS_OVERLAPPEDWINDOW, CW_USEDEFAULT, CW_USEDEFAULT, defaultWindowBounds.width, defaultWindowBounds.height, NULL, NULL, hInstance, NULL), "CreateWindow failed!");
+	}
+
+	ShowWindow(hWnd, nCmdShow);
+
+	// Presentation settings are needed for sizing the window
+	{
+		auto trace = startupTracer.Trace("WaitForPresentationSettings");
+		presentationSettings = presentationSettingsFuture.get();
+	}
+
+	if (!presentationSettings.fullscreen) {
+		ScaleWindowIfNeeded(hWnd);
+	}
+
+	UpdateWindow(hWnd);
+
 	// Main message loop:
 	MSG msg;
 	while (GetMessage(&msg, NULL, 0, 0)) {
@@ -440,7 +545,24 @@ int CALLBACK WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 		DispatchMessage(&msg);
 	}
 
-	SteamAPI_Shutdown();
+	bool leakSteam;
+	{
+		auto lock = cleanupLock.lock();
+		leakSteam = networkTasksAbandoned;
+	}
+
+	if (leakSteam) {
+		// Abandoned network tasks may still be using Steam (and the call manager), so deliberately leave it all alive
+		Log(L"Network tasks were abandoned during shutdown; skipping Steam shutdown");
+		steam.detach();
+	}
+	else {
+		SteamAPI_Shutdown();
+	}
+
+	// Record native metrics for this session
+	Log((L"Metrics: " + String::Widen(Metrics::GetRegistry().ToJson())).c_str());
+	StopLogging();
 
 	return (int)msg.wParam;
 }
@@ -471,11 +593,8 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 				}
 				else if (mainWindowForCleanup == nullptr) {
 					webViewWindow->OnClosing(webView, [hWnd](bool presentationSettingsModified) {
-						unique_bstr localStorageDataString;
-						FAIL_FAST_IF_FAILED(webViewWindow->get_LocalStorageDataString(&localStorageDataString));
-						if (localStorageDataString) {
-							SaveLocalStorageData(localStorageDataString.get());
-						}
+						// Note: the page's final changes were applied by its OnClosing callback
+						SaveLocalStorageData();
 
 						if (presentationSettingsModified) {
 							SavePresentationSettings(presentationSettings);
@@ -487,10 +606,11 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 							mainWindowForCleanup = hWnd;
 						}
 
-						Promise::Cleanup([]() {
+						Promise::Cleanup([](bool networkDrained) {
 							{
 								auto lock = cleanupLock.lock();
 								cleanedUp = true;
+								networkTasksAbandoned = !networkDrained;
 							}
 
 							PostMessage(mainWindowForCleanup, WM_CLOSE, 0, 0);
@@ -0,0 +1,183 @@
+#include "metrics.h"
+
+using namespace Metrics;
+
+namespace {
+    unsigned int FloorLog2(uint64_t value) {
+        unsigned int result = 0;
+        for (unsigned int shift = 32; shift > 0; shift >>= 1) {
+            if (value >= (uint64_t(1) << shift)) {
+                value >>= shift;
+                result += shift;
+            }
+        }
+        return result;
+    }
+
+    template<typename T>
+    void UpdateMax(std::atomic<T>& max, T value) {
+        T current = max.load(std::memory_order_relaxed);
+        while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    template<typename T>
+    T& GetOrAdd(std::map<std::string, std::unique_ptr<T>>& map, const std::string& name) {
+        auto& entry = map[name];
+        if (!entry) {
+            entry = std::make_unique<T>();
+        }
+        return *entry;
+    }
+
+    // Note: metric names are expected to be simple identifiers, so only quotes and backslashes are escaped
+    void AppendJsonName(std::string& json, const std::string& name) {
+        json.push_back('"');
+        for (char c : name) {
+            if (c == '"' || c == '\\') {
+                json.push_back('\\');
+            }
+            json.push_back(c);
+        }
+        json.append("\":");
+    }
+}
+
+void Gauge::Set(int64_t value) {
+    m_value.store(value, std::memory_order_relaxed);
+    UpdateMax(m_max, value);
+}
+
+Histogram::Histogram() : m_count(0), m_sum(0), m_max(0) {
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+unsigned int Histogram::GetBucketIndex(uint64_t value) {
+    if (value < subBucketCount) {
+        return static_cast<unsigned int>(value);
+    }
+
+    const unsigned int exponent = FloorLog2(value);
+    const unsigned int shift = exponent - subBucketBits;
+    const unsigned int subBucket = static_cast<unsigned int>(value >> shift) - subBucketCount;
+    return subBucketCount + (shift * subBucketCount) + subBucket;
+}
+
+uint64_t Histogram::GetBucketUpperBound(unsigned int index) {
+    if (index < subBucketCount) {
+        return index;
+    }
+
+    const unsigned int shift = (index - subBucketCount) / subBucketCount;
+    const uint64_t subBucket = (index - subBucketCount) % subBucketCount;
+    const uint64_t lowerBound = (subBucketCount + subBucket) << shift;
+    return lowerBound + ((uint64_t(1) << shift) - 1);
+}
+
+void Histogram::Record(uint64_t value) {
+    m_buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+    UpdateMax(m_max, value);
+}
+
+uint64_t Histogram::GetValueAtPercentile(double percentile) const {
+    // Note: buckets are read individually, so concurrent updates can make the result slightly inconsistent
+    uint64_t total = 0;
+    for (const auto& bucket : m_buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+
+    if (total == 0) {
+        return 0;
+    }
+
+    uint64_t target = static_cast<uint64_t>((percentile / 100.0) * static_cast<double>(total) + 0.5);
+    if (target < 1) {
+        target = 1;
+    }
+
+    uint64_t seen = 0;
+    for (unsigned int i = 0; i < bucketCount; i++) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            const uint64_t upperBound = GetBucketUpperBound(i);
+            const uint64_t max = GetMax();
+            return (upperBound < max) ? upperBound : max;
+        }
+    }
+    return GetMax();
+}
+
+Counter& Registry::GetCounter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return GetOrAdd(m_counters, name);
+}
+
+Gauge& Registry::GetGauge(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return GetOrAdd(m_gauges, name);
+}
+
+Histogram& Registry::GetHistogram(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return GetOrAdd(m_histograms, name);
+}
+
+std::string Registry::ToJson() const {
+    std::lock_guard<std::mutex> lock(m_lock);
+    std::string json = "{\"counters\":{";
+    bool first = true;
+    for (const auto& entry : m_counters) {
+        if (!first) {
+            json.push_back(',');
+        }
+        first = false;
+
+        AppendJsonName(json, entry.first);
+        json.append(std::to_string(entry.second->Get()));
+    }
+
+    json.append("},\"gauges\":{");
+    first = true;
+    for (const auto& entry : m_gauges) {
+        if (!first) {
+            json.push_back(',');
+        }
+        first = false;
+
+        AppendJsonName(json, entry.first);
+        json.append("{\"value\":").append(std::to_string(entry.second->Get()))
+            .append(",\"max\":").append(std::to_string(entry.second->GetMax()))
+            .append("}");
+    }
+
+    json.append("},\"histograms\":{");
+    first = true;
+    for (const auto& entry : m_histograms) {
+        if (!first) {
+            json.push_back(',');
+        }
+        first = false;
+
+        const Histogram& histogram = *entry.second;
+        AppendJsonName(json, entry.first);
+        json.append("{\"count\":").append(std::to_string(histogram.GetCount()))
+            .append(",\"sum\":").append(std::to_string(histogram.GetSum()))
+            .append(",\"p50\":").append(std::to_string(histogram.GetValueAtPercentile(50)))
+            .append(",\"p90\":").append(std::to_string(histogram.GetValueAtPercentile(90)))
+            .append(",\"p99\":").append(std::to_string(histogram.GetValueAtPercentile(99)))
+            .append(",\"max\":").append(std::to_string(histogram.GetMax()))
+            .append("}");
+    }
+
+    json.append("}}");
+    return json;
+}
+
+Registry& Metrics::GetRegistry() {
+    static Registry registry;
+    return registry;
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Portable (i.e. no Windows dependencies) metrics: counters, gauges, and latency histograms that can be updated from any
+// thread without locking. Metrics are registered by name (registration takes a lock, so call sites should look their
+// metrics up once and hold onto the returned reference) and can be exported as JSON.
+namespace Metrics {
+    class Counter {
+    public:
+        Counter() : m_value(0) {
+        }
+
+        void Increment(uint64_t amount = 1) {
+            m_value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        uint64_t Get() const {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<uint64_t> m_value;
+    };
+
+    // Current value, along with the highest value seen
+    class Gauge {
+    public:
+        Gauge() : m_value(0), m_max(0) {
+        }
+
+        void Set(int64_t value);
+
+        int64_t Get() const {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+        int64_t GetMax() const {
+            return m_max.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<int64_t> m_value;
+        std::atomic<int64_t> m_max;
+    };
+
+    // Log-linear histogram (in the style of HdrHistogram): values below 16 get their own bucket; above that, each power
+    // of two range is split into 16 linear sub-buckets, so any recorded value is reported to within ~6%
+    class Histogram {
+    public:
+        static const unsigned int subBucketBits = 4;
+        static const unsigned int subBucketCount = 1u << subBucketBits;
+        static const unsigned int bucketCount = subBucketCount * (64 - subBucketBits + 1);
+
+        Histogram();
+
+        void Record(uint64_t value);
+
+        uint64_t GetCount() const {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+        uint64_t GetSum() const {
+            return m_sum.load(std::memory_order_relaxed);
+        }
+
+        uint64_t GetMax() const {
+            return m_max.load(std::memory_order_relaxed);
+        }
+
+        // Returns the upper bound of the bucket containing the given percentile (0-100), or 0 if nothing was recorded
+        uint64_t GetValueAtPercentile(double percentile) const;
+
+        static unsigned int GetBucketIndex(uint64_t value);
+        static uint64_t GetBucketUpperBound(unsigned int index);
+
+    private:
+        std::atomic<uint64_t> m_buckets[bucketCount];
+        std::atomic<uint64_t> m_count;
+        std::atomic<uint64_t> m_sum;
+        std::atomic<uint64_t> m_max;
+    };
+
+    class Registry {
+    public:
+        // Note: returned references remain valid for the lifetime of the registry
+        Counter& GetCounter(const std::string& name);
+        Gauge& GetGauge(const std::string& name);
+        Histogram& GetHistogram(const std::string& name);
+
+        std::string ToJson() const;
+
+    private:
+        mutable std::mutex m_lock;
+        std::map<std::string, std::unique_ptr<Counter>> m_counters;
+        std::map<std::string, std::unique_ptr<Gauge>> m_gauges;
+        std::map<std::string, std::unique_ptr<Histogram>> m_histograms;
+    };
+
+    // Process-wide registry
+    Registry& GetRegistry();
+
+    // Records elapsed time (in microseconds) into a histogram when destroyed
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Histogram& histogram) : m_histogram(histogram), m_start(std::chrono::steady_clock::now()) {
+        }
+
+        ~ScopedTimer() {
+            m_histogram.Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count()));
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        Histogram& m_histogram;
+        std::chrono::steady_clock::time_point m_start;
+    };
+}
@@ -1,34 +1,89 @@
 #include "stdafx.h"
 #include "promisehandler.h"
+#include "metrics.h"
+
+#include <chrono>
+#include <string>
 
 #define IID_UNK_ARGS(pType) __uuidof(*(pType)), reinterpret_cast<IUnknown*>(pType)
 
-static PTP_POOL threadpool = nullptr;
-static PTP_CLEANUP_GROUP threadpoolCleanupGroup = nullptr;
-static TP_CALLBACK_ENVIRON threadpoolEnvironment = {};
+// How long to wait for cancelled network tasks before abandoning them on shutdown
+static const DWORD networkShutdownTimeoutMS = 2000;
+
+typedef struct {
+    const char* name;
+    DWORD minimumThreads;
+    DWORD maximumThreads;
+    PTP_POOL threadpool;
+    PTP_CLEANUP_GROUP cleanupGroup;
+    TP_CALLBACK_ENVIRON environment;
+    Promise::CancellationToken* cancellation;
+
+    // Metrics (times are in microseconds)
+    Metrics::Histogram* queueTime;
+    Metrics::Histogram* runTime;
+    Metrics::Counter* failures;
+} ThreadPoolLane;
+
+// Note: a single persistence thread ensures saves are written in the order they were requested
+static ThreadPoolLane lanes[static_cast<size_t>(Promise::Lane::Count)] = {
+    { "persistence", 1, 1 },
+    { "network", 1, 8 },
+};
+
 static Promise::CleanupCallback cleanupCallback = nullptr;
 
+static ThreadPoolLane& GetLane(Promise::Lane lane) {
+    return lanes[static_cast<size_t>(lane)];
+}
+
 void Promise::Initialize() {
-    threadpool = CreateThreadpool(nullptr);
-    THROW_LAST_ERROR_IF_NULL(threadpool);
-    THROW_LAST_ERROR_IF(!SetThreadpoolThreadMinimum(threadpool, 3));
-    SetThreadpoolThreadMaximum(threadpool, 15);
+    for (auto& lane : lanes) {
+        lane.threadpool = CreateThreadpool(nullptr);
+        THROW_LAST_ERROR_IF_NULL(lane.threadpool);
+        THROW_LAST_ERROR_IF(!SetThreadpoolThreadMinimum(lane.threadpool, lane.minimumThreads));
+        SetThreadpoolThreadMaximum(lane.threadpool, lane.maximumThreads);
+
+        lane.cleanupGroup = CreateThreadpoolCleanupGroup();
+        THROW_LAST_ERROR_IF_NULL(lane.cleanupGroup);
+
+        InitializeThreadpoolEnvironment(&lane.environment);
+        SetThreadpoolCallbackPool(&lane.environment, lane.threadpool);
+        SetThreadpoolCallbackCleanupGroup(&lane.environment, lane.cleanupGroup, nullptr);
+
+        // Note: tokens are intentionally leaked, since abandoned tasks may still reference them at exit
+        lane.cancellation = new Promise::CancellationToken();
+
+        auto& registry = Metrics::GetRegistry();
+        const std::string prefix = std::string("promise.") + lane.name;
+        lane.queueTime = &registry.GetHistogram(prefix + ".queue_us");
+        lane.runTime = &registry.GetHistogram(prefix + ".run_us");
+        lane.failures = &registry.GetCounter(prefix + ".failures");
+    }
+}
+
+static void InvokeReject(IDispatch* reject, HRESULT hr) {
+    VARIANTARG reason;
+    VariantInit(&reason);
+    reason.vt = VT_I4;
+    reason.lVal = hr;
 
-    threadpoolCleanupGroup = CreateThreadpoolCleanupGroup();
-    THROW_LAST_ERROR_IF_NULL(threadpoolCleanupGroup);
+    DISPPARAMS params;
+    params.cArgs = 1;
+    params.cNamedArgs = 0;
+    params.rgdispidNamedArgs = nullptr;
+    params.rgvarg = &reason;
 
-    InitializeThreadpoolEnvironment(&threadpoolEnvironment);
-    SetThreadpoolCallbackPool(&threadpoolEnvironment, threadpool);
-    SetThreadpoolCallbackCleanupGroup(&threadpoolEnvironment, threadpoolCleanupGroup, nullptr);
+    THROW_IF_FAILED(reject->Invoke(DISPID_VALUE, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD, &params, nullptr, nullptr, nullptr));
 }
 
-void Promise::RunClosureOnThreadPool(std::unique_ptr<std::function<void()>> pf) {
+void Promise::RunClosureOnThreadPool(Promise::Lane lane, std::unique_ptr<std::function<void()>> pf) {
     auto callback = [](PTP_CALLBACK_INSTANCE, void* pv, PTP_WORK) {
         std::unique_ptr<std::function<void()>> pf(reinterpret_cast<std::function<void()>*>(pv));
         (*(pf.get()))();
     };
 
-    PTP_WORK workItem = CreateThreadpoolWork(callback, pf.get(), &threadpoolEnvironment);
+    PTP_WORK workItem = CreateThreadpoolWork(callback, pf.get(), &GetLane(lane).environment);
     THROW_LAST_ERROR_IF_NULL(workItem);
 
     SubmitThreadpoolWork(workItem);
@@ -37,7 +92,15 @@ void Promise::RunClosureOnThreadPool(std::unique_ptr<std::function<void()>> pf)
     pf.release();
 }
 
-void Promise::ExecutePromiseOnThreadPool(const VARIANT& resolveVariant, const VARIANT& rejectVariant, std::shared_ptr<Promise::Handler> handler) {
+void Promise::ExecutePromiseOnThreadPool(Promise::Lane lane, const VARIANT& resolveVariant, const VARIANT& rejectVariant, std::shared_ptr<Promise::Handler> handler) {
+    ExecutePromiseOnThreadPool(lane, resolveVariant, rejectVariant, std::make_shared<Promise::CancellableHandler>(
+        [handler](VARIANT* result, const Promise::CancellationToken&) {
+            (*handler)(result);
+        }
+    ));
+}
+
+void Promise::ExecutePromiseOnThreadPool(Promise::Lane lane, const VARIANT& resolveVariant, const VARIANT& rejectVariant, std::shared_ptr<Promise::CancellableHandler> handler) {
     THROW_HR_IF(E_INVALIDARG, resolveVariant.vt != VT_DISPATCH || rejectVariant.vt != VT_DISPATCH);
     IDispatch* resolve = resolveVariant.pdispVal;
     IDispatch* reject = rejectVariant.pdispVal;
@@ -48,8 +111,13 @@ void Promise::ExecutePromiseOnThreadPool(const VARIANT& resolveVariant, const VA
     THROW_IF_FAILED(CoMarshalInterThreadInterfaceInStream(IID_UNK_ARGS(resolve), &resolveStream));
     THROW_IF_FAILED(CoMarshalInterThreadInterfaceInStream(IID_UNK_ARGS(reject), &rejectStream));
 
-    RunClosureOnThreadPool(std::make_unique<std::function<void()>>([resolveStream = resolveStream.detach(), rejectStream = rejectStream.detach(), handler]() {
+    const ThreadPoolLane* laneState = &GetLane(lane);
+    const auto queuedAt = std::chrono::steady_clock::now();
+    RunClosureOnThreadPool(lane, std::make_unique<std::function<void()>>([resolveStream = resolveStream.detach(), rejectStream = rejectStream.detach(), handler, laneState, queuedAt]() {
         try {
+            const auto startedAt = std::chrono::steady_clock::now();
+            laneState->queueTime->Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(startedAt - queuedAt).count()));
+
             auto coinit = wil::CoInitializeEx(COINIT_MULTITHREADED);
             wil::com_ptr<IDispatch> resolve;
             wil::com_ptr<IDispatch> reject;
@@ -63,13 +131,19 @@ void Promise::ExecutePromiseOnThreadPool(const VARIANT& resolveVariant, const VA
             // Run the supplied handler
             wil::unique_variant result;
             HRESULT hr = ([&]() -> HRESULT {
+                Metrics::ScopedTimer timer(*laneState->runTime);
                 try {
-                    (*handler)(result.addressof());
+                    laneState->cancellation->ThrowIfCancelled();
+                    (*handler)(result.addressof(), *laneState->cancellation);
                     return S_OK;
                 }
                 CATCH_RETURN();
             })();
 
+            if (FAILED(hr)) {
+                laneState->failures->Increment();
+            }
+
             if (SUCCEEDED(hr)) {
                 // Handler succeeded; resolve the promise
                 DISPPARAMS params = { nullptr, nullptr, 0, 0 };
@@ -83,35 +157,72 @@ void Promise::ExecutePromiseOnThreadPool(const VARIANT& resolveVariant, const VA
             }
             else {
                 // Handler failed; reject the promise
-                VARIANTARG reason;
-                VariantInit(&reason);
-                reason.vt = VT_I4;
-                reason.lVal = hr;
-
-                DISPPARAMS params;
-                params.cArgs = 1;
-                params.cNamedArgs = 0;
-                params.rgdispidNamedArgs = nullptr;
-                params.rgvarg = &reason;
-
-                THROW_IF_FAILED(reject->Invoke(DISPID_VALUE, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD, &params, nullptr, nullptr, nullptr));
+                InvokeReject(reject.get(), hr);
             }
         }
         CATCH_LOG();
     }));
 }
 
+void Promise::RejectPromise(const VARIANT& rejectVariant, HRESULT hr) {
+    THROW_HR_IF(E_INVALIDARG, rejectVariant.vt != VT_DISPATCH);
+    wil::com_ptr<IStream> rejectStream;
+    THROW_IF_FAILED(CoMarshalInterThreadInterfaceInStream(IID_UNK_ARGS(rejectVariant.pdispVal), &rejectStream));
+
+    // Note: this uses the default thread pool (instead of a lane) because lanes may already be closed during shutdown, and
+    // the callback can't be invoked synchronously (the page is blocked on the host object call that is rejecting)
+    auto pf = std::make_unique<std::function<void()>>([rejectStream = rejectStream.detach(), hr]() {
+        try {
+            auto coinit = wil::CoInitializeEx(COINIT_MULTITHREADED);
+            wil::com_ptr<IDispatch> reject;
+            THROW_IF_FAILED(CoGetInterfaceAndReleaseStream(rejectStream, IID_PPV_ARGS(&reject)));
+            InvokeReject(reject.get(), hr);
+        }
+        CATCH_LOG();
+    });
+
+    auto callback = [](PTP_CALLBACK_INSTANCE, void* pv) {
+        std::unique_ptr<std::function<void()>> pf(reinterpret_cast<std::function<void()>*>(pv));
+        (*(pf.get()))();
+    };
+
+    THROW_LAST_ERROR_IF(!TrySubmitThreadpoolCallback(callback, pf.get(), nullptr));
+    pf.release();
+}
+
+static void CloseLane(ThreadPoolLane& lane, bool cancelPendingCallbacks) {
+    CloseThreadpoolCleanupGroupMembers(lane.cleanupGroup, cancelPendingCallbacks ? TRUE : FALSE, nullptr);
+    CloseThreadpoolCleanupGroup(lane.cleanupGroup);
+    CloseThreadpool(lane.threadpool);
+    DestroyThreadpoolEnvironment(&lane.environment);
+}
+
 void Promise::Cleanup(Promise::CleanupCallback onCompleted) {
     // Run asynchronously because the thread pool tasks used in this project require the main window message queue to be unblocked
 
     cleanupCallback = onCompleted;
     CreateThread(nullptr, 0, [](LPVOID data) -> DWORD {
-        CloseThreadpoolCleanupGroupMembers(threadpoolCleanupGroup, TRUE, nullptr);
-        CloseThreadpoolCleanupGroup(threadpoolCleanupGroup);
-        CloseThreadpool(threadpool);
-        DestroyThreadpoolEnvironment(&threadpoolEnvironment);
+        // Flush all pending saves first
+        CloseLane(GetLane(Promise::Lane::Persistence), false);
+
+        // Cancel network tasks and drop any that haven't started yet, but don't wait indefinitely for in-flight calls
+        GetLane(Promise::Lane::Network).cancellation->Cancel();
+        wil::unique_handle networkCleanupThread(CreateThread(nullptr, 0, [](LPVOID data) -> DWORD {
+            CloseLane(GetLane(Promise::Lane::Network), true);
+            return 0;
+        }, nullptr, 0, nullptr));
+
+        bool networkDrained = true;
+        if (networkCleanupThread) {
+            // Note: on timeout, the remaining network tasks are abandoned (and torn down when the process exits)
+            networkDrained = (WaitForSingleObject(networkCleanupThread.get(), networkShutdownTimeoutMS) == WAIT_OBJECT_0);
+        }
+        else {
+            // Couldn't create a helper thread, so wait for the (cancelled) tasks here instead
+            CloseLane(GetLane(Promise::Lane::Network), true);
+        }
 
-        cleanupCallback();
+        cleanupCallback(networkDrained);
         return 0;
     }, nullptr, 0, nullptr);
 }
@@ -1,19 +1,66 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <objbase.h>
 #include <windows.h>
 #include <wil/result.h>
 #include <wil/com.h>
+#include <wil/resource.h>
 
 namespace Promise {
+    // Each lane has its own thread pool, so that (for example) a slow Steam network call can't delay saving
+    enum class Lane {
+        Persistence = 0,    // Saves; run one at a time, in order, and always flushed on shutdown
+        Network,            // Steam calls; cancelled (or abandoned) on shutdown
+
+        Count
+    };
+
+    // Cancellation flag shared by all tasks in a lane; the event can be waited on alongside other handles
+    class CancellationToken {
+    public:
+        CancellationToken() : m_cancelled(false) {
+            m_event.reset(CreateEvent(nullptr, TRUE, FALSE, nullptr));
+            THROW_LAST_ERROR_IF_NULL(m_event.get());
+        }
+
+        bool IsCancelled() const {
+            return m_cancelled.load();
+        }
+
+        void ThrowIfCancelled() const {
+            THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_CANCELLED), IsCancelled());
+        }
+
+        HANDLE GetEvent() const {
+            return m_event.get();
+        }
+
+        void Cancel() {
+            m_cancelled.store(true);
+            SetEvent(m_event.get());
+        }
+
+    private:
+        std::atomic<bool> m_cancelled;
+        wil::unique_handle m_event;
+    };
+
     using Handler = std::function<void(VARIANT*)>;
-    using CleanupCallback = void (*)();
+    using CancellableHandler = std::function<void(VARIANT*, const CancellationToken&)>;
+    using CleanupCallback = void (*)(bool networkDrained);
 
     void Initialize();
-    void RunClosureOnThreadPool(std::unique_ptr<std::function<void()>> pf);
-    void ExecutePromiseOnThreadPool(const VARIANT& resolveVariant, const VARIANT& rejectVariant, std::shared_ptr<Handler> handler);
+    void RunClosureOnThreadPool(Lane lane, std::unique_ptr<std::function<void()>> pf);
+    void ExecutePromiseOnThreadPool(Lane lane, const VARIANT& resolveVariant, const VARIANT& rejectVariant, std::shared_ptr<Handler> handler);
+    void ExecutePromiseOnThreadPool(Lane lane, const VARIANT& resolveVariant, const VARIANT& rejectVariant, std::shared_ptr<CancellableHandler> handler);
+
+    // Rejects a promise (asynchronously) without running anything on a lane, e.g. for requests that arrive during shutdown
+    void RejectPromise(const VARIANT& rejectVariant, HRESULT hr);
+
+    // Waits for persistence tasks, then cancels network tasks, abandoning any that are still running after a deadline (in
+    // which case the callback's argument is false and anything those tasks use must be kept alive until exit)
     void Cleanup(CleanupCallback onCompleted);
 }
-
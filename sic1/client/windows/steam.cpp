@@ -6,6 +6,7 @@
 #include "steam.h"
 #include "utils.h"
 #include "promisehandler.h"
+#include "leaderboardcodec.h"
 
 using namespace std;
 using namespace wil;
@@ -28,8 +29,8 @@ CATCH_RETURN();
 STDMETHODIMP Steam::ResolveGetLeaderboard(VARIANT resolve, VARIANT reject, BSTR leaderboardNameIn) try {
     wil::shared_bstr leaderboardName(wilx::make_unique_bstr(leaderboardNameIn));
 
-    Promise::ExecutePromiseOnThreadPool(resolve, reject, std::make_shared<Promise::Handler>(
-        [this, leaderboardName](VARIANT* result)
+    Promise::ExecutePromiseOnThreadPool(Promise::Lane::Network, resolve, reject, std::make_shared<Promise::CancellableHandler>(
+        [this, leaderboardName](VARIANT* result, const Promise::CancellationToken& cancellation)
         {
             result->vt = VT_UI4;
             result->ulVal = 0;
@@ -45,7 +46,7 @@ STDMETHODIMP Steam::ResolveGetLeaderboard(VARIANT resolve, VARIANT reject, BSTR
                 }
             }
 
-            const auto nativeHandle = m_callManager.GetLeaderboard(name.c_str());
+            const auto nativeHandle = m_callManager.GetLeaderboard(cancellation, name.c_str());
 
             {
                 auto lock = m_leaderboardHandleMappingLock.Lock();
@@ -61,50 +62,19 @@ STDMETHODIMP Steam::ResolveGetLeaderboard(VARIANT resolve, VARIANT reject, BSTR
 }
 CATCH_RETURN();
 
-STDMETHODIMP Steam::ResolveSetLeaderboardEntry(VARIANT resolve, VARIANT reject, UINT32 jsHandle, INT32 score, VARIANT detailBytesIn) try {
-    std::shared_ptr<wil::unique_variant> detailBytes = std::make_shared<wil::unique_variant>();
-    THROW_IF_FAILED(VariantCopy(detailBytes->addressof(), &detailBytesIn));
+STDMETHODIMP Steam::ResolveSetLeaderboardEntry(VARIANT resolve, VARIANT reject, UINT32 jsHandle, INT32 score, BSTR detailBytesIn) try {
+    // Note: Details are optional (and passed as a binary string, with one byte per character)!
+    auto details = std::make_shared<std::vector<int32_t>>();
+    THROW_HR_IF(E_INVALIDARG, !LeaderboardCodec::TryPackDetails(std::wstring_view(detailBytesIn, SysStringLen(detailBytesIn)), *details));
 
-    Promise::ExecutePromiseOnThreadPool(resolve, reject, std::make_shared<Promise::Handler>(
-        [this, jsHandle, score, detailBytes](VARIANT* result)
+    Promise::ExecutePromiseOnThreadPool(Promise::Lane::Network, resolve, reject, std::make_shared<Promise::CancellableHandler>(
+        [this, jsHandle, score, details](VARIANT* result, const Promise::CancellationToken& cancellation)
         {
             result->vt = VT_BOOL;
             result->boolVal = VARIANT_FALSE;
 
-            // Note: Details are optional!
-            int* details = nullptr;
-            int detailsSize = 0;
-
-            std::vector<int> packedBytes;
-            if (detailBytes->vt != VT_EMPTY) {
-                // Check array types and extract into a vector
-                THROW_HR_IF(E_INVALIDARG, (detailBytes->vt != (VT_ARRAY | VT_VARIANT)) || (detailBytes->parray->cDims != 1) || detailBytes->parray->rgsabound[0].cElements > 256);
-
-                // Pack bytes into int32s
-                unsigned int tmp = 0;
-                int tmpIndex = 0;
-                Ole::SafeArrayAccessor<VARIANT> array(detailBytes->parray);
-                for (size_t i = 0; i < array.Count(); i++) {
-                    const VARIANT* element = &array.Get()[i];
-                    THROW_HR_IF(E_INVALIDARG, element->vt != VT_I4 || element->lVal >= 256 || element->lVal < 0);
-                    unsigned char byte = static_cast<unsigned char>(element->lVal);
-                    tmp |= (byte << ((tmpIndex++) * 8));
-
-                    if (tmpIndex == 4 || i == (array.Count() - 1)) {
-                        int packed = 0;
-                        memcpy(&packed, &tmp, sizeof(int));
-                        packedBytes.push_back(packed);
-                        tmpIndex = 0;
-                        tmp = 0;
-                    }
-                }
-
-                details = packedBytes.data();
-                detailsSize = static_cast<int>(packedBytes.size());
-            }
-
             SteamLeaderboard_t nativeHandle = GetLeaderboardNativeHandle(jsHandle);
-            result->boolVal = m_callManager.SetLeaderboardEntry(nativeHandle, score, details, detailsSize) ? VARIANT_TRUE : VARIANT_FALSE;
+            result->boolVal = m_callManager.SetLeaderboardEntry(cancellation, nativeHandle, score, details->empty() ? nullptr : details->data(), static_cast<int>(details->size())) ? VARIANT_TRUE : VARIANT_FALSE;
         }
     ));
     return S_OK;
@@ -112,34 +82,21 @@ STDMETHODIMP Steam::ResolveSetLeaderboardEntry(VARIANT resolve, VARIANT reject,
 CATCH_RETURN();
 
 STDMETHODIMP Steam::ResolveGetFriendLeaderboardEntries(VARIANT resolve, VARIANT reject, UINT32 jsHandle) try {
-    Promise::ExecutePromiseOnThreadPool(resolve, reject, std::make_shared<Promise::Handler>(
-        [this, jsHandle](VARIANT* flatArray)
+    Promise::ExecutePromiseOnThreadPool(Promise::Lane::Network, resolve, reject, std::make_shared<Promise::CancellableHandler>(
+        [this, jsHandle](VARIANT* encodedEntries, const Promise::CancellationToken& cancellation)
         {
             SteamLeaderboard_t nativeHandle = GetLeaderboardNativeHandle(jsHandle);
-            auto rows = m_callManager.GetFriendLeaderboardEntries(nativeHandle);
-
-            SAFEARRAYBOUND bounds;
-            bounds.lLbound = 0;
-            bounds.cElements = 2 * static_cast<ULONG>(rows.size());
-            wilx::unique_safearray array = wilx::make_unique_safearray(VT_VARIANT, 1, &bounds);
-            LONG index = 0;
-            for (const auto& row : rows) {
-                // Create an array for this row and fill in the values [name, score]
-                unique_variant name;
-                name.bstrVal = wilx::make_unique_bstr(String::Widen(row.name.c_str()).c_str()).release();
-                name.vt = VT_BSTR;
-                THROW_IF_FAILED(SafeArrayPutElement(array.get(), &index, reinterpret_cast<void*>(&name)));
-                ++index;
-
-                unique_variant score;
-                score.vt = VT_I4;
-                score.lVal = row.score;
-                THROW_IF_FAILED(SafeArrayPutElement(array.get(), &index, reinterpret_cast<void*>(&score)));
-                ++index;
-            }
+            auto rows = m_callManager.GetFriendLeaderboardEntries(cancellation, nativeHandle);
+
+            // Encode directly into the (single) string that is handed to the page
+            const size_t size = LeaderboardCodec::GetEncodedEntriesSize(rows);
+            THROW_HR_IF(E_OUTOFMEMORY, size > UINT_MAX);
+            wil::unique_bstr encoded(SysAllocStringLen(nullptr, static_cast<UINT>(size)));
+            THROW_IF_NULL_ALLOC(encoded.get());
+            LeaderboardCodec::EncodeEntries(rows, encoded.get());
 
-            flatArray->vt = VT_ARRAY | VT_VARIANT;
-            flatArray->parray = array.release();
+            encodedEntries->vt = VT_BSTR;
+            encodedEntries->bstrVal = encoded.release();
         }
     ));
 
@@ -164,7 +121,7 @@ STDMETHODIMP Steam::SetAchievement(BSTR achievementId, BOOL* newlyAchieved) try
 CATCH_RETURN();
 
 STDMETHODIMP Steam::ResolveStoreAchievements(VARIANT resolve, VARIANT reject) try {
-    Promise::ExecutePromiseOnThreadPool(resolve, reject, std::make_shared<Promise::Handler>(
+    Promise::ExecutePromiseOnThreadPool(Promise::Lane::Network, resolve, reject, std::make_shared<Promise::Handler>(
         [this](VARIANT* result)
         {
             m_callManager.StoreAchievements();
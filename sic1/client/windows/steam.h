@@ -8,6 +8,7 @@
 #include "dispatchable.h"
 #include "utils.h"
 #include "host-objects_h.h"
+#include "host-objects-dispatch.h"
 #include "steamcallmanager.h"
 
 class Steam : public Dispatchable<ISteam> {
@@ -17,7 +18,7 @@ public:
     STDMETHODIMP get_UserName(BSTR* stringResult) override;
 
     STDMETHODIMP ResolveGetLeaderboard(VARIANT resolve, VARIANT reject, BSTR leaderboardName);
-    STDMETHODIMP ResolveSetLeaderboardEntry(VARIANT resolve, VARIANT reject, UINT32 leaderboardHandle, INT32 score, VARIANT detailBytes);
+    STDMETHODIMP ResolveSetLeaderboardEntry(VARIANT resolve, VARIANT reject, UINT32 leaderboardHandle, INT32 score, BSTR detailBytes);
     STDMETHODIMP ResolveGetFriendLeaderboardEntries(VARIANT resolve, VARIANT reject, UINT32 jsHandle);
 
     STDMETHODIMP GetAchievement(BSTR achievementId, BOOL* achieved);
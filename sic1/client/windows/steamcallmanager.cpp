@@ -13,11 +13,12 @@ DWORD WINAPI SteamCallManager_ThreadEntryPoint(void* data) try {
 CATCH_RETURN();
 
 SteamCallManager::SteamCallManager()
-    : m_achievementsInitialized(false),
+    : m_outstandingCallsGauge(Metrics::GetRegistry().GetGauge("steam.outstanding_calls")),
+    m_achievementsInitialized(false),
     m_callbackUserStatsReceived(this, &SteamCallManager::OnUserStatsReceived),
     m_callbackUserStatsStored(this, &SteamCallManager::OnUserStatsStored),
     m_callbackAchievementStored(this, &SteamCallManager::OnAchievementStored),
-    m_getLeaderboard(this,
+    m_getLeaderboard(this, "get_leaderboard",
         [](const char* name) -> SteamAPICall_t {
             return SteamUserStats()->FindLeaderboard(name);
         },
@@ -29,7 +30,7 @@ SteamCallManager::SteamCallManager()
                 state->data = result->m_hSteamLeaderboard;
             }
         }),
-    m_getFriendLeaderboardEntries(this,
+    m_getFriendLeaderboardEntries(this, "get_friend_leaderboard_entries",
         [](SteamLeaderboard_t nativeHandle) -> SteamAPICall_t {
             return SteamUserStats()->DownloadLeaderboardEntries(nativeHandle, k_ELeaderboardDataRequestFriends, 0, 0);
         },
@@ -42,7 +43,7 @@ SteamCallManager::SteamCallManager()
                 state->data.push_back({ friends->GetFriendPersonaName(entry.m_steamIDUser), entry.m_nScore });
             }
         }),
-    m_setLeaderboardEntry(this,
+    m_setLeaderboardEntry(this, "set_leaderboard_entry",
         [](SteamLeaderboard_t nativeHandle, int score, int* scoreDetails, int scoreDetailsCount) -> SteamAPICall_t {
             return SteamUserStats()->UploadLeaderboardScore(nativeHandle, k_ELeaderboardUploadScoreMethodKeepBest, score, scoreDetails, scoreDetailsCount);
         },
@@ -84,14 +85,16 @@ unsigned int SteamCallManager::GetOutstandingCallCount() {
 }
 
 void SteamCallManager::IncrementOutstandingCallCount() {
-    if (m_outstandingCalls.Increment() == 1) {
+    const long count = m_outstandingCalls.Increment();
+    m_outstandingCallsGauge.Set(count);
+    if (count == 1) {
         // First outstanding call; kick off processing now
         m_startProcessing.Signal();
     }
 }
 
 void SteamCallManager::DecrementOutstandingCallCount() {
-    m_outstandingCalls.Decrement();
+    m_outstandingCallsGauge.Set(m_outstandingCalls.Decrement());
 }
 
 void SteamCallManager::RunThread() {
@@ -117,16 +120,16 @@ void SteamCallManager::RunThread() {
     }
 }
 
-SteamLeaderboard_t SteamCallManager::GetLeaderboard(const char* name) {
-    return m_getLeaderboard.Call(name);
+SteamLeaderboard_t SteamCallManager::GetLeaderboard(const Promise::CancellationToken& cancellation, const char* name) {
+    return m_getLeaderboard.Call(cancellation, name);
 }
 
-std::vector<FriendLeaderboardRow> SteamCallManager::GetFriendLeaderboardEntries(SteamLeaderboard_t nativeHandle) {
-    return m_getFriendLeaderboardEntries.Call(nativeHandle);
+std::vector<FriendLeaderboardRow> SteamCallManager::GetFriendLeaderboardEntries(const Promise::CancellationToken& cancellation, SteamLeaderboard_t nativeHandle) {
+    return m_getFriendLeaderboardEntries.Call(cancellation, nativeHandle);
 }
 
-bool SteamCallManager::SetLeaderboardEntry(SteamLeaderboard_t nativeHandle, int score, int* scoreDetails, int scoreDetailsCount) {
-    return m_setLeaderboardEntry.Call(nativeHandle, score, scoreDetails, scoreDetailsCount);
+bool SteamCallManager::SetLeaderboardEntry(const Promise::CancellationToken& cancellation, SteamLeaderboard_t nativeHandle, int score, int* scoreDetails, int scoreDetailsCount) {
+    return m_setLeaderboardEntry.Call(cancellation, nativeHandle, score, scoreDetails, scoreDetailsCount);
 }
 
 bool SteamCallManager::GetAchievement(const char* achievementId) {
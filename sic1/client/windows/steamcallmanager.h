@@ -6,6 +6,8 @@
 #include <steam/steam_api.h>
 #include "steam/isteamuserstats.h"
 #include "utils.h"
+#include "promisehandler.h"
+#include "metrics.h"
 
 class SteamCallManager;
 
@@ -13,8 +15,15 @@ class SteamCallManager;
 template<typename TSteamResult, typename TState, typename TResult, typename ...TArgs>
 class SteamCall {
 public:
-    SteamCall(SteamCallManager* parent, std::function<SteamAPICall_t(TArgs...)> start, std::function<void(TSteamResult*, TState*)> translateResult)
-        : m_parent(parent), m_start(start), m_translateResult(translateResult), m_state(nullptr) {
+    SteamCall(SteamCallManager* parent, const char* name, std::function<SteamAPICall_t(TArgs...)> start, std::function<void(TSteamResult*, TState*)> translateResult)
+        : m_parent(parent),
+        m_start(start),
+        m_translateResult(translateResult),
+        m_state(nullptr),
+        m_pending(false),
+        m_duration(Metrics::GetRegistry().GetHistogram(std::string("steam.") + name + ".call_us")),
+        m_failures(Metrics::GetRegistry().GetCounter(std::string("steam.") + name + ".failures")),
+        m_cancellations(Metrics::GetRegistry().GetCounter(std::string("steam.") + name + ".cancellations")) {
     }
 
     ~SteamCall() {
@@ -26,19 +35,53 @@ public:
         m_completed.Signal();
     }
 
-    // (Hopefully) Thread-safe, serialized, synchronous call to Steam API
-    TResult Call(TArgs...args) {
+    // (Hopefully) Thread-safe, serialized, synchronous call to Steam API; throws ERROR_CANCELLED if the token is
+    // cancelled before the call completes
+    TResult Call(const Promise::CancellationToken& cancellation, TArgs...args) {
         auto lock = m_lock.Lock();
+        cancellation.ThrowIfCancelled();
+        Metrics::ScopedTimer timer(m_duration);
 
         SteamAPICall_t call = m_start(args...);
         auto state = std::make_unique<TState>();
-        m_state = state.get();
 
-        m_callResult.Set(call, this, &SteamCall<TSteamResult, TState, TResult, TArgs...>::OnCallback);
+        {
+            auto callbackLock = m_callbackLock.Lock();
+            m_state = state.get();
+            m_pending = true;
+            m_callResult.Set(call, this, &SteamCall<TSteamResult, TState, TResult, TArgs...>::OnCallback);
+        }
+
         m_parent->IncrementOutstandingCallCount();
-        m_completed.Wait();
+        if (Sync::AutoResetEvent::WaitForAny({ m_completed.Get(), cancellation.GetEvent() }) != 0) {
+            bool cancelled = false;
+            {
+                // Cancelled before the result arrived (unless it arrived at the same time); stop listening for it
+                auto callbackLock = m_callbackLock.Lock();
+                if (m_pending) {
+                    m_pending = false;
+                    m_state = nullptr;
+                    cancelled = true;
+                }
+            }
+
+            if (cancelled) {
+                // Note: this must be done without holding the callback lock, since SteamAPI_RunCallbacks may be blocked on
+                // it (in OnCallback, which will now ignore the result)
+                m_callResult.Cancel();
+                m_parent->DecrementOutstandingCallCount();
+                m_cancellations.Increment();
+                THROW_WIN32(ERROR_CANCELLED);
+            }
+
+            // The result arrived at the same time, so consume the completion signal and use the result
+            m_completed.Wait();
+        }
 
-        THROW_IF_FAILED(state->hr);
+        if (FAILED(state->hr)) {
+            m_failures.Increment();
+            THROW_HR(state->hr);
+        }
 
         return state->data;
     }
@@ -46,7 +89,14 @@ public:
 private:
     // Call result callback
     void OnCallback(TSteamResult* result, bool ioFailed) {
+        auto callbackLock = m_callbackLock.Lock();
+        if (!m_pending) {
+            // Call was cancelled
+            return;
+        }
+
         auto onScopeExit = wil::scope_exit([&] {
+            m_pending = false;
             m_parent->DecrementOutstandingCallCount();
             m_completed.Signal();
         });
@@ -68,9 +118,16 @@ private:
 
     // Synchronization and state
     Sync::CriticalSection m_lock;
+    Sync::CriticalSection m_callbackLock;
     CCallResult<SteamCall<TSteamResult, TState, TResult, TArgs...>, TSteamResult> m_callResult;
     TState* m_state;
+    bool m_pending;
     Sync::AutoResetEvent m_completed;
+
+    // Metrics
+    Metrics::Histogram& m_duration;
+    Metrics::Counter& m_failures;
+    Metrics::Counter& m_cancellations;
 };
 
 typedef struct {
@@ -109,9 +166,9 @@ public:
     void RunThread();
 
     // Synchronous (serialized) calls
-    SteamLeaderboard_t GetLeaderboard(const char* name);
-    std::vector<FriendLeaderboardRow> GetFriendLeaderboardEntries(SteamLeaderboard_t nativeHandle);
-    bool SetLeaderboardEntry(SteamLeaderboard_t nativeHandle, int score, int* scoreDetails, int scoreDetailsCount);
+    SteamLeaderboard_t GetLeaderboard(const Promise::CancellationToken& cancellation, const char* name);
+    std::vector<FriendLeaderboardRow> GetFriendLeaderboardEntries(const Promise::CancellationToken& cancellation, SteamLeaderboard_t nativeHandle);
+    bool SetLeaderboardEntry(const Promise::CancellationToken& cancellation, SteamLeaderboard_t nativeHandle, int score, int* scoreDetails, int scoreDetailsCount);
 
     // Achievements
     bool GetAchievement(const char* achievementId);
@@ -127,6 +184,7 @@ private:
     Sync::AutoResetEvent m_shutdown;
 
     Sync::ThreadSafeCounter m_outstandingCalls;
+    Metrics::Gauge& m_outstandingCallsGauge;
     Sync::AutoResetEvent m_startProcessing;
 
     bool m_achievementsInitialized;
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+// Minimal assertions for the host's tests (which have no other dependencies): failures are reported with their location
+// and counted, and RETURN_CHECK_RESULT() turns the count into the process's exit code (for ctest)
+namespace Check {
+    inline int& GetFailureCount() {
+        static int failureCount = 0;
+        return failureCount;
+    }
+
+    inline void Fail(const char* file, int line, const char* expression) {
+        std::fprintf(stderr, "%s(%d): check failed: %s\n", file, line, expression);
+        GetFailureCount()++;
+    }
+}
+
+#define CHECK(expression) do { if (!(expression)) { Check::Fail(__FILE__, __LINE__, #expression); } } while (false)
+#define CHECK_EQUAL(expected, actual) CHECK((expected) == (actual))
+
+#define RETURN_CHECK_RESULT() do { \
+    if (Check::GetFailureCount() > 0) { \
+        std::fprintf(stderr, "%d check(s) failed\n", Check::GetFailureCount()); \
+        return EXIT_FAILURE; \
+    } \
+    std::printf("All checks passed\n"); \
+    return EXIT_SUCCESS; \
+} while (false)
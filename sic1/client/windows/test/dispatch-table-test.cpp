@@ -0,0 +1,102 @@
+#include "dispatch-table.h"
+#include "check.h"
+
+#include <string>
+
+using namespace Dispatch;
+
+namespace {
+    // Copy of IWebViewWindow's table from host-objects-dispatch.h (which can't be included here, since it depends on the
+    // MIDL-generated header); the generated header itself is checked against the IDL by dispatch-generator.spec.ts
+    constexpr NameTable<10, 32> webViewWindowNames = {
+        4u,
+        {
+            { "Fullscreen", 1 },
+            { "LocalStorageDataString", 2 },
+            { "OnClosing", 3 },
+            { "IsDebuggerPresent", 4 },
+            { "GetPresentationSetting", 5 },
+            { "SetPresentationSetting", 6 },
+            { "ResolvePersistLocalStorageChanges", 7 },
+            { "ResolvePersistPresentationSettings", 8 },
+            { "OpenManual", 9 },
+            { "GetMetrics", 10 },
+        },
+        { 1, -1, -1, -1, 9, 5, 6, -1, -1, 4, -1, 2, 7, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, 8, 0, -1, -1, -1 },
+    };
+
+    static_assert(webViewWindowNames.IsPerfect(), "Table must be perfect");
+    static_assert(webViewWindowNames.Find("GetMetrics") == 10, "Lookups must work at compile time");
+    static_assert(webViewWindowNames.Find(u"getmetrics") == 10, "Lookups must ignore case");
+
+    void TestHash() {
+        // Golden values (shared with dispatch-generator.spec.ts, or computed by hashName in build/dispatch-generator.ts)
+        CHECK_EQUAL(2166136261u, HashName("", 0));
+        CHECK_EQUAL(1970016316u, HashName("Fullscreen", 4));
+        CHECK_EQUAL(4075914891u, HashName("ResolveStoreAchievements", 11));
+        CHECK_EQUAL(856211068u, HashName(u"café", 0));
+
+        // Case-insensitive (for ASCII only), and the same for every character type
+        CHECK_EQUAL(HashName("fullscreen", 4), HashName("FULLSCREEN", 4));
+        CHECK_EQUAL(HashName("Fullscreen", 4), HashName(u"Fullscreen", 4));
+        CHECK_EQUAL(HashName("Fullscreen", 4), HashName(L"Fullscreen", 4));
+        CHECK(HashName(u"é", 0) != HashName(u"É", 0));
+        CHECK(HashName("Fullscreen", 4) != HashName("Fullscreen", 5));
+    }
+
+    void TestNamesEqualIgnoringCase() {
+        CHECK(NamesEqualIgnoringCase("OnClosing", "onclosing"));
+        CHECK(NamesEqualIgnoringCase("OnClosing", L"ONCLOSING"));
+        CHECK(!NamesEqualIgnoringCase("OnClosing", "OnClosin"));
+        CHECK(!NamesEqualIgnoringCase("OnClosing", "OnClosingX"));
+        CHECK(!NamesEqualIgnoringCase("", "a"));
+        CHECK(NamesEqualIgnoringCase("", ""));
+    }
+
+    template<typename TChar>
+    void TestFind() {
+        for (const Member& member : webViewWindowNames.members) {
+            std::basic_string<TChar> name;
+            std::basic_string<TChar> lowerName;
+            std::basic_string<TChar> upperName;
+            for (const char* c = member.name; *c != 0; c++) {
+                name.push_back(static_cast<TChar>(*c));
+                lowerName.push_back(static_cast<TChar>((*c >= 'A' && *c <= 'Z') ? *c + ('a' - 'A') : *c));
+                upperName.push_back(static_cast<TChar>((*c >= 'a' && *c <= 'z') ? *c - ('a' - 'A') : *c));
+            }
+
+            CHECK_EQUAL(member.dispId, webViewWindowNames.Find(name.c_str()));
+            CHECK_EQUAL(member.dispId, webViewWindowNames.Find(lowerName.c_str()));
+            CHECK_EQUAL(member.dispId, webViewWindowNames.Find(upperName.c_str()));
+
+            // Prefixes and extensions of member names aren't members
+            CHECK_EQUAL(unknownDispId, webViewWindowNames.Find(name.substr(0, name.size() - 1).c_str()));
+            CHECK_EQUAL(unknownDispId, webViewWindowNames.Find((name + static_cast<TChar>('s')).c_str()));
+        }
+
+        const TChar empty[] = { 0 };
+        const TChar unknown[] = { 'T', 'o', 'S', 't', 'r', 'i', 'n', 'g', 0 };
+        CHECK_EQUAL(unknownDispId, webViewWindowNames.Find(empty));
+        CHECK_EQUAL(unknownDispId, webViewWindowNames.Find(unknown));
+    }
+
+    void TestUnknownNames() {
+        // Every name must either be a member or miss, regardless of which slot it hashes to
+        int foundCount = 0;
+        for (int i = 0; i < 10000; i++) {
+            const std::string name = "Member" + std::to_string(i);
+            foundCount += (webViewWindowNames.Find(name.c_str()) != unknownDispId) ? 1 : 0;
+        }
+        CHECK_EQUAL(0, foundCount);
+    }
+}
+
+int main() {
+    TestHash();
+    TestNamesEqualIgnoringCase();
+    TestFind<char>();
+    TestFind<char16_t>();
+    TestFind<wchar_t>();
+    TestUnknownNames();
+    RETURN_CHECK_RESULT();
+}
@@ -0,0 +1,240 @@
+// Fuzz harness for LeaderboardCodec: encoded friend lists must round-trip through a reference decoder (with long names
+// truncated on UTF-8 boundaries), and packed score details must match a reference packer.
+//
+// By default, this builds a driver that runs edge cases and then randomized inputs (and exits with an error if any
+// check fails). With Clang, configure with -DSIC1_LIBFUZZER=ON to build a libFuzzer target instead.
+
+#include "leaderboardcodec.h"
+#include "text.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+using namespace LeaderboardCodec;
+
+namespace {
+    struct Row {
+        std::string name;
+        int32_t score;
+    };
+
+    // Reference decoder (see the format description in leaderboardcodec.h); returns false if the buffer is malformed
+    template<typename TChar>
+    bool TryDecodeEntries(const std::basic_string<TChar>& buffer, std::vector<Row>& rows) {
+        size_t position = 0;
+        bool valid = true;
+        const auto readUInt = [&](size_t byteCount) {
+            uint32_t value = 0;
+            for (size_t i = 0; i < byteCount; i++) {
+                if (position >= buffer.size() || static_cast<uint32_t>(buffer[position]) > 0xff) {
+                    valid = false;
+                    return value;
+                }
+                value |= static_cast<uint32_t>(buffer[position++]) << (8 * i);
+            }
+            return value;
+        };
+
+        rows.clear();
+        const uint32_t count = readUInt(4);
+        for (uint32_t i = 0; valid && i < count; i++) {
+            Row row;
+            row.score = static_cast<int32_t>(readUInt(4));
+            const uint32_t nameLength = readUInt(2);
+            for (uint32_t j = 0; valid && j < nameLength; j++) {
+                row.name.push_back(static_cast<char>(readUInt(1)));
+            }
+            rows.push_back(std::move(row));
+        }
+        return valid && position == buffer.size();
+    }
+
+    bool IsValidUtf8(std::string_view str) {
+        std::u16string utf16;
+        return Text::TryUtf8ToUtf16(str, utf16);
+    }
+
+    bool IsContinuationByte(char c) {
+        return (static_cast<unsigned char>(c) & 0xc0) == 0x80;
+    }
+
+    template<typename TChar>
+    bool CheckEntriesRoundTrip(const std::vector<Row>& rows) {
+        std::basic_string<TChar> buffer(GetEncodedEntriesSize(rows), static_cast<TChar>(0));
+        EncodeEntries(rows, buffer.data());
+
+        std::vector<Row> decoded;
+        if (!TryDecodeEntries(buffer, decoded) || decoded.size() != rows.size()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < rows.size(); i++) {
+            const std::string& name = rows[i].name;
+            const std::string& decodedName = decoded[i].name;
+            if (decoded[i].score != rows[i].score || name.compare(0, decodedName.size(), decodedName) != 0) {
+                return false;
+            }
+
+            // Long names are truncated to the limit, backing up to the start of a UTF-8 sequence (for valid UTF-8, that's
+            // at most three bytes, and the result is still valid)
+            if (name.size() <= maxNameBytes) {
+                if (decodedName.size() != name.size()) {
+                    return false;
+                }
+            }
+            else {
+                const size_t length = decodedName.size();
+                const bool truncatedAtBoundary = (length == 0 || !IsContinuationByte(name[length]))
+                    && (length == maxNameBytes || IsContinuationByte(name[length + 1]));
+                if (length > maxNameBytes || !truncatedAtBoundary) {
+                    return false;
+                }
+
+                if (IsValidUtf8(name) && (length + 3 < maxNameBytes || !IsValidUtf8(decodedName))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Reference packer
+    template<typename TChar>
+    bool CheckPackDetails(std::basic_string_view<TChar> bytes) {
+        bool expectedSuccess = bytes.size() <= maxDetailBytes;
+        std::vector<int32_t> expected;
+        for (size_t i = 0; expectedSuccess && i < bytes.size(); i += 4) {
+            uint32_t word = 0;
+            for (size_t j = i; j < i + 4 && j < bytes.size(); j++) {
+                const uint32_t byte = static_cast<uint32_t>(bytes[j]);
+                expectedSuccess = expectedSuccess && byte <= 0xff;
+                word |= (byte & 0xff) << (8 * (j - i));
+            }
+            expected.push_back(static_cast<int32_t>(word));
+        }
+
+        if (!expectedSuccess) {
+            expected.clear();
+        }
+
+        std::vector<int32_t> packed = { 1, 2, 3 };
+        return TryPackDetails(bytes, packed) == expectedSuccess && packed == expected;
+    }
+
+    // Interprets fuzzer input as a list of rows: each one is a control byte, a 4-byte score, and a name (of up to 63
+    // bytes). When the control byte's top three bits are set, the name is repeated to just past the length limit, so
+    // that truncation sees arbitrary bytes at the boundary.
+    std::vector<Row> CreateRows(const uint8_t* data, size_t size) {
+        std::vector<Row> rows;
+        size_t position = 0;
+        while (position < size) {
+            const uint8_t control = data[position++];
+            Row row = { std::string(), 0 };
+            for (size_t i = 0; i < 4 && position < size; i++) {
+                row.score = static_cast<int32_t>(static_cast<uint32_t>(row.score) | (static_cast<uint32_t>(data[position++]) << (8 * i)));
+            }
+
+            const size_t available = size - position;
+            const size_t nameLength = (control & 0x3f) < available ? (control & 0x3f) : available;
+            row.name.assign(reinterpret_cast<const char*>(data + position), nameLength);
+            position += nameLength;
+
+            if ((control & 0xe0) == 0xe0 && nameLength > 0) {
+                const size_t targetLength = maxNameBytes - 4 + (control & 0x7);
+                std::string longName;
+                while (longName.size() < targetLength) {
+                    longName.append(row.name);
+                }
+                longName.resize(targetLength);
+                row.name = std::move(longName);
+            }
+            rows.push_back(std::move(row));
+        }
+        return rows;
+    }
+
+    bool CheckInput(const uint8_t* data, size_t size) {
+        const std::vector<Row> rows = CreateRows(data, size);
+
+        // Details are checked as bytes, and as 16-bit code units (which may be out of range)
+        const std::basic_string<wchar_t> bytes(data, data + size);
+        std::u16string codeUnits;
+        for (size_t i = 0; i + 1 < size; i += 2) {
+            codeUnits.push_back(static_cast<char16_t>(data[i] | (data[i + 1] << 8)));
+        }
+
+        return CheckEntriesRoundTrip<wchar_t>(rows)
+            && CheckEntriesRoundTrip<char16_t>(rows)
+            && CheckPackDetails(std::wstring_view(bytes))
+            && CheckPackDetails(std::u16string_view(codeUnits));
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (!CheckInput(data, size)) {
+        std::abort();
+    }
+    return 0;
+}
+
+#ifndef SIC1_LIBFUZZER
+namespace {
+    bool CheckEdgeCases() {
+        bool passed = true;
+
+        // Names at and around the limit, with multi-byte sequences (2, 3, and 4 bytes) straddling it
+        const char* const sequences[] = { "a", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80" };
+        for (const char* sequence : sequences) {
+            for (size_t padding = 0; padding < 8; padding++) {
+                std::string name(maxNameBytes - 4 + padding, 'x');
+                name.append(sequence);
+                passed = passed && CheckEntriesRoundTrip<wchar_t>({ { name, -1 }, { "", INT32_MIN }, { "b", INT32_MAX } });
+            }
+        }
+
+        // A name that is entirely continuation bytes can only be truncated to nothing
+        passed = passed && CheckEntriesRoundTrip<char16_t>({ { std::string(maxNameBytes + 1, '\x80'), 0 } });
+        passed = passed && CheckEntriesRoundTrip<char16_t>({});
+
+        // Details at and beyond the length limit, and with characters that aren't bytes
+        for (size_t length : { size_t(0), size_t(1), size_t(3), size_t(4), size_t(5), maxDetailBytes, maxDetailBytes + 1 }) {
+            const std::u16string details(length, u'\xff');
+            passed = passed && CheckPackDetails(std::u16string_view(details));
+        }
+
+        passed = passed && CheckPackDetails(std::u16string_view(u"ab\x100"));
+        passed = passed && CheckPackDetails(std::wstring_view(L"\x7f\x80\xff"));
+        return passed;
+    }
+}
+
+// Usage: leaderboardcodec-fuzz [iteration count] [seed]
+int main(int argc, char** argv) {
+    const int iterationCount = (argc > 1) ? std::atoi(argv[1]) : 5000;
+    const unsigned int seed = (argc > 2) ? static_cast<unsigned int>(std::atoi(argv[2])) : 1;
+    if (!CheckEdgeCases()) {
+        std::fprintf(stderr, "Edge cases failed\n");
+        return EXIT_FAILURE;
+    }
+
+    std::mt19937 random(seed);
+    std::vector<uint8_t> input;
+    for (int iteration = 0; iteration < iterationCount; iteration++) {
+        // Mostly small inputs; long names only come from the control bytes
+        input.resize(random() % 300);
+        for (uint8_t& byte : input) {
+            byte = static_cast<uint8_t>(random());
+        }
+
+        if (!CheckInput(input.data(), input.size())) {
+            std::fprintf(stderr, "Iteration %d (seed %u) failed\n", iteration, seed);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::printf("Checked edge cases and %d random inputs\n", iterationCount);
+    return EXIT_SUCCESS;
+}
+#endif
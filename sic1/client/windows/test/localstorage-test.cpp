@@ -0,0 +1,181 @@
+#include "localstorage.h"
+#include "check.h"
+
+#include <thread>
+
+using namespace LocalStorage;
+
+namespace {
+    std::wstring GetContents(const Store& store) {
+        uint64_t version = 0;
+        return store.Serialize(&version);
+    }
+
+    void TestParse() {
+        Changes changes;
+        CHECK(TryParse(L" { \"a\" : \"1\" , \"b\\\"\":\"x\\n\\t\\u0041\\/\\\\\" } ", changes, false));
+        CHECK_EQUAL(size_t(2), changes.size());
+        CHECK(changes[L"a"] == std::optional<std::wstring>(L"1"));
+        CHECK(changes[L"b\""] == std::optional<std::wstring>(L"x\n\tA/\\"));
+
+        CHECK(TryParse(L"{}", changes, false));
+        CHECK(changes.empty());
+
+        // Removals are only allowed in changes
+        CHECK(!TryParse(L"{\"a\":null}", changes, false));
+        CHECK(TryParse(L"{\"a\":null,\"b\":\"2\"}", changes, true));
+        CHECK(changes[L"a"] == std::nullopt);
+        CHECK(changes[L"b"] == std::optional<std::wstring>(L"2"));
+
+        const wchar_t* const malformed[] = {
+            L"",
+            L"[]",
+            L"{",
+            L"{\"a\":\"1\",}",
+            L"{\"a\" \"1\"}",
+            L"{\"a\":1}",
+            L"{\"a\":\"1\"} x",
+            L"{\"a\":\"\n\"}",
+            L"{\"a\":\"\\x\"}",
+            L"{\"a\":\"\\u00\"}",
+            L"{\"a\":\"\\u00g0\"}",
+            L"{\"a\":\"unterminated}",
+        };
+        for (const wchar_t* json : malformed) {
+            changes[L"stale"] = L"value";
+            CHECK(!TryParse(json, changes, true));
+            CHECK(changes.empty());
+        }
+    }
+
+    void TestSerialize() {
+        // Paired surrogates are written as-is, but unpaired ones (and control characters) are escaped
+        const std::wstring pair = { static_cast<wchar_t>(0xd83d), static_cast<wchar_t>(0xde00) };
+        const std::wstring unpaired = { L'a', static_cast<wchar_t>(0xd83d), L'b', static_cast<wchar_t>(0xde00) };
+        const Entries entries = {
+            { L"escapes", L"\"\\\b\f\n\r\t\x01" },
+            { L"pair", pair },
+            { L"unpaired", unpaired },
+        };
+
+        const std::wstring json = Serialize(entries);
+        CHECK(json == L"{\"escapes\":\"\\\"\\\\\\b\\f\\n\\r\\t\\u0001\",\"pair\":\"" + pair + L"\",\"unpaired\":\"a\\ud83db\\ude00\"}");
+        CHECK(Serialize(Entries()) == L"{}");
+
+        // Everything round-trips
+        Changes changes;
+        CHECK(TryParse(json, changes, false));
+        CHECK_EQUAL(entries.size(), changes.size());
+        for (const auto& entry : entries) {
+            CHECK(changes[entry.first] == std::optional<std::wstring>(entry.second));
+        }
+    }
+
+    void TestApplyChanges() {
+        Store store;
+        CHECK(store.TryLoad(L"{\"a\":\"1\",\"b\":\"2\"}"));
+        const uint64_t loadedVersion = store.GetVersion();
+
+        // Deltas update, add, and remove keys
+        CHECK(store.TryApplyChanges(1, L"{\"a\":\"10\",\"c\":\"3\"}"));
+        CHECK(store.TryApplyChanges(2, L"{\"b\":null,\"missing\":null}"));
+        CHECK(GetContents(store) == L"{\"a\":\"10\",\"c\":\"3\"}");
+
+        uint64_t version = 0;
+        store.Serialize(&version);
+        CHECK_EQUAL(loadedVersion + 2, version);
+        CHECK_EQUAL(version, store.GetVersion());
+    }
+
+    void TestSequenceGap() {
+        Store store;
+        CHECK(store.TryLoad(L"{\"a\":\"1\"}"));
+        CHECK(store.TryApplyChanges(1, L"{\"b\":\"2\"}"));
+        const std::wstring before = GetContents(store);
+        const uint64_t version = store.GetVersion();
+
+        // A skipped, repeated, or malformed update is rejected without changing anything (the host reports
+        // ERROR_INVALID_DATA, and the page then sends a full update)
+        CHECK(!store.TryApplyChanges(3, L"{\"c\":\"3\"}"));
+        CHECK(!store.TryApplyChanges(1, L"{\"c\":\"3\"}"));
+        CHECK(!store.TryApplyChanges(2, L"{\"c\":3}"));
+        CHECK(GetContents(store) == before);
+        CHECK_EQUAL(version, store.GetVersion());
+
+        // The sequence continues where it left off
+        CHECK(store.TryApplyChanges(2, L"{\"c\":\"3\"}"));
+        CHECK(GetContents(store) == L"{\"a\":\"1\",\"b\":\"2\",\"c\":\"3\"}");
+    }
+
+    void TestFullUpdate() {
+        Store store;
+        CHECK(store.TryLoad(L"{\"a\":\"1\",\"b\":\"2\"}"));
+        CHECK(store.TryApplyChanges(1, L"{\"c\":\"3\"}"));
+
+        // Sequence 0 replaces everything (at any point) and restarts the sequence
+        CHECK(store.TryApplyChanges(0, L"{\"d\":\"4\",\"a\":null}"));
+        CHECK(GetContents(store) == L"{\"d\":\"4\"}");
+        CHECK(!store.TryApplyChanges(2, L"{\"e\":\"5\"}"));
+        CHECK(store.TryApplyChanges(1, L"{\"e\":\"5\"}"));
+        CHECK(GetContents(store) == L"{\"d\":\"4\",\"e\":\"5\"}");
+    }
+
+    void TestLoad() {
+        // No saved data is a valid (empty) starting point
+        Store store;
+        CHECK(store.TryLoad(L" \r\n"));
+        CHECK(GetContents(store) == L"{}");
+        CHECK(store.TryApplyChanges(1, L"{\"a\":\"1\"}"));
+
+        // After a failed load, the store is empty and only accepts a full update
+        CHECK(!store.TryLoad(L"{\"a\":"));
+        CHECK(GetContents(store) == L"{}");
+        CHECK(!store.TryApplyChanges(1, L"{\"a\":\"1\"}"));
+        CHECK(!store.TryApplyChanges(2, L"{\"a\":\"1\"}"));
+        CHECK(store.TryApplyChanges(0, L"{\"a\":\"1\"}"));
+        CHECK(store.TryApplyChanges(1, L"{\"b\":\"2\"}"));
+        CHECK(GetContents(store) == L"{\"a\":\"1\",\"b\":\"2\"}");
+
+        // Loading restarts the sequence
+        CHECK(store.TryLoad(L"{\"z\":\"26\"}"));
+        CHECK(!store.TryApplyChanges(2, L"{}"));
+        CHECK(store.TryApplyChanges(1, L"{}"));
+        CHECK(GetContents(store) == L"{\"z\":\"26\"}");
+    }
+
+    void TestConcurrentSerialize() {
+        // Saving (on the persistence thread) while changes arrive sees consistent snapshots and increasing versions
+        constexpr uint32_t updateCount = 2000;
+        Store store;
+        CHECK(store.TryLoad(L""));
+        std::thread writer([&store]() {
+            for (uint32_t sequence = 1; sequence <= updateCount; sequence++) {
+                store.TryApplyChanges(sequence, L"{\"key\":\"" + std::to_wstring(sequence) + L"\"}");
+            }
+        });
+
+        uint64_t lastVersion = 0;
+        bool consistent = true;
+        while (lastVersion < updateCount + 1) {
+            uint64_t version = 0;
+            const std::wstring json = store.Serialize(&version);
+            consistent = consistent && version >= lastVersion
+                && (version <= 1 ? json == L"{}" : json == L"{\"key\":\"" + std::to_wstring(version - 1) + L"\"}");
+            lastVersion = version;
+        }
+
+        writer.join();
+        CHECK(consistent);
+    }
+}
+
+int main() {
+    TestParse();
+    TestSerialize();
+    TestApplyChanges();
+    TestSequenceGap();
+    TestFullUpdate();
+    TestLoad();
+    TestConcurrentSerialize();
+    RETURN_CHECK_RESULT();
+}
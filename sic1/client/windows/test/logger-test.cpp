@@ -0,0 +1,256 @@
+#include "logger.h"
+#include "check.h"
+
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace Logging;
+
+namespace {
+    std::filesystem::path CreateTemporaryDirectory() {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / ("sic1-logger-test-" + std::to_string(std::random_device()()));
+        std::filesystem::create_directories(path);
+        return path;
+    }
+
+    std::vector<std::string> ReadLines(const std::filesystem::path& path) {
+        std::vector<std::string> lines;
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    void TestQueueCapacity() {
+        // Capacity is rounded up to a power of two
+        BoundedQueue<int> queue(3);
+        for (int i = 0; i < 4; i++) {
+            CHECK(queue.TryEnqueue(i));
+        }
+
+        int item = 100;
+        CHECK(!queue.TryEnqueue(item));
+        CHECK_EQUAL(100, item);
+
+        // First in, first out, and the queue can be reused after wrapping around
+        for (int round = 0; round < 3; round++) {
+            for (int i = 0; i < 4; i++) {
+                CHECK(queue.TryDequeue(item));
+                CHECK_EQUAL(i, item);
+            }
+
+            CHECK(!queue.TryDequeue(item));
+            for (int i = 0; i < 4; i++) {
+                CHECK(queue.TryEnqueue(i));
+            }
+        }
+    }
+
+    void TestQueueProducers() {
+        // Several producers and a concurrent consumer: every item must come out exactly once, in order per producer
+        constexpr int producerCount = 4;
+        constexpr int itemsPerProducer = 100000;
+        BoundedQueue<int> queue(64);
+        std::vector<std::thread> producers;
+        for (int producer = 0; producer < producerCount; producer++) {
+            producers.emplace_back([&queue, producer]() {
+                for (int i = 0; i < itemsPerProducer; i++) {
+                    int item = producer * itemsPerProducer + i;
+                    while (!queue.TryEnqueue(item)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        std::vector<int> nextItems(producerCount, 0);
+        bool inOrder = true;
+        for (int received = 0; received < producerCount * itemsPerProducer;) {
+            int item;
+            if (queue.TryDequeue(item)) {
+                const int producer = item / itemsPerProducer;
+                inOrder = inOrder && (item % itemsPerProducer == nextItems[producer]);
+                nextItems[producer]++;
+                received++;
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+
+        CHECK(inOrder);
+        for (int count : nextItems) {
+            CHECK_EQUAL(itemsPerProducer, count);
+        }
+
+        int item;
+        CHECK(!queue.TryDequeue(item));
+    }
+
+    void TestRotation() {
+        const std::filesystem::path directory = CreateTemporaryDirectory();
+        LoggerOptions options;
+        options.path = directory / "log.txt";
+        options.maxFileBytes = 100;
+        options.maxRotatedFiles = 2;
+
+        // Each logger writes a single batch (of one 40-byte line), so a file holds two lines before being rotated
+        for (int i = 0; i < 10; i++) {
+            Logger logger(options);
+            std::string line = "line " + std::to_string(i);
+            line.resize(39, '.');
+            CHECK(logger.Write(line));
+        }
+
+        const std::vector<std::string> current = ReadLines(options.path);
+        const std::vector<std::string> rotated1 = ReadLines(directory / "log.1.txt");
+        const std::vector<std::string> rotated2 = ReadLines(directory / "log.2.txt");
+        CHECK_EQUAL(size_t(2), current.size());
+        CHECK_EQUAL(size_t(2), rotated1.size());
+        CHECK_EQUAL(size_t(2), rotated2.size());
+        CHECK(!std::filesystem::exists(directory / "log.3.txt"));
+        CHECK(current.size() == 2 && current[0].rfind("line 8.", 0) == 0 && current[1].rfind("line 9.", 0) == 0);
+        CHECK(rotated1.size() == 2 && rotated1[0].rfind("line 6.", 0) == 0);
+        CHECK(rotated2.size() == 2 && rotated2[0].rfind("line 4.", 0) == 0);
+
+        std::filesystem::remove_all(directory);
+    }
+
+    void TestDroppedCount() {
+        const std::filesystem::path directory = CreateTemporaryDirectory();
+        LoggerOptions options;
+        options.path = directory / "log.txt";
+        options.maxFileBytes = 1024 * 1024 * 1024;
+        options.queueCapacity = 2;
+
+        // Flood a tiny queue from several threads: every line is either written or counted as dropped
+        constexpr int threadCount = 4;
+        constexpr int linesPerThread = 20000;
+        uint64_t droppedCount = 0;
+        {
+            Logger logger(options);
+            std::vector<std::thread> threads;
+            std::atomic<uint64_t> rejectedCount(0);
+            for (int i = 0; i < threadCount; i++) {
+                threads.emplace_back([&logger, &rejectedCount]() {
+                    for (int j = 0; j < linesPerThread; j++) {
+                        if (!logger.Write("message")) {
+                            rejectedCount.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                });
+            }
+
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+
+            logger.Stop();
+            CHECK_EQUAL(rejectedCount.load(), logger.GetDroppedCount());
+
+            // Writes after stopping are dropped
+            CHECK(!logger.Write("late"));
+            droppedCount = logger.GetDroppedCount();
+            CHECK_EQUAL(rejectedCount.load() + 1, droppedCount);
+        }
+
+        uint64_t writtenCount = 0;
+        uint64_t reportedCount = 0;
+        for (const std::string& line : ReadLines(options.path)) {
+            if (line == "message") {
+                writtenCount++;
+            }
+            else {
+                // E.g. "[12 log message(s) dropped]"
+                std::istringstream stream(line);
+                char bracket = 0;
+                uint64_t count = 0;
+                std::string rest;
+                CHECK((stream >> bracket >> count) && bracket == '[');
+                CHECK(std::getline(stream, rest) && rest == " log message(s) dropped]");
+                reportedCount += count;
+            }
+        }
+
+        CHECK(droppedCount > 1);
+        CHECK_EQUAL(uint64_t(threadCount * linesPerThread), writtenCount + droppedCount - 1);
+        CHECK_EQUAL(droppedCount - 1, reportedCount);
+
+        std::filesystem::remove_all(directory);
+    }
+
+    void TestStopWhileWriting() {
+        // Stop while other threads are still writing: every line that was accepted must be written, and every other line
+        // must be counted as dropped
+        constexpr int threadCount = 4;
+        for (int iteration = 0; iteration < 50; iteration++) {
+            const std::filesystem::path directory = CreateTemporaryDirectory();
+            LoggerOptions options;
+            options.path = directory / "log.txt";
+            options.maxFileBytes = 1024 * 1024 * 1024;
+            options.queueCapacity = 1024 * 1024;
+
+            std::atomic<uint64_t> acceptedCount(0);
+            std::atomic<uint64_t> rejectedCount(0);
+            uint64_t droppedCount = 0;
+            {
+                Logger logger(options);
+                std::atomic<bool> stopped(false);
+                std::vector<std::thread> threads;
+                for (int i = 0; i < threadCount; i++) {
+                    threads.emplace_back([&]() {
+                        // Keep writing until a few writes have been rejected (i.e. until after the logger has stopped)
+                        int rejectedAfterStop = 0;
+                        while (rejectedAfterStop < 10) {
+                            const bool wasStopped = stopped.load();
+                            if (logger.Write("message")) {
+                                acceptedCount.fetch_add(1, std::memory_order_relaxed);
+                            }
+                            else {
+                                rejectedCount.fetch_add(1, std::memory_order_relaxed);
+                                rejectedAfterStop += wasStopped ? 1 : 0;
+                            }
+                        }
+                    });
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(iteration % 5));
+                logger.Stop();
+                stopped.store(true);
+
+                for (std::thread& thread : threads) {
+                    thread.join();
+                }
+
+                droppedCount = logger.GetDroppedCount();
+            }
+
+            uint64_t writtenCount = 0;
+            for (const std::string& line : ReadLines(options.path)) {
+                writtenCount += (line == "message") ? 1 : 0;
+            }
+
+            CHECK_EQUAL(acceptedCount.load(), writtenCount);
+            CHECK_EQUAL(rejectedCount.load(), droppedCount);
+            std::filesystem::remove_all(directory);
+        }
+    }
+}
+
+int main() {
+    TestQueueCapacity();
+    TestQueueProducers();
+    TestRotation();
+    TestDroppedCount();
+    TestStopWhileWriting();
+    RETURN_CHECK_RESULT();
+}
@@ -0,0 +1,161 @@
+#include "metrics.h"
+#include "check.h"
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace Metrics;
+
+namespace {
+    void TestBucketBounds() {
+        CHECK_EQUAL(976u, Histogram::bucketCount);
+
+        // Buckets are contiguous and cover every 64-bit value, and each one is at most 1/16 as wide as its lower bound
+        uint64_t lowerBound = 0;
+        bool contiguous = true;
+        bool precise = true;
+        for (unsigned int i = 0; i < Histogram::bucketCount; i++) {
+            const uint64_t upperBound = Histogram::GetBucketUpperBound(i);
+            contiguous = contiguous
+                && upperBound >= lowerBound
+                && Histogram::GetBucketIndex(lowerBound) == i
+                && Histogram::GetBucketIndex(upperBound) == i
+                && Histogram::GetBucketIndex(lowerBound + (upperBound - lowerBound) / 2) == i;
+            precise = precise && (upperBound - lowerBound) <= lowerBound / Histogram::subBucketCount;
+
+            if (i + 1 < Histogram::bucketCount) {
+                CHECK(upperBound < std::numeric_limits<uint64_t>::max());
+                lowerBound = upperBound + 1;
+            }
+            else {
+                CHECK_EQUAL(std::numeric_limits<uint64_t>::max(), upperBound);
+            }
+        }
+
+        CHECK(contiguous);
+        CHECK(precise);
+
+        // Values below 16 each get their own bucket
+        for (uint64_t value = 0; value < Histogram::subBucketCount; value++) {
+            CHECK_EQUAL(static_cast<unsigned int>(value), Histogram::GetBucketIndex(value));
+            CHECK_EQUAL(value, Histogram::GetBucketUpperBound(static_cast<unsigned int>(value)));
+        }
+
+        CHECK_EQUAL(16u, Histogram::GetBucketIndex(16));
+        CHECK_EQUAL(31u, Histogram::GetBucketIndex(31));
+        CHECK_EQUAL(32u, Histogram::GetBucketIndex(32));
+        CHECK_EQUAL(32u, Histogram::GetBucketIndex(33));
+        CHECK_EQUAL(Histogram::bucketCount - 1, Histogram::GetBucketIndex(std::numeric_limits<uint64_t>::max()));
+    }
+
+    void TestPercentiles() {
+        Histogram histogram;
+        CHECK_EQUAL(uint64_t(0), histogram.GetValueAtPercentile(50));
+
+        for (uint64_t value = 1; value <= 1000; value++) {
+            histogram.Record(value);
+        }
+
+        CHECK_EQUAL(uint64_t(1000), histogram.GetCount());
+        CHECK_EQUAL(uint64_t(500500), histogram.GetSum());
+        CHECK_EQUAL(uint64_t(1000), histogram.GetMax());
+
+        // Percentiles report the upper bound of their bucket (so never less than the exact value, and within ~6%)
+        const double percentiles[] = { 1, 25, 50, 90, 99, 99.9 };
+        for (double percentile : percentiles) {
+            const uint64_t exact = static_cast<uint64_t>(percentile * 10 + 0.5);
+            const uint64_t value = histogram.GetValueAtPercentile(percentile);
+            CHECK(value >= exact && value <= exact + exact / 16);
+        }
+
+        // The lowest percentile is the smallest value's bucket, and the highest is clamped to the maximum
+        CHECK_EQUAL(uint64_t(1), histogram.GetValueAtPercentile(0));
+        CHECK_EQUAL(uint64_t(1000), histogram.GetValueAtPercentile(100));
+
+        Histogram single;
+        single.Record(1000);
+        CHECK_EQUAL(uint64_t(1000), single.GetValueAtPercentile(50));
+    }
+
+    void TestCounterAndGauge() {
+        Counter counter;
+        CHECK_EQUAL(uint64_t(0), counter.Get());
+        counter.Increment();
+        counter.Increment(41);
+        CHECK_EQUAL(uint64_t(42), counter.Get());
+
+        // Gauges report the current value and the highest one set
+        Gauge gauge;
+        gauge.Set(5);
+        gauge.Set(12);
+        gauge.Set(3);
+        CHECK_EQUAL(int64_t(3), gauge.Get());
+        CHECK_EQUAL(int64_t(12), gauge.GetMax());
+        gauge.Set(-7);
+        CHECK_EQUAL(int64_t(-7), gauge.Get());
+        CHECK_EQUAL(int64_t(12), gauge.GetMax());
+    }
+
+    void TestConcurrentRecording() {
+        // Several threads update shared metrics (looked up by name concurrently) without losing any updates
+        constexpr int threadCount = 8;
+        constexpr uint64_t valuesPerThread = 20000;
+        Registry registry;
+        std::vector<std::thread> threads;
+        for (int i = 0; i < threadCount; i++) {
+            threads.emplace_back([&registry, i]() {
+                Counter& counter = registry.GetCounter("test.count");
+                Gauge& gauge = registry.GetGauge("test.gauge");
+                Histogram& histogram = registry.GetHistogram("test.latency_us");
+                for (uint64_t value = 1; value <= valuesPerThread; value++) {
+                    counter.Increment();
+                    gauge.Set(static_cast<int64_t>(value) * (i + 1));
+                    histogram.Record(value);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        const Counter& counter = registry.GetCounter("test.count");
+        const Gauge& gauge = registry.GetGauge("test.gauge");
+        const Histogram& histogram = registry.GetHistogram("test.latency_us");
+        CHECK_EQUAL(uint64_t(threadCount) * valuesPerThread, counter.Get());
+        CHECK_EQUAL(static_cast<int64_t>(valuesPerThread) * threadCount, gauge.GetMax());
+        CHECK_EQUAL(uint64_t(threadCount) * valuesPerThread, histogram.GetCount());
+        CHECK_EQUAL(uint64_t(threadCount) * (valuesPerThread * (valuesPerThread + 1) / 2), histogram.GetSum());
+        CHECK_EQUAL(valuesPerThread, histogram.GetMax());
+        CHECK_EQUAL(valuesPerThread, histogram.GetValueAtPercentile(100));
+
+        const uint64_t median = histogram.GetValueAtPercentile(50);
+        CHECK(median >= valuesPerThread / 2 && median <= valuesPerThread / 2 + valuesPerThread / 32);
+
+        // Registration hands out the same metric for the same name
+        CHECK(&registry.GetCounter("test.count") == &counter);
+        CHECK(&registry.GetCounter("test.other") != &counter);
+    }
+
+    void TestJson() {
+        Registry registry;
+        CHECK(registry.ToJson() == "{\"counters\":{},\"gauges\":{},\"histograms\":{}}");
+
+        registry.GetCounter("a").Increment(2);
+        registry.GetCounter("b\"").Increment();
+        registry.GetGauge("g").Set(4);
+        registry.GetHistogram("h").Record(10);
+        CHECK(registry.ToJson() == "{\"counters\":{\"a\":2,\"b\\\"\":1},\"gauges\":{\"g\":{\"value\":4,\"max\":4}},"
+            "\"histograms\":{\"h\":{\"count\":1,\"sum\":10,\"p50\":10,\"p90\":10,\"p99\":10,\"max\":10}}}");
+    }
+}
+
+int main() {
+    TestBucketBounds();
+    TestPercentiles();
+    TestCounterAndGauge();
+    TestConcurrentRecording();
+    TestJson();
+    RETURN_CHECK_RESULT();
+}
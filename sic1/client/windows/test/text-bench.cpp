@@ -0,0 +1,112 @@
+// Benchmark for loading and saving a large (mostly ASCII) save file: Text's transcoders vs. the codecvt-based streams
+// they replaced (see TryReadAllTextUtf8/TryWriteAllTextUtf8 in utils.h).
+//
+// Usage: text-bench [size in megabytes]
+
+#include "text.h"
+
+#include <chrono>
+#include <codecvt>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <locale>
+#include <memory>
+#include <sstream>
+
+namespace {
+    // Resembles localStorage data: JSON with long runs of ASCII and an occasional non-ASCII character in a user name
+    std::string CreateSaveData(size_t size) {
+        std::string data = "{";
+        for (int i = 0; data.size() < size; i++) {
+            data.append("\"sic1_puzzle_").append(std::to_string(i)).append("\":\"{\\\"unlocked\\\":true,\\\"solved\\\":true,\\\"code\\\":\\\"; Program ");
+            data.append(std::to_string(i)).append("\\\\n@loop:\\\\nsubleq @tmp, @IN\\\\nsubleq @OUT, @tmp\\\\nsubleq @tmp, @tmp, @loop\\\\n@tmp: .data 0\\\"}\",");
+            if (i % 16 == 0) {
+                data.append("\"sic1_user_").append(std::to_string(i)).append("\":\"J\xc3\xbcrgen \xe2\x98\x85\",");
+            }
+        }
+        data.append("\"end\":\"\"}");
+        return data;
+    }
+
+    double MeasureMilliseconds(const std::function<void()>& run) {
+        // Best of several runs
+        double best = std::numeric_limits<double>::infinity();
+        for (int i = 0; i < 5; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (elapsed < best) {
+                best = elapsed;
+            }
+        }
+        return best;
+    }
+
+    void Report(const char* name, double codecvtMilliseconds, double textMilliseconds) {
+        std::printf("%-8s codecvt: %8.2f ms, Text: %8.2f ms (%.1fx)\n", name, codecvtMilliseconds, textMilliseconds, codecvtMilliseconds / textMilliseconds);
+    }
+}
+
+int main(int argc, char** argv) {
+    const size_t megabytes = (argc > 1) ? static_cast<size_t>(std::atoi(argv[1])) : 8;
+    const std::string data = CreateSaveData(megabytes * 1024 * 1024);
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "sic1-text-bench.json";
+    {
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    // Note: codecvt_utf8_utf16 is used (rather than codecvt_utf8) so that both sides produce UTF-16 on every platform
+    const std::locale utf8Locale(std::locale::classic(), new std::codecvt_utf8_utf16<wchar_t>);
+    std::wstring codecvtText;
+    const double codecvtRead = MeasureMilliseconds([&]() {
+        std::wifstream file(path);
+        file.imbue(utf8Locale);
+        std::wstringstream stream;
+        stream << file.rdbuf();
+        codecvtText = stream.str();
+    });
+
+    std::wstring text;
+    const double textRead = MeasureMilliseconds([&]() {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        std::string bytes(static_cast<size_t>(std::filesystem::file_size(path)), '\0');
+        file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!Text::TryUtf8ToUtf16(std::string_view(bytes), text)) {
+            std::abort();
+        }
+    });
+
+    if (text != codecvtText) {
+        std::fprintf(stderr, "Decoded text doesn't match!\n");
+        return EXIT_FAILURE;
+    }
+
+    const double codecvtWrite = MeasureMilliseconds([&]() {
+        std::wofstream file(path, std::ios::out | std::ios::trunc);
+        file.imbue(utf8Locale);
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    });
+
+    const double textWrite = MeasureMilliseconds([&]() {
+        std::string bytes;
+        if (!Text::TryUtf16ToUtf8(std::wstring_view(text), bytes)) {
+            std::abort();
+        }
+
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    });
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+
+    std::printf("Save data: %zu bytes\n", data.size());
+    Report("Read:", codecvtRead, textRead);
+    Report("Write:", codecvtWrite, textWrite);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+#include "text.h"
+#include "check.h"
+
+#include <random>
+
+namespace {
+    // Reference encoder, one code point at a time
+    void AppendUtf8(std::string& output, uint32_t codePoint) {
+        if (codePoint < 0x80) {
+            output.push_back(static_cast<char>(codePoint));
+        }
+        else if (codePoint < 0x800) {
+            output.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+            output.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        }
+        else if (codePoint < 0x10000) {
+            output.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+            output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+            output.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        }
+        else {
+            output.push_back(static_cast<char>(0xf0 | (codePoint >> 18)));
+            output.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f)));
+            output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+            output.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        }
+    }
+
+    void AppendUtf16(std::u16string& output, uint32_t codePoint) {
+        if (codePoint >= 0x10000) {
+            codePoint -= 0x10000;
+            output.push_back(static_cast<char16_t>(0xd800 | (codePoint >> 10)));
+            output.push_back(static_cast<char16_t>(0xdc00 | (codePoint & 0x3ff)));
+        }
+        else {
+            output.push_back(static_cast<char16_t>(codePoint));
+        }
+    }
+
+    bool IsValidUtf8(std::string_view utf8) {
+        std::u16string utf16;
+        return Text::TryUtf8ToUtf16(utf8, utf16);
+    }
+
+    void TestKnownValues() {
+        std::u16string utf16;
+        CHECK(Text::TryUtf8ToUtf16(std::string_view(""), utf16));
+        CHECK(utf16.empty());
+
+        // 1, 2, 3, and 4 byte sequences (the last one is a surrogate pair in UTF-16)
+        const std::string utf8 = "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80z";
+        CHECK(Text::TryUtf8ToUtf16(std::string_view(utf8), utf16));
+        CHECK(utf16 == u"aé€\U0001f600z");
+
+        std::string roundTripped;
+        CHECK(Text::TryUtf16ToUtf8(std::u16string_view(utf16), roundTripped));
+        CHECK(roundTripped == utf8);
+
+        // wchar_t is 32 bits outside of Windows, but still holds UTF-16 code units
+        std::wstring wide;
+        CHECK(Text::TryUtf8ToUtf16(std::string_view(utf8), wide));
+        CHECK_EQUAL(size_t(6), wide.size());
+        CHECK(Text::TryUtf16ToUtf8(std::wstring_view(wide), roundTripped));
+        CHECK(roundTripped == utf8);
+    }
+
+    void TestMalformedUtf8() {
+        const char* const malformed[] = {
+            "\x80",             // Unexpected continuation byte
+            "\xc0\xaf",         // Overlong (2 bytes)
+            "\xc1\xbf",         // Overlong (2 bytes)
+            "\xe0\x80\xaf",     // Overlong (3 bytes)
+            "\xf0\x80\x80\xaf", // Overlong (4 bytes)
+            "\xed\xa0\x80",     // Surrogate
+            "\xf4\x90\x80\x80", // Above U+10FFFF
+            "\xf5\x80\x80\x80", // Invalid lead byte
+            "\xff",             // Invalid lead byte
+            "\xc3",             // Truncated
+            "\xe2\x82",         // Truncated
+            "\xe2\x28\xa1",     // Bad continuation byte
+        };
+
+        for (const char* sequence : malformed) {
+            // Test each sequence on its own, after a long ASCII run (i.e. after the vectorized path), and before one
+            CHECK(!IsValidUtf8(sequence));
+            CHECK(!IsValidUtf8(std::string(37, 'x') + sequence));
+            CHECK(!IsValidUtf8(std::string(sequence) + std::string(37, 'x')));
+        }
+    }
+
+    void TestMalformedUtf16() {
+        std::string utf8;
+        CHECK(!Text::TryUtf16ToUtf8(std::u16string_view(u"\xd800"), utf8));         // Unpaired high surrogate
+        CHECK(!Text::TryUtf16ToUtf8(std::u16string_view(u"a\xdc00" u"b"), utf8));   // Unpaired low surrogate
+        CHECK(!Text::TryUtf16ToUtf8(std::u16string_view(u"\xd800" u"a"), utf8));   // High surrogate without a low one
+
+        // Not a UTF-16 code unit at all
+        const char32_t notCodeUnit[] = { 0x110000, 0 };
+        CHECK(!Text::TryUtf16ToUtf8(std::u32string_view(notCodeUnit), utf8));
+    }
+
+    void TestRandomRoundTrips() {
+        std::mt19937 random(1);
+        std::uniform_int_distribution<int> kindDistribution(0, 9);
+        std::uniform_int_distribution<uint32_t> asciiDistribution(0, 0x7f);
+        std::uniform_int_distribution<uint32_t> codePointDistribution(0x80, 0x10ffff);
+        for (int iteration = 0; iteration < 2000; iteration++) {
+            // Mostly ASCII (like save data), with runs of varying length to exercise the vectorized paths' boundaries
+            std::string utf8;
+            std::u16string expected;
+            const size_t length = static_cast<size_t>(random() % 200);
+            for (size_t i = 0; i < length; i++) {
+                uint32_t codePoint = (kindDistribution(random) < 8) ? asciiDistribution(random) : codePointDistribution(random);
+                if (codePoint >= 0xd800 && codePoint <= 0xdfff) {
+                    codePoint = 0xfffd;
+                }
+
+                AppendUtf8(utf8, codePoint);
+                AppendUtf16(expected, codePoint);
+            }
+
+            std::u16string utf16;
+            CHECK(Text::TryUtf8ToUtf16(std::string_view(utf8), utf16));
+            CHECK(utf16 == expected);
+
+            std::string roundTripped;
+            CHECK(Text::TryUtf16ToUtf8(std::u16string_view(utf16), roundTripped));
+            CHECK(roundTripped == utf8);
+
+            // Corrupting a random byte must either be rejected or still decode to something that round-trips
+            if (!utf8.empty()) {
+                std::string corrupted = utf8;
+                corrupted[random() % corrupted.size()] = static_cast<char>(random() & 0xff);
+                if (Text::TryUtf8ToUtf16(std::string_view(corrupted), utf16)) {
+                    CHECK(Text::TryUtf16ToUtf8(std::u16string_view(utf16), roundTripped));
+                    CHECK(roundTripped == corrupted);
+                }
+            }
+        }
+    }
+
+    void TestSplitAndTrim() {
+        const auto lines = Text::Split(std::wstring_view(L"a=1\n\n  b = 2 \r\nc"), L'\n');
+        CHECK_EQUAL(size_t(4), lines.size());
+        CHECK(lines[1].empty());
+        CHECK(Text::Trim(lines[2]) == L"b = 2");
+        CHECK(Text::Trim(lines[3]) == L"c");
+        CHECK(Text::Trim(std::wstring_view(L" \t\r\n")).empty());
+    }
+}
+
+int main() {
+    TestKnownValues();
+    TestMalformedUtf8();
+    TestMalformedUtf16();
+    TestRandomRoundTrips();
+    TestSplitAndTrim();
+    RETURN_CHECK_RESULT();
+}
@@ -0,0 +1,381 @@
+#include "tracer.h"
+#include "check.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <thread>
+
+using namespace Tracing;
+
+namespace {
+    // Minimal strict JSON parser (enough to check that traces are well-formed and to read them back)
+    struct Value {
+        enum class Kind { Null, Boolean, Number, String, Array, Object };
+
+        Kind kind = Kind::Null;
+        bool boolean = false;
+        int64_t number = 0;
+        std::string string;
+        std::vector<Value> items;
+        std::vector<std::string> memberNames;
+        std::vector<Value> memberValues;
+
+        const Value* Find(const std::string& name) const {
+            for (size_t i = 0; i < memberNames.size(); i++) {
+                if (memberNames[i] == name) {
+                    return &memberValues[i];
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    class JsonParser {
+    public:
+        explicit JsonParser(const std::string& json) : m_json(json), m_position(0) {
+        }
+
+        // Returns false on malformed JSON (including trailing characters)
+        bool TryParse(Value& value) {
+            return TryParseValue(value) && (SkipWhitespace(), m_position == m_json.size());
+        }
+
+    private:
+        void SkipWhitespace() {
+            while (m_position < m_json.size() && (m_json[m_position] == ' ' || m_json[m_position] == '\t' || m_json[m_position] == '\r' || m_json[m_position] == '\n')) {
+                m_position++;
+            }
+        }
+
+        bool TryConsume(char c) {
+            SkipWhitespace();
+            if (m_position < m_json.size() && m_json[m_position] == c) {
+                m_position++;
+                return true;
+            }
+            return false;
+        }
+
+        bool TryConsumeLiteral(const char* literal) {
+            const std::string_view view(literal);
+            if (m_json.compare(m_position, view.size(), view) == 0) {
+                m_position += view.size();
+                return true;
+            }
+            return false;
+        }
+
+        bool TryParseString(std::string& str) {
+            if (!TryConsume('"')) {
+                return false;
+            }
+
+            while (m_position < m_json.size()) {
+                const char c = m_json[m_position++];
+                if (c == '"') {
+                    return true;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20) {
+                    return false;
+                }
+                else if (c != '\\') {
+                    str.push_back(c);
+                    continue;
+                }
+
+                if (m_position >= m_json.size()) {
+                    return false;
+                }
+
+                switch (m_json[m_position++]) {
+                case '"': str.push_back('"'); break;
+                case '\\': str.push_back('\\'); break;
+                case '/': str.push_back('/'); break;
+                case 'b': str.push_back('\b'); break;
+                case 'f': str.push_back('\f'); break;
+                case 'n': str.push_back('\n'); break;
+                case 'r': str.push_back('\r'); break;
+                case 't': str.push_back('\t'); break;
+                case 'u': {
+                    // Note: only ASCII escapes are needed here
+                    if (m_position + 4 > m_json.size()) {
+                        return false;
+                    }
+
+                    unsigned int codeUnit = 0;
+                    for (int i = 0; i < 4; i++) {
+                        const char digit = m_json[m_position++];
+                        codeUnit <<= 4;
+                        if (digit >= '0' && digit <= '9') {
+                            codeUnit |= static_cast<unsigned int>(digit - '0');
+                        }
+                        else if (digit >= 'a' && digit <= 'f') {
+                            codeUnit |= static_cast<unsigned int>(digit - 'a' + 10);
+                        }
+                        else if (digit >= 'A' && digit <= 'F') {
+                            codeUnit |= static_cast<unsigned int>(digit - 'A' + 10);
+                        }
+                        else {
+                            return false;
+                        }
+                    }
+
+                    if (codeUnit >= 0x80) {
+                        return false;
+                    }
+                    str.push_back(static_cast<char>(codeUnit));
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        bool TryParseValue(Value& value) {
+            SkipWhitespace();
+            if (m_position >= m_json.size()) {
+                return false;
+            }
+
+            const char c = m_json[m_position];
+            if (c == '{') {
+                m_position++;
+                value.kind = Value::Kind::Object;
+                if (TryConsume('}')) {
+                    return true;
+                }
+
+                do {
+                    std::string name;
+                    Value member;
+                    if (!TryParseString(name) || value.Find(name) || !TryConsume(':') || !TryParseValue(member)) {
+                        return false;
+                    }
+                    value.memberNames.push_back(std::move(name));
+                    value.memberValues.push_back(std::move(member));
+                } while (TryConsume(','));
+                return TryConsume('}');
+            }
+            else if (c == '[') {
+                m_position++;
+                value.kind = Value::Kind::Array;
+                if (TryConsume(']')) {
+                    return true;
+                }
+
+                do {
+                    Value item;
+                    if (!TryParseValue(item)) {
+                        return false;
+                    }
+                    value.items.push_back(std::move(item));
+                } while (TryConsume(','));
+                return TryConsume(']');
+            }
+            else if (c == '"') {
+                value.kind = Value::Kind::String;
+                return TryParseString(value.string);
+            }
+            else if (c == '-' || (c >= '0' && c <= '9')) {
+                // Note: only integers are needed here
+                value.kind = Value::Kind::Number;
+                const bool negative = (c == '-');
+                if (negative) {
+                    m_position++;
+                }
+
+                const size_t start = m_position;
+                while (m_position < m_json.size() && m_json[m_position] >= '0' && m_json[m_position] <= '9') {
+                    value.number = value.number * 10 + (m_json[m_position++] - '0');
+                }
+
+                const size_t digitCount = m_position - start;
+                if (digitCount == 0 || (digitCount > 1 && m_json[start] == '0')) {
+                    return false;
+                }
+
+                value.number = negative ? -value.number : value.number;
+                return true;
+            }
+            else if (TryConsumeLiteral("true") || TryConsumeLiteral("false")) {
+                value.kind = Value::Kind::Boolean;
+                value.boolean = (c == 't');
+                return true;
+            }
+            else if (TryConsumeLiteral("null")) {
+                return true;
+            }
+            return false;
+        }
+
+        const std::string& m_json;
+        size_t m_position;
+    };
+
+    struct Span {
+        std::string name;
+        int64_t start;
+        int64_t end;
+    };
+
+    void TestJsonParser() {
+        const char* const valid[] = { "{}", "[]", " { \"a\" : [ 1, -2, \"x\\u0001\" ], \"b\": null } ", "[true,false,0]" };
+        const char* const invalid[] = { "", "{", "{\"a\":1,}", "[1 2]", "{\"a\":1,\"a\":2}", "\"\x01\"", "01", "{} x" };
+        for (const char* json : valid) {
+            Value value;
+            CHECK(JsonParser(json).TryParse(value));
+        }
+        for (const char* json : invalid) {
+            Value value;
+            CHECK(!JsonParser(json).TryParse(value));
+        }
+    }
+
+    void TestEmptyTrace() {
+        Tracer tracer;
+        Value trace;
+        CHECK(JsonParser(tracer.ToChromeTraceJson()).TryParse(trace));
+        const Value* events = trace.Find("traceEvents");
+        CHECK(events && events->kind == Value::Kind::Array && events->items.empty());
+    }
+
+    void TestNestedPhasesFromThreads() {
+        // Each thread records an outer phase containing two nested ones (and an instant), with names that need escaping
+        constexpr int threadCount = 4;
+        constexpr int iterationCount = 50;
+        const char* const innerNames[] = { "load \"settings\"", "parse\\line\ttab\x01" };
+        Tracer tracer;
+        {
+            auto scope = tracer.Trace("main");
+            std::vector<std::thread> threads;
+            for (int i = 0; i < threadCount; i++) {
+                threads.emplace_back([&tracer, &innerNames]() {
+                    for (int j = 0; j < iterationCount; j++) {
+                        auto outer = tracer.Trace("outer");
+                        for (const char* name : innerNames) {
+                            auto inner = tracer.Trace(name);
+                            std::this_thread::yield();
+                        }
+                        tracer.AddInstant("instant");
+                    }
+                });
+            }
+
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }
+
+        const std::string json = tracer.ToChromeTraceJson();
+        Value trace;
+        CHECK(JsonParser(json).TryParse(trace));
+        CHECK(trace.kind == Value::Kind::Object);
+
+        const Value* displayTimeUnit = trace.Find("displayTimeUnit");
+        CHECK(displayTimeUnit && displayTimeUnit->string == "ms");
+
+        const Value* events = trace.Find("traceEvents");
+        CHECK(events && events->kind == Value::Kind::Array);
+        if (!events) {
+            return;
+        }
+
+        CHECK_EQUAL(size_t(1 + threadCount * iterationCount * 4), events->items.size());
+
+        // Group spans by thread
+        std::vector<std::vector<Span>> threadSpans(threadCount + 2);
+        int instantCount = 0;
+        for (const Value& event : events->items) {
+            const Value* name = event.Find("name");
+            const Value* category = event.Find("cat");
+            const Value* phase = event.Find("ph");
+            const Value* timestamp = event.Find("ts");
+            const Value* duration = event.Find("dur");
+            const Value* processId = event.Find("pid");
+            const Value* threadId = event.Find("tid");
+            const bool wellFormed = name && name->kind == Value::Kind::String
+                && category && category->string == "startup"
+                && phase && (phase->string == "X" || phase->string == "i")
+                && timestamp && timestamp->kind == Value::Kind::Number && timestamp->number >= 0
+                && processId && processId->kind == Value::Kind::Number && processId->number == 1
+                && threadId && threadId->kind == Value::Kind::Number && threadId->number >= 1 && threadId->number <= threadCount + 1;
+            CHECK(wellFormed);
+            if (!wellFormed) {
+                continue;
+            }
+
+            if (phase->string == "X") {
+                CHECK(duration && duration->kind == Value::Kind::Number && duration->number >= 0);
+                if (duration) {
+                    threadSpans[static_cast<size_t>(threadId->number)].push_back({ name->string, timestamp->number, timestamp->number + duration->number });
+                }
+            }
+            else {
+                const Value* scope = event.Find("s");
+                CHECK(!duration && scope && scope->string == "g" && name->string == "instant");
+                instantCount++;
+            }
+        }
+
+        CHECK_EQUAL(threadCount * iterationCount, instantCount);
+
+        // The main thread recorded its span last, and it encloses everything else
+        const Span* mainSpan = nullptr;
+        std::set<std::string> names;
+        for (size_t threadIndex = 1; threadIndex < threadSpans.size(); threadIndex++) {
+            for (const Span& span : threadSpans[threadIndex]) {
+                names.insert(span.name);
+                if (span.name == "main") {
+                    mainSpan = &span;
+                }
+            }
+        }
+
+        CHECK(names == std::set<std::string>({ "main", "outer", innerNames[0], innerNames[1] }));
+        CHECK(mainSpan != nullptr);
+
+        // Every worker thread has its own tid, and its inner phases nest within the outer one that ends after them
+        int workerThreadCount = 0;
+        for (const std::vector<Span>& spans : threadSpans) {
+            if (spans.empty() || spans[0].name == "main") {
+                continue;
+            }
+
+            workerThreadCount++;
+            CHECK_EQUAL(size_t(iterationCount * 3), spans.size());
+            for (size_t i = 0; i + 2 < spans.size(); i += 3) {
+                const Span& first = spans[i];
+                const Span& second = spans[i + 1];
+                const Span& outer = spans[i + 2];
+                CHECK(first.name == innerNames[0] && second.name == innerNames[1] && outer.name == "outer");
+                CHECK(outer.start <= first.start && first.end <= second.start && second.end <= outer.end);
+                CHECK(!mainSpan || (mainSpan->start <= outer.start && outer.end <= mainSpan->end));
+            }
+        }
+
+        CHECK_EQUAL(threadCount, workerThreadCount);
+
+        // The file matches the in-memory trace
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "sic1-tracer-test.json";
+        CHECK(tracer.TryWriteChromeTrace(path));
+        {
+            std::ifstream file(path, std::ios::in | std::ios::binary);
+            const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            CHECK(contents == json);
+        }
+
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+}
+
+int main() {
+    TestJsonParser();
+    TestEmptyTrace();
+    TestNestedPhasesFromThreads();
+    RETURN_CHECK_RESULT();
+}
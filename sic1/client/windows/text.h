@@ -0,0 +1,279 @@
+#pragma once
+
+// Portable (i.e. no Windows dependencies) text helpers: validating UTF-8/UTF-16 transcoding and string_view-based
+// splitting/trimming. The transcoders take a vectorized fast path for runs of ASCII, which is what the save data
+// consists of almost entirely.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SIC1_TEXT_SSE2 1
+#endif
+
+namespace Text {
+	namespace Internal {
+		// Returns the length of the leading run of ASCII bytes
+		inline size_t CountAscii(const unsigned char* data, size_t size) {
+			size_t i = 0;
+#ifdef SIC1_TEXT_SSE2
+			for (; i + 16 <= size; i += 16) {
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				if (_mm_movemask_epi8(chunk) != 0) {
+					break;
+				}
+			}
+#endif
+			for (; i + 8 <= size; i += 8) {
+				uint64_t word;
+				memcpy(&word, data + i, sizeof(word));
+				if ((word & 0x8080808080808080ull) != 0) {
+					break;
+				}
+			}
+			while (i < size && data[i] < 0x80) {
+				++i;
+			}
+			return i;
+		}
+
+		// Widens a run of ASCII bytes (already known to be ASCII) into code units
+		template<typename TChar>
+		inline void WidenAscii(const unsigned char* in, size_t count, TChar* out) {
+			size_t i = 0;
+#ifdef SIC1_TEXT_SSE2
+			if constexpr (sizeof(TChar) == 2) {
+				const __m128i zero = _mm_setzero_si128();
+				for (; i + 16 <= count; i += 16) {
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi8(chunk, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpackhi_epi8(chunk, zero));
+				}
+			}
+#endif
+			for (; i < count; i++) {
+				out[i] = static_cast<TChar>(in[i]);
+			}
+		}
+
+		// Returns the length of the leading run of code units that are ASCII
+		template<typename TChar>
+		inline size_t CountAsciiUnits(const TChar* data, size_t size) {
+			size_t i = 0;
+#ifdef SIC1_TEXT_SSE2
+			if constexpr (sizeof(TChar) == 2) {
+				const __m128i highBits = _mm_set1_epi16(static_cast<short>(0xff80));
+				const __m128i zero = _mm_setzero_si128();
+				for (; i + 8 <= size; i += 8) {
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, highBits), zero)) != 0xffff) {
+						break;
+					}
+				}
+			}
+#endif
+			while (i < size && static_cast<uint32_t>(data[i]) < 0x80) {
+				++i;
+			}
+			return i;
+		}
+
+		// Narrows a run of ASCII code units (already known to be ASCII) into bytes
+		template<typename TChar>
+		inline void NarrowAscii(const TChar* in, size_t count, char* out) {
+			size_t i = 0;
+#ifdef SIC1_TEXT_SSE2
+			if constexpr (sizeof(TChar) == 2) {
+				for (; i + 16 <= count; i += 16) {
+					const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+					const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, high));
+				}
+			}
+#endif
+			for (; i < count; i++) {
+				out[i] = static_cast<char>(in[i]);
+			}
+		}
+	}
+
+	// Decodes UTF-8 into UTF-16 code units (TChar must be at least 16 bits wide). Returns false (leaving output in an
+	// unspecified state) on malformed input, overlong encodings, surrogates, or code points above U+10FFFF.
+	template<typename TChar>
+	inline bool TryUtf8ToUtf16(std::string_view input, std::basic_string<TChar>& output) {
+		static_assert(sizeof(TChar) >= 2, "UTF-16 code units must be at least 16 bits wide");
+
+		// Every UTF-8 byte produces at most one UTF-16 code unit, so a single allocation is sufficient
+		output.resize(input.size());
+		const unsigned char* in = reinterpret_cast<const unsigned char*>(input.data());
+		const size_t size = input.size();
+		TChar* out = output.data();
+		size_t i = 0;
+		size_t o = 0;
+		while (i < size) {
+			const size_t asciiCount = Internal::CountAscii(in + i, size - i);
+			Internal::WidenAscii(in + i, asciiCount, out + o);
+			i += asciiCount;
+			o += asciiCount;
+
+			// Decode any multi-byte sequences (stop at the next ASCII byte, to return to the fast path)
+			while (i < size && in[i] >= 0x80) {
+				const unsigned char lead = in[i];
+				uint32_t codePoint;
+				size_t length;
+				unsigned char secondMin = 0x80;
+				unsigned char secondMax = 0xbf;
+				if (lead >= 0xc2 && lead <= 0xdf) {
+					length = 2;
+					codePoint = lead & 0x1f;
+				}
+				else if (lead >= 0xe0 && lead <= 0xef) {
+					length = 3;
+					codePoint = lead & 0x0f;
+					if (lead == 0xe0) {
+						secondMin = 0xa0; // Overlong
+					}
+					else if (lead == 0xed) {
+						secondMax = 0x9f; // Surrogates
+					}
+				}
+				else if (lead >= 0xf0 && lead <= 0xf4) {
+					length = 4;
+					codePoint = lead & 0x07;
+					if (lead == 0xf0) {
+						secondMin = 0x90; // Overlong
+					}
+					else if (lead == 0xf4) {
+						secondMax = 0x8f; // Above U+10FFFF
+					}
+				}
+				else {
+					return false;
+				}
+
+				if (size - i < length || in[i + 1] < secondMin || in[i + 1] > secondMax) {
+					return false;
+				}
+
+				for (size_t j = 1; j < length; j++) {
+					const unsigned char continuation = in[i + j];
+					if ((continuation & 0xc0) != 0x80) {
+						return false;
+					}
+					codePoint = (codePoint << 6) | (continuation & 0x3f);
+				}
+
+				if (codePoint >= 0x10000) {
+					codePoint -= 0x10000;
+					out[o++] = static_cast<TChar>(0xd800 | (codePoint >> 10));
+					out[o++] = static_cast<TChar>(0xdc00 | (codePoint & 0x3ff));
+				}
+				else {
+					out[o++] = static_cast<TChar>(codePoint);
+				}
+				i += length;
+			}
+		}
+
+		output.resize(o);
+		return true;
+	}
+
+	// Encodes UTF-16 code units as UTF-8. Returns false (leaving output in an unspecified state) on unpaired surrogates.
+	template<typename TChar>
+	inline bool TryUtf16ToUtf8(std::basic_string_view<TChar> input, std::string& output) {
+		static_assert(sizeof(TChar) >= 2, "UTF-16 code units must be at least 16 bits wide");
+
+		// Every UTF-16 code unit produces at most three UTF-8 bytes (surrogate pairs produce four bytes from two units)
+		output.resize(input.size() * 3);
+		const TChar* in = input.data();
+		const size_t size = input.size();
+		char* out = output.data();
+		size_t i = 0;
+		size_t o = 0;
+		while (i < size) {
+			const size_t asciiCount = Internal::CountAsciiUnits(in + i, size - i);
+			Internal::NarrowAscii(in + i, asciiCount, out + o);
+			i += asciiCount;
+			o += asciiCount;
+
+			while (i < size && static_cast<uint32_t>(in[i]) >= 0x80) {
+				uint32_t codePoint = static_cast<uint32_t>(in[i++]);
+				if (codePoint >= 0xd800 && codePoint <= 0xdbff) {
+					if (i >= size) {
+						return false;
+					}
+
+					const uint32_t trail = static_cast<uint32_t>(in[i]);
+					if (trail < 0xdc00 || trail > 0xdfff) {
+						return false;
+					}
+
+					++i;
+					codePoint = 0x10000 + (((codePoint - 0xd800) << 10) | (trail - 0xdc00));
+				}
+				else if ((codePoint >= 0xdc00 && codePoint <= 0xdfff) || codePoint > 0xffff) {
+					return false;
+				}
+
+				if (codePoint < 0x800) {
+					out[o++] = static_cast<char>(0xc0 | (codePoint >> 6));
+					out[o++] = static_cast<char>(0x80 | (codePoint & 0x3f));
+				}
+				else if (codePoint < 0x10000) {
+					out[o++] = static_cast<char>(0xe0 | (codePoint >> 12));
+					out[o++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+					out[o++] = static_cast<char>(0x80 | (codePoint & 0x3f));
+				}
+				else {
+					out[o++] = static_cast<char>(0xf0 | (codePoint >> 18));
+					out[o++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+					out[o++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+					out[o++] = static_cast<char>(0x80 | (codePoint & 0x3f));
+				}
+			}
+		}
+
+		output.resize(o);
+		return true;
+	}
+
+	// Splits without copying; the returned views point into str
+	template<typename TChar>
+	inline std::vector<std::basic_string_view<TChar>> Split(std::basic_string_view<TChar> str, TChar separator) {
+		std::vector<std::basic_string_view<TChar>> chunks;
+		size_t position = 0;
+		while (position < str.size()) {
+			auto endOfChunk = str.find(separator, position);
+			if (endOfChunk == std::basic_string_view<TChar>::npos) {
+				endOfChunk = str.size();
+			}
+			chunks.push_back(str.substr(position, (endOfChunk - position)));
+			position = endOfChunk + 1;
+		}
+		return chunks;
+	}
+
+	template<typename TChar>
+	inline bool IsWhitespace(TChar c) {
+		return c == static_cast<TChar>(' ') || c == static_cast<TChar>('\t') || c == static_cast<TChar>('\r') || c == static_cast<TChar>('\n');
+	}
+
+	template<typename TChar>
+	inline std::basic_string_view<TChar> Trim(std::basic_string_view<TChar> str) {
+		size_t start = 0;
+		size_t end = str.size();
+		while (start < end && IsWhitespace(str[start])) {
+			++start;
+		}
+		while (end > start && IsWhitespace(str[end - 1])) {
+			--end;
+		}
+		return str.substr(start, end - start);
+	}
+}
@@ -0,0 +1,98 @@
+#include "tracer.h"
+
+#include <fstream>
+
+using namespace Tracing;
+
+namespace {
+    void AppendJsonString(std::string& json, const std::string& str) {
+        static const char hexDigits[] = "0123456789abcdef";
+        json.push_back('"');
+        for (char c : str) {
+            switch (c) {
+            case '"': json.append("\\\""); break;
+            case '\\': json.append("\\\\"); break;
+            case '\n': json.append("\\n"); break;
+            case '\r': json.append("\\r"); break;
+            case '\t': json.append("\\t"); break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    json.append("\\u00");
+                    json.push_back(hexDigits[(c >> 4) & 0xf]);
+                    json.push_back(hexDigits[c & 0xf]);
+                }
+                else {
+                    json.push_back(c);
+                }
+                break;
+            }
+        }
+        json.push_back('"');
+    }
+}
+
+int64_t Tracer::ToMicroseconds(Clock::time_point time) const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - m_origin).count();
+}
+
+// Note: caller must hold m_lock
+uint32_t Tracer::GetCurrentThreadIndex() {
+    const auto id = std::this_thread::get_id();
+    for (size_t i = 0; i < m_threads.size(); i++) {
+        if (m_threads[i] == id) {
+            return static_cast<uint32_t>(i + 1);
+        }
+    }
+
+    m_threads.push_back(id);
+    return static_cast<uint32_t>(m_threads.size());
+}
+
+void Tracer::AddSpan(const char* name, Clock::time_point start, Clock::time_point end) {
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_events.push_back({ name, 'X', ToMicroseconds(start), ToMicroseconds(end) - ToMicroseconds(start), GetCurrentThreadIndex() });
+}
+
+void Tracer::AddInstant(const char* name) {
+    const auto now = Clock::now();
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_events.push_back({ name, 'i', ToMicroseconds(now), 0, GetCurrentThreadIndex() });
+}
+
+std::string Tracer::ToChromeTraceJson() const {
+    std::lock_guard<std::mutex> lock(m_lock);
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& event : m_events) {
+        if (!first) {
+            json.push_back(',');
+        }
+        first = false;
+
+        json.append("{\"name\":");
+        AppendJsonString(json, event.name);
+        json.append(",\"cat\":\"startup\",\"ph\":\"");
+        json.push_back(event.phase);
+        json.append("\",\"ts\":").append(std::to_string(event.timestampMicroseconds));
+        if (event.phase == 'X') {
+            json.append(",\"dur\":").append(std::to_string(event.durationMicroseconds));
+        }
+        else {
+            json.append(",\"s\":\"g\"");
+        }
+        json.append(",\"pid\":1,\"tid\":").append(std::to_string(event.threadIndex)).append("}");
+    }
+    json.append("]}");
+    return json;
+}
+
+bool Tracer::TryWriteChromeTrace(const std::filesystem::path& path) const {
+    const std::string json = ToChromeTraceJson();
+    std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    return file.good();
+}
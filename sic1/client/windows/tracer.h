@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Portable (i.e. no Windows dependencies) phase timer for measuring startup. Spans are recorded against a monotonic
+// clock and can be exported in the Chrome trace event format (load the file in chrome://tracing or Perfetto).
+namespace Tracing {
+    using Clock = std::chrono::steady_clock;
+
+    class Tracer {
+    public:
+        // Records a span from construction until destruction
+        class Scope {
+        public:
+            Scope(Tracer& tracer, const char* name) : m_tracer(tracer), m_name(name), m_start(Clock::now()) {
+            }
+
+            ~Scope() {
+                m_tracer.AddSpan(m_name, m_start, Clock::now());
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            Tracer& m_tracer;
+            const char* m_name;
+            Clock::time_point m_start;
+        };
+
+        Tracer() : m_origin(Clock::now()) {
+        }
+
+        static Clock::time_point Now() {
+            return Clock::now();
+        }
+
+        Scope Trace(const char* name) {
+            return Scope(*this, name);
+        }
+
+        // For spans that begin and end in different callbacks
+        void AddSpan(const char* name, Clock::time_point start, Clock::time_point end);
+
+        // Zero-duration marker (e.g. "first navigation completed")
+        void AddInstant(const char* name);
+
+        std::string ToChromeTraceJson() const;
+        bool TryWriteChromeTrace(const std::filesystem::path& path) const;
+
+    private:
+        struct Event {
+            std::string name;
+            char phase;
+            int64_t timestampMicroseconds;
+            int64_t durationMicroseconds;
+            uint32_t threadIndex;
+        };
+
+        int64_t ToMicroseconds(Clock::time_point time) const;
+        uint32_t GetCurrentThreadIndex();
+
+        const Clock::time_point m_origin;
+        mutable std::mutex m_lock;
+        std::vector<Event> m_events;
+        std::vector<std::thread::id> m_threads;
+    };
+}
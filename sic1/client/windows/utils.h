@@ -1,54 +1,83 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
-#include <locale>
-#include <codecvt>
-#include <limits>
-#include <fstream>
+#include <sstream>
 #include <synchapi.h>
 #include <processthreadsapi.h>
 #include <oleauto.h>
 #include <wil/result.h>
 #include <wil/resource.h>
 
+#include "text.h"
+
 namespace File {
-	inline std::locale GetLocaleUtf8() {
-		return std::locale(std::locale::empty(), new std::codecvt_utf8<wchar_t>);
+	// Reads the entire file with a single read (no large file support)
+	inline bool TryReadAllBytes(const wchar_t* fileName, std::string& result) noexcept(false) {
+		wil::unique_hfile file(CreateFileW(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr));
+		if (!file) {
+			return false;
+		}
+
+		LARGE_INTEGER size;
+		THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(file.get(), &size));
+		THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_FILE_TOO_LARGE), size.QuadPart > MAXDWORD);
+
+		std::string buffer;
+		buffer.resize(static_cast<size_t>(size.QuadPart));
+		DWORD bytesRead = 0;
+		if (!buffer.empty()) {
+			THROW_IF_WIN32_BOOL_FALSE(ReadFile(file.get(), buffer.data(), static_cast<DWORD>(buffer.size()), &bytesRead, nullptr));
+		}
+
+		buffer.resize(bytesRead);
+		result = std::move(buffer);
+		return true;
 	}
 
-	inline bool TryReadAllTextUtf8(const wchar_t* fileName, std::wstring& result) noexcept(false) {
-		std::wstring text;
-		std::wifstream file(fileName);
-		if (!file.is_open()) {
+	inline bool TryWriteAllBytes(const wchar_t* fileName, std::string_view bytes, bool append = false) noexcept(false) {
+		wil::unique_hfile file(CreateFileW(fileName, append ? FILE_APPEND_DATA : GENERIC_WRITE, FILE_SHARE_READ, nullptr, append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr));
+		if (!file) {
 			return false;
 		}
 
-		file.imbue(GetLocaleUtf8());
+		THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_FILE_TOO_LARGE), bytes.size() > MAXDWORD);
+		DWORD bytesWritten = 0;
+		if (!bytes.empty()) {
+			THROW_IF_WIN32_BOOL_FALSE(WriteFile(file.get(), bytes.data(), static_cast<DWORD>(bytes.size()), &bytesWritten, nullptr));
+		}
+		return bytesWritten == bytes.size();
+	}
+
+	inline bool TryReadAllTextUtf8(const wchar_t* fileName, std::wstring& result) noexcept(false) {
+		std::string bytes;
+		if (!TryReadAllBytes(fileName, bytes)) {
+			return false;
+		}
 
-		file.ignore((std::numeric_limits<std::streamsize>::max)());
-		size_t count = static_cast<size_t>(file.gcount()); // Note: No large file support
-		file.clear();
-		file.seekg(0, file.beg);
+		// Skip byte order mark, if present
+		std::string_view text(bytes);
+		if (text.size() >= 3 && text.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+			text.remove_prefix(3);
+		}
 
-		auto buffer = std::make_unique<wchar_t[]>(count + 1);
-		file.read(buffer.get(), count);
-		buffer[count] = L'\0';
+		std::wstring decoded;
+		if (!Text::TryUtf8ToUtf16(text, decoded)) {
+			return false;
+		}
 
-		text = buffer.get();
-		result = std::move(text);
+		result = std::move(decoded);
 		return true;
 	}
 
-	inline bool TryWriteAllTextUtf8(const wchar_t* fileName, const wchar_t* text) noexcept(false) {
-		std::wofstream file(fileName);
-		if (!file.is_open()) {
+	inline bool TryWriteAllTextUtf8(const wchar_t* fileName, std::wstring_view text, bool append = false) noexcept(false) {
+		std::string bytes;
+		if (!Text::TryUtf16ToUtf8(text, bytes)) {
 			return false;
 		}
 
-		file.imbue(GetLocaleUtf8());
-		file.write(text, wcslen(text));
-		return true;
+		return TryWriteAllBytes(fileName, bytes, append);
 	}
 }
 
@@ -121,44 +150,25 @@ namespace wilx {
 }
 
 namespace String {
-	const wchar_t* const whitespace = L" \t\r\n";
-
-	inline std::wstring Widen(const char* multibyteString) {
-		int size = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, multibyteString, -1, nullptr, 0);
-		std::unique_ptr<wchar_t[]> buffer = std::make_unique<wchar_t[]>(size);
-		THROW_LAST_ERROR_IF(MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, multibyteString, -1, buffer.get(), size) != size);
-		return std::wstring(buffer.get());
+	inline std::wstring Widen(std::string_view multibyteString) {
+		std::wstring result;
+		THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_NO_UNICODE_TRANSLATION), !Text::TryUtf8ToUtf16(multibyteString, result));
+		return result;
 	}
 
-	inline std::string Narrow(const wchar_t* wideString) {
-		int size = WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, wideString, -1, nullptr, 0, nullptr, nullptr);
-		std::unique_ptr<char[]> buffer = std::make_unique<char[]>(size);
-		THROW_LAST_ERROR_IF(WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, wideString, -1, buffer.get(), size, nullptr, nullptr) != size);
-		return std::string(buffer.get());
+	inline std::string Narrow(std::wstring_view wideString) {
+		std::string result;
+		THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_NO_UNICODE_TRANSLATION), !Text::TryUtf16ToUtf8(wideString, result));
+		return result;
 	}
 
-	inline std::vector<std::wstring> Split(const std::wstring& str, wchar_t separator) {
-		std::vector<std::wstring> chunks;
-		size_t position = 0;
-		while (position < str.size()) {
-			auto endOfChunk = str.find(separator, position);
-			if (endOfChunk == std::wstring::npos) {
-				endOfChunk = str.size();
-			}
-			chunks.push_back(str.substr(position, (endOfChunk - position)));
-			position = endOfChunk + 1;
-		}
-		return chunks;
+	// Note: the returned views point into str, so str must outlive them
+	inline std::vector<std::wstring_view> Split(std::wstring_view str, wchar_t separator) {
+		return Text::Split(str, separator);
 	}
 
-	inline std::wstring Trim(const std::wstring& str) {
-		if (str.empty()) {
-			return L"";
-		}
-
-		auto startPosition = str.find_first_not_of(whitespace);
-		auto endPosition = str.find_last_not_of(whitespace);
-		return str.substr(startPosition, endPosition - startPosition + 1);
+	inline std::wstring_view Trim(std::wstring_view str) {
+		return Text::Trim(str);
 	}
 }
 
@@ -177,12 +187,7 @@ namespace Ini {
 	template<typename T>
 	inline bool StructToIni(T* s, const wchar_t* fileName, const StructIniField* fields, size_t fieldCount) {
 		try {
-			std::wofstream file(fileName);
-			if (!file.is_open()) {
-				return false;
-			}
-
-			file.imbue(File::GetLocaleUtf8());
+			std::wostringstream file;
 			for (size_t i = 0; i < fieldCount; i++) {
 				const auto field = fields[i];
 				file << field.name << L"=";
@@ -201,7 +206,7 @@ namespace Ini {
 				}
 				file << L"\n";
 			}
-			return true;
+			return File::TryWriteAllTextUtf8(fileName, file.str());
 		}
 		catch (...) {
 			return false;
@@ -216,24 +221,24 @@ namespace Ini {
 				return false;
 			}
 
-			std::vector<std::wstring> lines = String::Split(content, L'\n');
+			const auto lines = String::Split(content, L'\n');
 			for (const auto& line : lines) {
 				const auto trimmed = String::Trim(line);
-				if (trimmed[0] == L';') {
+				if (trimmed.empty() || trimmed[0] == L';') {
 					continue;
 				}
 
 				const auto equalsPosition = trimmed.find(L"=");
-				if (equalsPosition == std::wstring::npos) {
+				if (equalsPosition == std::wstring_view::npos) {
 					return false;
 				}
 
 				const auto fieldName = trimmed.substr(0, equalsPosition);
-				const auto fieldValue = trimmed.substr(equalsPosition + 1, trimmed.size() - equalsPosition - 1);
+				const std::wstring fieldValue(trimmed.substr(equalsPosition + 1));
 				bool found = false;
 				for (size_t i = 0; i < fieldCount; i++) {
 					const auto& field = fields[i];
-					if (CompareStringOrdinal(field.name, -1, fieldName.c_str(), -1, TRUE) == CSTR_EQUAL) {
+					if (CompareStringOrdinal(field.name, -1, fieldName.data(), static_cast<int>(fieldName.size()), TRUE) == CSTR_EQUAL) {
 						found = true;
 						switch (field.type) {
 						case StructIniFieldType::Int32: {
@@ -5,6 +5,7 @@
 #include "wvwindow.h"
 #include "utils.h"
 #include "promisehandler.h"
+#include "metrics.h"
 
 typedef struct {
 	const wchar_t* fieldName;
@@ -38,13 +39,14 @@ void ForMatchingPresentationSetting(BSTR name, std::function<void(const Presenta
 	THROW_HR(TYPE_E_FIELDNOTFOUND);
 }
 
-WebViewWindow::WebViewWindow(HWND hWnd, PresentationSettings* presentationSettings, std::function<void(const wchar_t* data)> persistLocalStorage, std::function<void()> persistPresentationSettings)
+WebViewWindow::WebViewWindow(HWND hWnd, PresentationSettings* presentationSettings, LocalStorage::Store* localStorage, std::function<void()> persistLocalStorage, std::function<void()> persistPresentationSettings)
 	: m_closing(false),
 	m_fullscreen(false),
 	m_hWnd(hWnd),
 	m_preFullscreenBounds(),
 	m_presentationSettings(presentationSettings),
 	m_presentationSettingsModified(false),
+	m_localStorage(localStorage),
 	m_persistLocalStorage(persistLocalStorage),
 	m_persistPresentationSettings(persistPresentationSettings)
 {
@@ -140,26 +142,32 @@ STDMETHODIMP WebViewWindow::SetPresentationSetting(BSTR name, VARIANT data) try
 }
 CATCH_RETURN();
 
-STDMETHODIMP WebViewWindow::ResolvePersistLocalStorage(VARIANT resolve, VARIANT reject, BSTR dataIn) try {
-	if (!m_closing) {
-		wil::shared_bstr data(wilx::make_unique_bstr(dataIn));
+STDMETHODIMP WebViewWindow::ResolvePersistLocalStorageChanges(VARIANT resolve, VARIANT reject, UINT32 sequence, BSTR changes) try {
+	// Changes are applied immediately (even while closing, since the final changes arrive from the OnClosing callback),
+	// but written out on the persistence thread
+	THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), !m_localStorage->TryApplyChanges(sequence, std::wstring_view(changes, SysStringLen(changes))));
 
-		Promise::ExecutePromiseOnThreadPool(resolve, reject, std::make_shared<Promise::Handler>(
-			[this, data](VARIANT* result)
+	if (!m_closing) {
+		Promise::ExecutePromiseOnThreadPool(Promise::Lane::Persistence, resolve, reject, std::make_shared<Promise::Handler>(
+			[this](VARIANT* result)
 			{
 				if (!m_closing) {
-					m_persistLocalStorage(data.get());
+					m_persistLocalStorage();
 				}
 			}
 		));
 	}
+	else {
+		// The final save happens during shutdown (so there's nothing left to do), but don't leave the promise pending
+		Promise::RejectPromise(reject, HRESULT_FROM_WIN32(ERROR_CANCELLED));
+	}
 	return S_OK;
 }
 CATCH_RETURN();
 
 STDMETHODIMP WebViewWindow::ResolvePersistPresentationSettings(VARIANT resolve, VARIANT reject) try {
 	if (!m_closing) {
-		Promise::ExecutePromiseOnThreadPool(resolve, reject, std::make_shared<Promise::Handler>(
+		Promise::ExecutePromiseOnThreadPool(Promise::Lane::Persistence, resolve, reject, std::make_shared<Promise::Handler>(
 			[this](VARIANT* result)
 			{
 				if (!m_closing) {
@@ -168,6 +176,9 @@ STDMETHODIMP WebViewWindow::ResolvePersistPresentationSettings(VARIANT resolve,
 			}
 		));
 	}
+	else {
+		Promise::RejectPromise(reject, HRESULT_FROM_WIN32(ERROR_CANCELLED));
+	}
 	return S_OK;
 }
 CATCH_RETURN();
@@ -183,6 +194,12 @@ STDMETHODIMP WebViewWindow::OpenManual() try {
 }
 CATCH_RETURN();
 
+STDMETHODIMP WebViewWindow::GetMetrics(BSTR* json) try {
+	*json = wilx::make_unique_bstr(String::Widen(Metrics::GetRegistry().ToJson()).c_str()).release();
+	return S_OK;
+}
+CATCH_RETURN();
+
 void WebViewWindow::OnClosing(const wil::com_ptr<ICoreWebView2> coreWebView2, std::function<void(bool)> callback) {
 	bool presentationSettingsModified = m_presentationSettingsModified;
 	m_closing = true;
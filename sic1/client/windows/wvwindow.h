@@ -5,13 +5,15 @@
 #include "WebView2.h"
 #include "host-objects_h.h"
 #include "dispatchable.h"
+#include "host-objects-dispatch.h"
 #include "common.h"
+#include "localstorage.h"
 
 #define HOST_OBJECT_WEBVIEWWINDOW_NAME L"webViewWindow"
 
 class WebViewWindow : public Dispatchable<IWebViewWindow> {
 public:
-    WebViewWindow(HWND hWnd, PresentationSettings* presentationSettings, std::function<void(const wchar_t* data)> persistLocalStorage, std::function<void()> persistPresentationSettings);
+    WebViewWindow(HWND hWnd, PresentationSettings* presentationSettings, LocalStorage::Store* localStorage, std::function<void()> persistLocalStorage, std::function<void()> persistPresentationSettings);
 
     // IWebViewWindow
     STDMETHODIMP get_Fullscreen(BOOL* fullscreen) override;
@@ -28,11 +30,13 @@ public:
     STDMETHODIMP GetPresentationSetting(BSTR name, VARIANT* data) override;
     STDMETHODIMP SetPresentationSetting(BSTR name, VARIANT data) override;
 
-    STDMETHODIMP ResolvePersistLocalStorage(VARIANT resolve, VARIANT reject, BSTR data);
+    STDMETHODIMP ResolvePersistLocalStorageChanges(VARIANT resolve, VARIANT reject, UINT32 sequence, BSTR changes);
     STDMETHODIMP ResolvePersistPresentationSettings(VARIANT resolve, VARIANT reject);
 
     STDMETHODIMP OpenManual();
 
+    STDMETHODIMP GetMetrics(BSTR* json);
+
     // Internal helpers
     void OnClosing(const wil::com_ptr<ICoreWebView2> coreWebView2, std::function<void(bool)> callback) noexcept(false);
 
@@ -49,6 +53,7 @@ private:
     bool m_presentationSettingsModified;
 
     // Data/settings peristence
-    std::function<void(const wchar_t* data)> m_persistLocalStorage;
+    LocalStorage::Store* m_localStorage;
+    std::function<void()> m_persistLocalStorage;
     std::function<void()> m_persistPresentationSettings;
 };
@@ -6,9 +6,13 @@ import BodyParser from "koa-bodyparser";
 import * as Validize from "validize";
 import * as Contract from "sic1-server-contract";
 import * as Firebase from "firebase-admin";
+import * as Zlib from "zlib";
 import * as fbc from "./fbc.json";
 import { Puzzle, shuffleInPlace, generatePuzzleTest, puzzles, puzzleCount } from "sic1-shared";
-import { AssembledProgram, Emulator } from "sic1asm";
+import { ComparatorOutputDevice, Emulator, SpanInputDevice, TraceWriter, Verifier, VerificationResult, VerificationStatus, VerifierTask } from "sic1asm";
+import { CounterDocument, FirestoreDocumentStore } from "./document-store";
+import { HistogramAggregator } from "./histogram-aggregator";
+import { createETag, ViewCache } from "./view-cache";
 
 const identity = <T extends unknown>(x: T) => x;
 
@@ -27,6 +31,25 @@ const database = (Firebase.apps?.length ? Firebase.app() : Firebase.initializeAp
 
 const root = database.collection(collectionName);
 
+// Histograms are sharded, to avoid contention on hot documents (see histogram-aggregator.ts)
+const histogramAggregator = new HistogramAggregator(new FirestoreDocumentStore(root), { shardCount: 8 });
+
+// Stats responses are cached in-process (and invalidated when this instance updates them; see view-cache.ts)
+const statsViews = new ViewCache(30 * 1000);
+
+function createPuzzleStatsViewKey(testName: string): string {
+    return `PuzzleStats_${testName}`;
+}
+
+const userStatsViewKey = "UserStats";
+const leaderboardViewKey = "Leaderboard";
+
+function setETag(context: Koa.Context, etag: string): void {
+    // Note: "no-cache" means clients should revalidate (using If-None-Match) on each use
+    context.set("Cache-Control", "no-cache");
+    context.etag = etag;
+}
+
 // Data model
 function createUserDocumentId(userId: string): string {
     return `User_${userId}`;
@@ -69,6 +92,9 @@ interface FailedRequest {
     timestamp: Firebase.firestore.Timestamp;
     message: string;
     body?: string;
+
+    /** Compressed execution trace of a failed verification (see TraceReader in sic1asm; blocks are raw deflate) */
+    trace?: Buffer;
 }
 
 function createFailedRequestDocumentId(): string {
@@ -83,6 +109,10 @@ async function saveFailedRequest(context: Koa.Context, error: any): Promise<void
         body: context.request.rawBody,
     };
 
+    if (error instanceof VerificationError && error.trace && error.trace.length <= failedRequestTraceBytesMax) {
+        data.trace = Buffer.from(error.trace);
+    }
+
     const failedRequests = database.collection(`${collectionName}_Failed`);
     await failedRequests.doc(createFailedRequestDocumentId()).set(data);
 }
@@ -91,6 +121,7 @@ async function updateUserProfile(userId: string, name: string, context: Koa.Cont
     try {
         const doc: Partial<UserDocument> = { name };
         await root.doc(createUserDocumentId(userId)).set(doc, { merge: true });
+        statsViews.invalidate(leaderboardViewKey);
     } catch (error) {
         await saveFailedRequest(context, error);
         throw error;
@@ -116,11 +147,7 @@ function createUserHistogramId() {
     return "Histogram_Users";
 }
 
-interface HistogramDocument {
-    [bucketKey: string]: number;
-}
-
-function createHistogramDataFromDocument(doc: HistogramDocument, metric: Metric): Contract.HistogramData {
+function createHistogramDataFromDocument(doc: CounterDocument, metric: Metric): Contract.HistogramData {
     const buckets: Contract.HistogramDataBucket[] = [];
     const metricString = Metric[metric];
     for (const key in doc) {
@@ -138,41 +165,53 @@ function createHistogramDataFromDocument(doc: HistogramDocument, metric: Metric)
     return buckets;
 }
 
-async function getPuzzleStats(testName: string): Promise<Contract.PuzzleStatsResponse> {
-    const reference = await root.doc(createPuzzleHistogramId(testName)).get();
-    const data = (reference.exists ? reference.data() : {}) as HistogramDocument;
-    return {
-        cyclesExecutedBySolution: createHistogramDataFromDocument(data, Metric.cycles),
-        memoryBytesAccessedBySolution: createHistogramDataFromDocument(data, Metric.bytes),
-    };
+async function getPuzzleStats(testName: string, context: Koa.Context): Promise<Contract.PuzzleStatsResponse> {
+    const view = await statsViews.get(createPuzzleStatsViewKey(testName), async () => {
+        const data = await histogramAggregator.read(createPuzzleHistogramId(testName));
+        const response: Contract.PuzzleStatsResponse = {
+            cyclesExecutedBySolution: createHistogramDataFromDocument(data, Metric.cycles),
+            memoryBytesAccessedBySolution: createHistogramDataFromDocument(data, Metric.bytes),
+        };
+        return response;
+    });
+
+    setETag(context, view.etag);
+    return view.body;
 }
 
-async function getUserStats(userId?: string): Promise<Contract.UserStatsResponse> {
-    const promises = [root.doc(createUserHistogramId()).get()];
-    if (userId) {
-        promises.push(root.doc(createUserDocumentId(userId)).get());
-    }
+async function getUserStats(context: Koa.Context, userId?: string): Promise<Contract.UserStatsResponse> {
+    const [view, userReference] = await Promise.all([
+        statsViews.get(userStatsViewKey, async () => createHistogramDataFromDocument(await histogramAggregator.read(createUserHistogramId()), Metric.solutions)),
+        userId ? root.doc(createUserDocumentId(userId)).get() : undefined,
+    ]);
 
-    const results = await Promise.all(promises);
-    const histogram = (results[0].exists ? results[0].data() : {}) as HistogramDocument;
-    const user = (userId && results[1].exists) ? results[1].data() : {};
+    const user = (userReference && userReference.exists) ? userReference.data() : {};
+    const userSolvedCount = (user as UserDocument).solvedCount || 0;
 
+    // Note: the histogram is shared, but the solved count is per-user
+    setETag(context, createETag(view.etag, `${userSolvedCount}`));
     return {
-        solutionsByUser: createHistogramDataFromDocument(histogram, Metric.solutions),
-        userSolvedCount: (user as UserDocument).solvedCount || 0,
+        solutionsByUser: view.body,
+        userSolvedCount,
     };
 }
 
-async function getLeaderboard(): Promise<Contract.LeaderboardReponse> {
-    const results = await root
-        .orderBy("solvedCount", "desc")
-        .limit(10)
-        .get();
+async function getLeaderboard(context: Koa.Context): Promise<Contract.LeaderboardReponse> {
+    const view = await statsViews.get(leaderboardViewKey, async () => {
+        const results = await root
+            .orderBy("solvedCount", "desc")
+            .limit(10)
+            .get();
 
-    return results.docs.map(doc => doc.data() as UserDocument).map(user => ({
-        name: user.name || "",
-        solved: user.solvedCount,
-    }));
+        const response: Contract.LeaderboardReponse = results.docs.map(doc => doc.data() as UserDocument).map(user => ({
+            name: user.name || "",
+            solved: user.solvedCount,
+        }));
+        return response;
+    });
+
+    setETag(context, view.etag);
+    return view.body;
 }
 
 interface Solution {
@@ -207,35 +246,45 @@ function getPuzzle(title: string): Puzzle {
     throw new Validize.ValidationError(`Test not found: ${title}`);
 }
 
-function verifyProgram(inputs: number[], expectedOutputs: number[], program: AssembledProgram, maxCyclesExecuted: number, maxMemoryBytesAccessed: number): void {
-    let inputIndex = 0;
-    let outputIndex = 0;
-
-    let correct = true;
-    let errorContext = "";
-    const emulator = new Emulator(program, {
-        readInput: () => inputs[inputIndex++],
-        writeOutput: n => {
-            const expected = expectedOutputs[outputIndex++];
-            if (n !== expected) {
-                correct = false;
-                if (errorContext === "") {
-                    errorContext = `expected ${expected} but got ${n} instead`;
-                }
-            }
-        },
+// Failed verifications include an execution trace (saved with the failed request, if it's small enough). Anyone can
+// submit failing programs, so traces are only recorded for failures that happen early, to bound the extra work.
+const failedRequestTraceBytesMax = 512 * 1024;
+const failedRequestTraceCyclesMax = 10000;
+class VerificationError extends Validize.ValidationError {
+    constructor(message: string, public trace?: Uint8Array) {
+        super(message);
+    }
+}
+
+/** Re-runs a failed verification in the (slower) emulator to record a trace, up to (and including) the failing cycle */
+function traceProgram(bytes: number[], inputs: ArrayLike<number>, expectedOutputs: ArrayLike<number>, failedAtCycle: number): Uint8Array {
+    const output = new ComparatorOutputDevice(expectedOutputs);
+    const emulator = new Emulator({ bytes, sourceMap: [], variables: [] }, {
+        input: new SpanInputDevice(inputs),
+        output,
     });
 
-    while (correct && outputIndex < expectedOutputs.length && emulator.getCyclesExecuted() <= maxCyclesExecuted && emulator.getMemoryBytesAccessed() <= maxMemoryBytesAccessed) {
+    const writer = new TraceWriter({ compressBlock: block => Zlib.deflateRawSync(block) });
+    emulator.startTracing(writer);
+
+    // Note: for exceeded limits, the failing cycle is one past the maximum, so the step that exceeded it is included
+    while (emulator.isRunning() && !output.isDone() && emulator.getCyclesExecuted() < failedAtCycle) {
         emulator.step();
     }
 
-    if (emulator.getCyclesExecuted() > maxCyclesExecuted || emulator.getMemoryBytesAccessed() > maxMemoryBytesAccessed) {
-        throw new Validize.ValidationError(`Execution did not complete within ${maxCyclesExecuted} cycles and ${maxMemoryBytesAccessed} bytes`);
-    }
+    return writer.finish()!;
+}
+
+function getVerificationErrorMessage(result: VerificationResult, maxCyclesExecuted: number, maxMemoryBytesAccessed: number): string | undefined {
+    switch (result.status) {
+        case VerificationStatus.limitExceeded:
+            return `Execution did not complete within ${maxCyclesExecuted} cycles and ${maxMemoryBytesAccessed} bytes`;
+
+        case VerificationStatus.incorrectOutput:
+            return `Incorrect output produced (${result.errorContext})`;
 
-    if (!correct) {
-        throw new Validize.ValidationError(`Incorrect output produced (${errorContext})`);
+        case VerificationStatus.halted:
+            return "Program halted before producing all output";
     }
 }
 
@@ -248,14 +297,13 @@ function verifySolution(solution: Solution): void {
         bytes.push(parseInt(solution.program.substr(i, 2), 16));
     }
 
-    const program: AssembledProgram = {
-        bytes,
-        sourceMap: [],
-        variables: [],
-    };
-
     // Verify using standard input and supplied stats
-    verifyProgram(test.testSets[0].input, test.testSets[0].output, program, solution.cyclesExecuted, solution.memoryBytesAccessed);
+    const tasks: VerifierTask[] = [{
+        input: test.testSets[0].input,
+        output: test.testSets[0].output,
+        maxCyclesExecuted: solution.cyclesExecuted,
+        maxMemoryBytesAccessed: solution.memoryBytesAccessed,
+    }];
 
     // Verify using shuffled standard input (note: this ensures the order is different)
     const shuffeldStandardIO = puzzle.io.slice();
@@ -268,17 +316,34 @@ function verifySolution(solution: Solution): void {
         shuffeldStandardIO[1] = originalFirst;
     }
 
-    verifyProgram(
-        identity<number[]>([]).concat(...shuffeldStandardIO.map(a => a[0])),
-        identity<number[]>([]).concat(...shuffeldStandardIO.map(a => a[1])),
-        program,
-        verificationMaxCycles,
-        solutionBytesMax
-    );
+    tasks.push({
+        input: identity<number[]>([]).concat(...shuffeldStandardIO.map(a => a[0])),
+        output: identity<number[]>([]).concat(...shuffeldStandardIO.map(a => a[1])),
+        maxCyclesExecuted: verificationMaxCycles,
+        maxMemoryBytesAccessed: solutionBytesMax,
+    });
 
     if (puzzle.test) {
         // Verify using random input
-        verifyProgram(test.testSets[1].input, test.testSets[1].output, program, verificationMaxCycles, solutionBytesMax);
+        tasks.push({
+            input: test.testSets[1].input,
+            output: test.testSets[1].output,
+            maxCyclesExecuted: verificationMaxCycles,
+            maxMemoryBytesAccessed: solutionBytesMax,
+        });
+    }
+
+    // Test sets are run in lockstep, so that a failure in any of them is reported without running the others to completion
+    const results = new Verifier(bytes).verifyUntilFailure(tasks);
+    for (let i = 0; i < tasks.length; i++) {
+        const result = results[i];
+        const { input, output, maxCyclesExecuted, maxMemoryBytesAccessed } = tasks[i];
+        const message = result ? getVerificationErrorMessage(result, maxCyclesExecuted, maxMemoryBytesAccessed) : undefined;
+        if (result && message !== undefined) {
+            throw new VerificationError(message, (result.cyclesExecuted <= failedRequestTraceCyclesMax)
+                ? traceProgram(bytes, input, output, result.cyclesExecuted)
+                : undefined);
+        }
     }
 }
 
@@ -289,25 +354,22 @@ function hasProperties(o: object): boolean {
     return false;
 }
 
-interface HistogramDocumentChanges {
-    [key: string]: number | Firebase.firestore.FieldValue;
-}
-
-function updateAggregationDocument(metric: Metric, oldValue: number | null, newValue: number, document: HistogramDocumentChanges): void {
+function updateAggregationDocument(metric: Metric, oldValue: number | null, newValue: number, document: CounterDocument): void {
     if (oldValue !== newValue) {
         if (typeof(oldValue) === "number" && oldValue > 0) {
-            document[createBucketKey(metric, oldValue)] = Firebase.firestore.FieldValue.increment(-1);
+            document[createBucketKey(metric, oldValue)] = -1;
         }
-        document[createBucketKey(metric, newValue)] = Firebase.firestore.FieldValue.increment(1);
+        document[createBucketKey(metric, newValue)] = 1;
     }
 }
 
 async function updatePuzzleAggregation(testName: string, oldDocument: SolutionDocument | null, newDocument: SolutionDocument): Promise<void> {
-    const changes: HistogramDocumentChanges = {};
+    const changes: CounterDocument = {};
     updateAggregationDocument(Metric.cycles, oldDocument ? oldDocument.cyclesExecuted : null, newDocument.cyclesExecuted, changes);
     updateAggregationDocument(Metric.bytes, oldDocument ? oldDocument.memoryBytesAccessed : null, newDocument.memoryBytesAccessed, changes);
     if (hasProperties(changes)) {
-        await root.doc(createPuzzleHistogramId(testName)).set(changes, { merge: true });
+        await histogramAggregator.add(createPuzzleHistogramId(testName), changes);
+        statsViews.invalidate(createPuzzleStatsViewKey(testName));
     }
 }
 
@@ -323,13 +385,16 @@ async function updateUserAndAggregation(userId: string): Promise<void> {
     const oldSolvedCount = userDocument.exists ? (userDocument.data() as UserDocument).solvedCount : null;
     const newSolvedCount = Math.min(puzzleCount, (typeof(oldSolvedCount) === "number" && !isNaN(oldSolvedCount)) ? oldSolvedCount + 1 : 1);
     if (newSolvedCount !== oldSolvedCount) {
-        const changes: HistogramDocumentChanges = {};
+        const changes: CounterDocument = {};
         updateAggregationDocument(Metric.solutions, oldSolvedCount, newSolvedCount, changes);
 
         await Promise.all([
             userDocumentReference.set({ solvedCount: Firebase.firestore.FieldValue.increment(1) }, { merge: true }),
-            root.doc(createUserHistogramId()).set(changes, { merge: true }),
+            histogramAggregator.add(createUserHistogramId(), changes),
         ]);
+
+        statsViews.invalidate(userStatsViewKey);
+        statsViews.invalidate(leaderboardViewKey);
     }
 }
 
@@ -424,17 +489,17 @@ router.put(Contract.UserProfileRoute, Validize.handle({
 // User stats
 router.get(Contract.UserStatsRoute, Validize.handle({
     validateQuery: Validize.createValidator<Contract.UserStatsRequestQuery>({ userId: Validize.createOptionalValidator(validateUserId) }),
-    process: (request) => getUserStats(request.query.userId),
+    process: (request, context) => getUserStats(context, request.query.userId),
 }));
 
 router.get(Contract.LeaderboardRoute, Validize.handle({
-    process: () => getLeaderboard(),
+    process: (request, context) => getLeaderboard(context),
 }));
 
 // Puzzle stats
 router.get(Contract.PuzzleStatsRoute, Validize.handle({
     validateParameters: Validize.createValidator<Contract.PuzzleStatsRequestParameters>({ testName: validateTestName }),
-    process: (request) => getPuzzleStats(request.parameters.testName),
+    process: (request, context) => getPuzzleStats(request.parameters.testName, context),
 }));
 
 // Upload solution
@@ -458,6 +523,16 @@ router.post(Contract.SolutionUploadRoute, Validize.handle({
 // Set up app and handler
 const app = new Koa();
 app.use(Cors());
+
+// Conditional responses: if the client already has the current version (per ETag), skip the body
+app.use(async (context, next) => {
+    await next();
+    if (context.status === 200 && context.response.etag && context.fresh) {
+        context.status = 304;
+        context.body = null;
+    }
+});
+
 app.use(BodyParser({ extendTypes: { json: [ "text/plain" ] } }));
 app.use(router.routes());
 // app.use(router.allowedMethods());
@@ -0,0 +1,66 @@
+import * as Firebase from "firebase-admin";
+
+// Minimal storage interface for counter documents (i.e. histograms), so that aggregation can be exercised locally using
+// MemoryDocumentStore instead of Firestore
+
+export interface CounterDocument {
+    [key: string]: number;
+}
+
+export interface DocumentStore {
+    /** Returns the requested documents, in order (with undefined for missing documents) */
+    getAll(ids: string[]): Promise<(CounterDocument | undefined)[]>;
+
+    /** Adds amounts to a document's counters, creating the document and/or counters as needed */
+    increment(id: string, amounts: CounterDocument): Promise<void>;
+}
+
+export class FirestoreDocumentStore implements DocumentStore {
+    constructor(private collection: Firebase.firestore.CollectionReference) {
+    }
+
+    public async getAll(ids: string[]): Promise<(CounterDocument | undefined)[]> {
+        if (ids.length === 0) {
+            return [];
+        }
+
+        const snapshots = await this.collection.firestore.getAll(...ids.map(id => this.collection.doc(id)));
+        return snapshots.map(snapshot => snapshot.exists ? (snapshot.data() as CounterDocument) : undefined);
+    }
+
+    public async increment(id: string, amounts: CounterDocument): Promise<void> {
+        const changes: { [key: string]: Firebase.firestore.FieldValue } = {};
+        for (const key in amounts) {
+            changes[key] = Firebase.firestore.FieldValue.increment(amounts[key]);
+        }
+
+        await this.collection.doc(id).set(changes, { merge: true });
+    }
+}
+
+/** In-memory stand-in for Firestore (for local testing and tools); also counts writes */
+export class MemoryDocumentStore implements DocumentStore {
+    public readonly documents = new Map<string, CounterDocument>();
+    public writeCount = 0;
+
+    public async getAll(ids: string[]): Promise<(CounterDocument | undefined)[]> {
+        return ids.map(id => {
+            const document = this.documents.get(id);
+            return document ? { ...document } : undefined;
+        });
+    }
+
+    public async increment(id: string, amounts: CounterDocument): Promise<void> {
+        let document = this.documents.get(id);
+        if (!document) {
+            document = {};
+            this.documents.set(id, document);
+        }
+
+        for (const key in amounts) {
+            document[key] = (document[key] ?? 0) + amounts[key];
+        }
+
+        this.writeCount++;
+    }
+}
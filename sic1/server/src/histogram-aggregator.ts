@@ -0,0 +1,109 @@
+import { CounterDocument, DocumentStore } from "./document-store";
+
+// Histogram updates all target a handful of documents (one per puzzle, plus one for users), so concurrent submissions
+// contend for the same document. To avoid this, each histogram's counters are spread across several "shard" documents
+// (summed when reading). Optionally, changes to the same histogram that arrive within a short window can also be combined
+// into a single write, but this only helps when one process handles many concurrent submissions (a serverless instance
+// handles one request at a time, so there it would just add latency), so it's disabled by default.
+//
+// Note: the original (unsharded) histogram document is still included when reading, so existing data is preserved.
+
+export interface HistogramAggregatorOptions {
+    shardCount: number;
+    coalesceWindowMS?: number; // Zero (the default) writes each change immediately
+}
+
+interface PendingChange {
+    amounts: CounterDocument;
+    resolve: () => void;
+    reject: (reason: unknown) => void;
+}
+
+export function createShardId(histogramId: string, shard: number): string {
+    return `${histogramId}_Shard${shard}`;
+}
+
+export class HistogramAggregator {
+    private pendingChanges = new Map<string, PendingChange[]>();
+
+    constructor(private store: DocumentStore, private options: HistogramAggregatorOptions) {
+    }
+
+    /** Writes (or queues, if coalescing) changes to a histogram's counters; the promise resolves once they're written */
+    public add(histogramId: string, amounts: CounterDocument): Promise<void> {
+        const coalesceWindowMS = this.options.coalesceWindowMS ?? 0;
+        if (coalesceWindowMS <= 0) {
+            return this.write(histogramId, amounts);
+        }
+
+        let pendingChanges = this.pendingChanges.get(histogramId);
+        if (!pendingChanges) {
+            pendingChanges = [];
+            this.pendingChanges.set(histogramId, pendingChanges);
+            setTimeout(() => this.flush(histogramId), coalesceWindowMS);
+        }
+
+        const changes = pendingChanges;
+        return new Promise<void>((resolve, reject) => changes.push({ amounts, resolve, reject }));
+    }
+
+    /** Reads a histogram, summing the counters from the original document and all of its shards */
+    public async read(histogramId: string): Promise<CounterDocument> {
+        const ids = [histogramId];
+        for (let i = 0; i < this.options.shardCount; i++) {
+            ids.push(createShardId(histogramId, i));
+        }
+
+        const merged: CounterDocument = {};
+        for (const document of await this.store.getAll(ids)) {
+            if (document) {
+                for (const key in document) {
+                    const value = document[key];
+                    if (typeof(value) === "number") {
+                        merged[key] = (merged[key] ?? 0) + value;
+                    }
+                }
+            }
+        }
+        return merged;
+    }
+
+    private async flush(histogramId: string): Promise<void> {
+        const pendingChanges = this.pendingChanges.get(histogramId)!;
+        this.pendingChanges.delete(histogramId);
+
+        const combined: CounterDocument = {};
+        for (const { amounts } of pendingChanges) {
+            for (const key in amounts) {
+                combined[key] = (combined[key] ?? 0) + amounts[key];
+            }
+        }
+
+        try {
+            await this.write(histogramId, combined);
+            pendingChanges.forEach(({ resolve }) => resolve());
+        } catch {
+            // The combined write failed (and, being a single write, changed nothing), so write each change on its own, in
+            // order to only fail the callers whose changes couldn't be written
+            await Promise.all(pendingChanges.map(({ amounts, resolve, reject }) => this.write(histogramId, amounts).then(resolve, reject)));
+        }
+    }
+
+    private async write(histogramId: string, changes: CounterDocument): Promise<void> {
+        // Changes can cancel out (e.g. a bucket's decrement and another submission's increment)
+        const amounts: CounterDocument = {};
+        let empty = true;
+        for (const key in changes) {
+            const amount = changes[key];
+            if (amount !== 0) {
+                amounts[key] = amount;
+                empty = false;
+            }
+        }
+
+        if (!empty) {
+            const shard = Math.floor(Math.random() * this.options.shardCount);
+            await this.store.increment(createShardId(histogramId, shard), amounts);
+        }
+    }
+}
@@ -0,0 +1,59 @@
+import * as crypto from "crypto";
+
+// Precomputed ("materialized") responses for read-heavy routes, each with an ETag derived from its content, so that
+// warm function instances can serve them without reading the database and clients can revalidate them cheaply (i.e.
+// receive "304 Not Modified"). Views expire after a short time (since other instances may have updated the underlying
+// data) and are invalidated immediately when this instance updates the underlying data.
+
+export interface View<T> {
+    body: T;
+    etag: string;
+}
+
+interface CacheEntry {
+    view: Promise<View<unknown>>;
+    expires: number;
+}
+
+export function createETag(...parts: string[]): string {
+    const hash = crypto.createHash("sha1");
+    for (const part of parts) {
+        hash.update(part);
+        hash.update("\0");
+    }
+    return `"${hash.digest("base64").replace(/=+$/, "")}"`;
+}
+
+export class ViewCache {
+    private entries = new Map<string, CacheEntry>();
+
+    constructor(private timeToLiveMS: number) {
+    }
+
+    /** Returns the cached view, if it's still valid; otherwise builds a new one (note: concurrent requests share the
+     * same load) */
+    public get<T>(key: string, load: () => Promise<T>): Promise<View<T>> {
+        const now = Date.now();
+        const entry = this.entries.get(key);
+        if (entry && entry.expires > now) {
+            return entry.view as Promise<View<T>>;
+        }
+
+        const view = load().then(body => ({ body, etag: createETag(JSON.stringify(body)) }));
+        const newEntry: CacheEntry = { view, expires: now + this.timeToLiveMS };
+        this.entries.set(key, newEntry);
+
+        // Don't cache failures
+        view.catch(() => {
+            if (this.entries.get(key) === newEntry) {
+                this.entries.delete(key);
+            }
+        });
+
+        return view;
+    }
+
+    public invalidate(key: string): void {
+        this.entries.delete(key);
+    }
+}
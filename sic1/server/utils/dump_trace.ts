@@ -0,0 +1,36 @@
+import { readFileSync } from "fs";
+import * as Zlib from "zlib";
+import { Constants, TraceReader } from "sic1asm";
+
+// This is a tool for inspecting an execution trace saved with a failed request (see verifyProgram in src/api.ts). With no
+// step, all input and output events are listed; with a step, the machine state just before that step is printed.
+//
+// Usage: ts-node dump_trace.ts <trace file> [step]
+
+const [ _host, _script, path, stepString ] = process.argv;
+const reader = new TraceReader(readFileSync(path), block => Zlib.inflateRawSync(block));
+
+console.log(`Steps: ${reader.getStepCount()}`);
+if (stepString === undefined) {
+    for (const { step, input, output } of reader.getEvents()) {
+        const parts = [];
+        if (input !== undefined) {
+            parts.push(`in: ${input}`);
+        }
+        if (output !== undefined) {
+            parts.push(`out: ${output}`);
+        }
+        console.log(`${step}\t${parts.join(", ")}`);
+    }
+} else {
+    const { ip, cyclesExecuted, memoryBytesAccessed, memory, memoryAccessed } = reader.getState(parseInt(stepString));
+    console.log(`IP: ${ip}, cycles: ${cyclesExecuted}, bytes: ${memoryBytesAccessed}`);
+    for (let address = 0; address <= Constants.addressMax; address += 16) {
+        const row: string[] = [];
+        for (let i = address; i < address + 16; i++) {
+            const hex = memory[i].toString(16).padStart(2, "0");
+            row.push(memoryAccessed[i] ? hex : hex.replace(/./g, "."));
+        }
+        console.log(`${address.toString(16).padStart(2, "0")}: ${row.join(" ")}`);
+    }
+}
@@ -0,0 +1,61 @@
+import { MemoryDocumentStore } from "../src/document-store";
+import { HistogramAggregator } from "../src/histogram-aggregator";
+
+// This is a tool for checking histogram aggregation locally (using an in-memory stand-in for Firestore): it simulates a
+// burst of concurrent submissions, and then ensures the merged histogram matches the expected totals
+//
+// Usage: ts-node simulate-aggregation.ts [submissionCount] [shardCount] [coalesceWindowMS]
+
+(async () => {
+    const submissionCount = process.argv.length > 2 ? parseInt(process.argv[2]) : 1000;
+    const shardCount = process.argv.length > 3 ? parseInt(process.argv[3]) : 8;
+    const coalesceWindowMS = process.argv.length > 4 ? parseInt(process.argv[4]) : 20;
+
+    const store = new MemoryDocumentStore();
+    const aggregator = new HistogramAggregator(store, { shardCount, coalesceWindowMS });
+    const histogramId = "Histogram_Puzzle_Test";
+
+    // Seed an original (unsharded) document, to ensure it's included when reading
+    await store.increment(histogramId, { cycles10: 5 });
+    const expected: { [key: string]: number } = { cycles10: 5 };
+
+    const promises: Promise<void>[] = [];
+    for (let i = 0; i < submissionCount; i++) {
+        // Mix of new solutions and improvements (which move a solution from one bucket to another)
+        const changes: { [key: string]: number } = {};
+        const newKey = `cycles${10 * (1 + Math.floor(Math.random() * 20))}`;
+        changes[newKey] = 1;
+        if (Math.random() < 0.25 && newKey !== "cycles10") {
+            changes["cycles10"] = -1;
+        }
+
+        for (const key in changes) {
+            expected[key] = (expected[key] ?? 0) + changes[key];
+        }
+
+        promises.push(aggregator.add(histogramId, changes));
+
+        // Spread submissions over several coalescing windows
+        if (i % 100 === 99) {
+            await new Promise(resolve => setTimeout(resolve, coalesceWindowMS / 2));
+        }
+    }
+
+    await Promise.all(promises);
+
+    const actual = await aggregator.read(histogramId);
+    let mismatches = 0;
+    for (const key of Object.keys({ ...expected, ...actual })) {
+        if ((expected[key] ?? 0) !== (actual[key] ?? 0)) {
+            console.log(`Mismatch for ${key}: expected ${expected[key] ?? 0}, got ${actual[key] ?? 0}`);
+            mismatches++;
+        }
+    }
+
+    console.log(`${submissionCount} submissions resulted in ${store.writeCount - 1} writes across ${store.documents.size - 1} shards (${mismatches} mismatches)`);
+    if (mismatches > 0) {
+        process.exitCode = 1;
+    }
+})()
+    .catch((reason) => console.log(reason))
+    .then(() => null);
@@ -0,0 +1,165 @@
+import "mocha";
+import * as assert from "assert";
+import { ChildProcessWithoutNullStreams, spawn } from "child_process";
+import { connect, Socket } from "net";
+import { tmpdir } from "os";
+import { join } from "path";
+import { Assembler } from "sic1asm";
+import { Solution } from "../shared";
+import { verifySolution } from "../validation";
+
+const testName = "Data Directive and Looping";
+
+function assembleToHex(source: string): string {
+    return Assembler.assemble(source.split("\n")).bytes
+        .map(byte => ((byte + 256) % 256).toString(16).padStart(2, "0"))
+        .join("");
+}
+
+// Negates each input
+const correctProgram = assembleToHex(`
+    @loop:
+    subleq @OUT, @IN
+    subleq @zero, @zero, @loop
+    @zero: .data 0
+`);
+
+// Copies each input
+const incorrectProgram = assembleToHex(`
+    @loop:
+    subleq @tmp, @IN
+    subleq @OUT, @tmp
+    subleq @tmp, @tmp, @loop
+    @tmp: .data 0
+`);
+
+// Negates the first input, then halts
+const haltingProgram = assembleToHex(`
+    subleq @OUT, @IN
+    subleq @HALT, @HALT, @HALT
+`);
+
+function createSolution(program: string, cyclesExecuted = 100, memoryBytesAccessed = 256): Solution {
+    return { userId: "", testName, program, cyclesExecuted, memoryBytesAccessed };
+}
+
+describe("Solution verification", () => {
+    it("Accepts a correct solution", () => {
+        verifySolution(createSolution(correctProgram));
+    });
+
+    it("Rejects incorrect output", () => {
+        assert.throws(() => verifySolution(createSolution(incorrectProgram)), /^Incorrect output produced during standard input \(expected -3 but got 3 instead\); IO: not shown$/);
+        assert.throws(() => verifySolution(createSolution(incorrectProgram), true), /IO: \(3 4 5\) => \(-3 -4 -5\)$/);
+    });
+
+    it("Rejects a program that halts early", () => {
+        assert.throws(() => verifySolution(createSolution(haltingProgram)), /^Program halted during standard input before producing all output/);
+    });
+
+    it("Rejects understated cycle counts", () => {
+        assert.throws(() => verifySolution(createSolution(correctProgram, 4)), /^Execution during standard input did not complete within 4 cycles and 256 bytes/);
+    });
+});
+
+function startDaemon(...args: string[]): ChildProcessWithoutNullStreams {
+    return spawn(process.execPath, ["--require", "ts-node/register", join(__dirname, "..", "verify_daemon.ts"), ...args]);
+}
+
+function connectAsync(path: string): Promise<Socket> {
+    return new Promise<Socket>((resolve, reject) => {
+        const socket = connect(path, () => resolve(socket));
+        socket.on("error", reject);
+    });
+}
+
+// Optionally waits before reading anything (i.e. simulates a slow reader)
+function readResponsesAsync(socket: Socket, delayMS = 0): Promise<any[]> {
+    let output = "";
+    socket.pause();
+    socket.setEncoding("utf8");
+    socket.on("data", (data: string) => output += data);
+    setTimeout(() => socket.resume(), delayMS);
+    return new Promise<any[]>((resolve, reject) => {
+        socket.on("end", () => resolve(output.trim().split("\n").map(line => JSON.parse(line))));
+        socket.on("close", () => reject(new Error("Connection closed before all responses were received")));
+    });
+}
+
+describe("Verification daemon", () => {
+    it("Verifies requests on worker threads", async function () {
+        // Note: ts-node compiles the daemon (and its workers) on startup
+        this.timeout(60000);
+
+        const requests = [
+            { id: 1, testName, program: correctProgram, cyclesExecuted: 100, memoryBytesAccessed: 256 },
+            { id: 2, testName, program: incorrectProgram, cyclesExecuted: 100, memoryBytesAccessed: 256 },
+            { id: 3, testName, program: haltingProgram, cyclesExecuted: 100, memoryBytesAccessed: 256 },
+            { id: 4, testName, program: "xyz", cyclesExecuted: 100, memoryBytesAccessed: 256 },
+        ];
+
+        const daemon = startDaemon("--workers", "2");
+        let output = "";
+        daemon.stdout.setEncoding("utf8");
+        daemon.stdout.on("data", (data: string) => output += data);
+        daemon.stdin.end(requests.map(request => JSON.stringify(request)).join("\n") + "\n");
+
+        const exitCode = await new Promise<number | null>(resolve => daemon.on("close", resolve));
+        assert.strictEqual(exitCode, 0);
+
+        // Responses may arrive in any order
+        const responses = output.trim().split("\n").map(line => JSON.parse(line)).sort((a, b) => a.id - b.id);
+        assert.deepStrictEqual(responses.map(({ id, success }) => ({ id, success })), [
+            { id: 1, success: true },
+            { id: 2, success: false },
+            { id: 3, success: false },
+            { id: 4, success: false },
+        ]);
+
+        assert.ok(/^Incorrect output produced/.test(responses[1].error));
+        assert.ok(/^Program halted during standard input/.test(responses[2].error));
+        assert.strictEqual(responses[3].error, "Invalid request");
+    });
+
+    it("Survives failed connections and slow readers", async function () {
+        this.timeout(60000);
+
+        const socketPath = (process.platform === "win32") ? `\\\\.\\pipe\\sic1-verify-${process.pid}` : join(tmpdir(), `sic1-verify-${process.pid}.sock`);
+        const daemon = startDaemon("--workers", "1", "--socket", socketPath);
+        try {
+            await new Promise<void>((resolve, reject) => {
+                daemon.stderr.setEncoding("utf8");
+                daemon.stderr.on("data", (data: string) => /Listening/.test(data) && resolve());
+                daemon.on("close", () => reject(new Error("Daemon exited")));
+            });
+
+            // Abruptly reset a connection that still has requests outstanding
+            const failed = await connectAsync(socketPath);
+            failed.write(JSON.stringify({ id: 1, testName, program: correctProgram, cyclesExecuted: 100, memoryBytesAccessed: 256 }) + "\n");
+            failed.destroy();
+
+            // Send lots of (quickly rejected) requests without reading any responses for a while
+            const requestCount = 20000;
+            const slow = await connectAsync(socketPath);
+            const lines: string[] = [];
+            for (let id = 0; id < requestCount; id++) {
+                lines.push(JSON.stringify({ id, testName, program: "", cyclesExecuted: 0, memoryBytesAccessed: 0 }));
+            }
+
+            const responsesPromise = readResponsesAsync(slow, 500);
+            slow.end(lines.join("\n") + "\n");
+
+            const responses = await responsesPromise;
+            assert.strictEqual(responses.length, requestCount);
+            assert.ok(responses.every(({ success, error }) => !success && error === "Invalid request"));
+
+            // The daemon is still serving new connections
+            const healthy = await connectAsync(socketPath);
+            healthy.end(JSON.stringify({ id: 2, testName, program: correctProgram, cyclesExecuted: 100, memoryBytesAccessed: 256 }) + "\n");
+            assert.deepStrictEqual(await readResponsesAsync(healthy), [{ id: 2, success: true }]);
+            assert.strictEqual(daemon.exitCode, null);
+        } finally {
+            daemon.kill();
+        }
+    });
+});
@@ -1,4 +1,4 @@
-import { AssembledProgram, Emulator } from "sic1asm";
+import { VerificationResult, VerificationStatus, Verifier } from "sic1asm";
 import { Puzzle, shuffleInPlace, generatePuzzleTest, puzzles } from "sic1-shared";
 import { Solution } from "./shared";
 
@@ -20,35 +20,24 @@ function getPuzzle(title: string): Puzzle {
     throw `Test not found: ${title}`;
 }
 
-function verifyProgram(context: string, includeIO: boolean, inputs: number[], expectedOutputs: number[], program: AssembledProgram, maxCyclesExecuted: number, maxMemoryBytesAccessed: number): void {
-    let inputIndex = 0;
-    let outputIndex = 0;
+function getVerificationErrorMessage(context: string, result: VerificationResult, maxCyclesExecuted: number, maxMemoryBytesAccessed: number): string | undefined {
+    switch (result.status) {
+        case VerificationStatus.limitExceeded:
+            return `Execution during ${context} did not complete within ${maxCyclesExecuted} cycles and ${maxMemoryBytesAccessed} bytes (actual: ${result.cyclesExecuted} cycles, ${result.memoryBytesAccessed} bytes)`;
 
-    let correct = true;
-    let errorContext = "";
-    const emulator = new Emulator(program, {
-        readInput: () => inputs[inputIndex++],
-        writeOutput: n => {
-            const expected = expectedOutputs[outputIndex++];
-            if (n !== expected) {
-                correct = false;
-                if (errorContext === "") {
-                    errorContext = `expected ${expected} but got ${n} instead at index ${outputIndex - 1}`;
-                }
-            }
-        },
-    });
-
-    while (correct && outputIndex < expectedOutputs.length && emulator.getCyclesExecuted() <= maxCyclesExecuted && emulator.getMemoryBytesAccessed() <= maxMemoryBytesAccessed) {
-        emulator.step();
-    }
+        case VerificationStatus.incorrectOutput:
+            return `Incorrect output produced during ${context} (${result.errorContext})`;
 
-    if (emulator.getCyclesExecuted() > maxCyclesExecuted || emulator.getMemoryBytesAccessed() > maxMemoryBytesAccessed) {
-        throw `Execution during ${context} did not complete within ${maxCyclesExecuted} cycles and ${maxMemoryBytesAccessed} bytes (acutal: ${emulator.getCyclesExecuted()} cycles, ${emulator.getMemoryBytesAccessed()} bytes)`;
+        case VerificationStatus.halted:
+            return `Program halted during ${context} before producing all output`;
     }
+}
 
-    if (!correct) {
-        throw `Incorrect output produced during ${context} (${errorContext}); IO: ${includeIO ? `(${inputs.join(" ")}) => (${expectedOutputs.join(" ")})` : "not shown"}`;
+function verifyProgram(context: string, includeIO: boolean, inputs: number[], expectedOutputs: number[], verifier: Verifier, maxCyclesExecuted: number, maxMemoryBytesAccessed: number): void {
+    const result = verifier.verify(inputs, expectedOutputs, maxCyclesExecuted, maxMemoryBytesAccessed);
+    const message = getVerificationErrorMessage(context, result, maxCyclesExecuted, maxMemoryBytesAccessed);
+    if (message !== undefined) {
+        throw `${message}; IO: ${includeIO ? `(${inputs.join(" ")}) => (${expectedOutputs.join(" ")})` : "not shown"}`;
     }
 }
 
@@ -61,14 +50,10 @@ export function verifySolution(solution: Solution, includeIO: boolean = false):
         bytes.push(parseInt(solution.program.substr(i, 2), 16));
     }
 
-    const program: AssembledProgram = {
-        bytes,
-        sourceMap: [],
-        variables: [],
-    };
+    const verifier = new Verifier(bytes);
 
     // Verify using standard input and supplied stats
-    verifyProgram("standard input", includeIO, test.testSets[0].input, test.testSets[0].output, program, solution.cyclesExecuted, solution.memoryBytesAccessed);
+    verifyProgram("standard input", includeIO, test.testSets[0].input, test.testSets[0].output, verifier, solution.cyclesExecuted, solution.memoryBytesAccessed);
 
     // Verify using shuffled standard input (note: this ensures the order is different)
     const shuffledStandardIO = puzzle.io.slice();
@@ -86,13 +71,13 @@ export function verifySolution(solution: Solution, includeIO: boolean = false):
         includeIO,
         identity<number[]>([]).concat(...shuffledStandardIO.map(a => a[0])),
         identity<number[]>([]).concat(...shuffledStandardIO.map(a => a[1])),
-        program,
+        verifier,
         verificationMaxCycles,
         solutionBytesMax
     );
 
     if (puzzle.test) {
         // Verify using random input
-        verifyProgram("random input", includeIO, test.testSets[1].input, test.testSets[1].output, program, verificationMaxCycles, solutionBytesMax);
+        verifyProgram("random input", includeIO, test.testSets[1].input, test.testSets[1].output, verifier, verificationMaxCycles, solutionBytesMax);
     }
 }
@@ -0,0 +1,222 @@
+import * as net from "net";
+import * as os from "os";
+import * as readline from "readline";
+import { Worker, isMainThread, parentPort } from "worker_threads";
+import { Solution } from "./shared";
+import { verifySolution } from "./validation";
+
+// This is a long-running verification service, for verifying lots of solutions without paying for process startup (and
+// puzzle setup) each time. Requests are newline-delimited JSON, read from stdin (or from connections to a local socket,
+// with --socket), and verified concurrently on a pool of worker threads. Each response is written (as a line of JSON,
+// on the same stream as the request) as soon as it's ready, so responses may be out of order--use "id" to match them up.
+//
+// Request: {"id": 1, "testName": "...", "program": "<hex>", "cyclesExecuted": 10, "memoryBytesAccessed": 20}
+// Response: {"id": 1, "success": true} or {"id": 1, "success": false, "error": "..."}
+//
+// Usage: ts-node verify_daemon.ts [--workers <count>] [--socket <path>] < requests.ndjson > responses.ndjson
+
+interface VerifyRequest {
+    sequence: number;
+    solution: Solution;
+}
+
+interface VerifyResponse {
+    sequence: number;
+    error?: string;
+}
+
+const batchSizeMax = 256;
+const batchesPerWorkerMax = 2;
+const queuedRequestsMax = 64 * 1024; // Input is paused while more requests than this are queued
+
+if (!isMainThread) {
+    // Worker: verify batches of requests
+    parentPort!.on("message", (batch: VerifyRequest[]) => {
+        parentPort!.postMessage(batch.map<VerifyResponse>(({ sequence, solution }) => {
+            try {
+                verifySolution(solution);
+                return { sequence };
+            } catch (error) {
+                return { sequence, error: `${error}` };
+            }
+        }));
+    });
+} else {
+    interface Connection {
+        reader: readline.Interface;
+        output: NodeJS.WritableStream;
+        pendingCount: number;
+        ended: boolean;
+        outputBlocked: boolean; // Waiting for the output to drain (e.g. a slow reader)
+        dropped: boolean; // The stream failed, so responses are discarded
+        onDone: () => void;
+    }
+
+    interface PendingRequest {
+        id: unknown;
+        connection: Connection;
+    }
+
+    interface PoolWorker {
+        worker: Worker;
+        batches: number;
+    }
+
+    let workerCount = os.cpus().length;
+    let socketPath: string | undefined;
+    for (let i = 2; i < process.argv.length; i++) {
+        switch (process.argv[i]) {
+            case "--workers": workerCount = parseInt(process.argv[++i]); break;
+            case "--socket": socketPath = process.argv[++i]; break;
+            default: throw `Unknown argument: ${process.argv[i]}`;
+        }
+    }
+
+    const pending = new Map<number, PendingRequest>();
+    const queue: VerifyRequest[] = [];
+    const connections = new Set<Connection>();
+    let nextSequence = 0;
+    let inputPaused = false;
+
+    // Input is paused while too many requests are queued, or while the connection's output is backed up
+    const updateConnectionFlowControl = (connection: Connection) => {
+        if (!connection.ended) {
+            (inputPaused || connection.outputBlocked) ? connection.reader.pause() : connection.reader.resume();
+        }
+    };
+
+    const updateInputFlowControl = () => {
+        const pause = queue.length >= queuedRequestsMax;
+        if (pause !== inputPaused) {
+            inputPaused = pause;
+            connections.forEach(updateConnectionFlowControl);
+        }
+    };
+
+    const writeResponse = (connection: Connection, id: unknown, error?: string) => {
+        if (connection.dropped) {
+            return;
+        }
+
+        const written = connection.output.write(JSON.stringify(error === undefined ? { id, success: true } : { id, success: false, error }) + "\n");
+        if (!written && !connection.outputBlocked) {
+            // Stop reading more requests until the responses so far have been flushed
+            connection.outputBlocked = true;
+            updateConnectionFlowControl(connection);
+            connection.output.once("drain", () => {
+                connection.outputBlocked = false;
+                updateConnectionFlowControl(connection);
+            });
+        }
+    };
+
+    const pool: PoolWorker[] = [];
+    const dispatch = () => {
+        for (const poolWorker of pool) {
+            while (queue.length > 0 && poolWorker.batches < batchesPerWorkerMax) {
+                poolWorker.worker.postMessage(queue.splice(0, batchSizeMax));
+                poolWorker.batches++;
+            }
+        }
+        updateInputFlowControl();
+    };
+
+    const checkForCompletion = (connection: Connection) => {
+        if (connection.ended && connection.pendingCount === 0 && !connection.dropped) {
+            connection.onDone();
+        }
+    };
+
+    const dropConnection = (connection: Connection, error: Error) => {
+        // Note: outstanding requests are still verified, but their responses are discarded
+        console.error(`Connection failed: ${error.message}`);
+        connection.dropped = true;
+        connection.reader.close();
+    };
+
+    // Note: workers run this same file; under ts-node, they need to register ts-node themselves
+    const workerScript = __filename.endsWith(".ts")
+        ? `require("ts-node/register"); require(${JSON.stringify(__filename)});`
+        : __filename;
+
+    for (let i = 0; i < Math.max(1, workerCount); i++) {
+        const poolWorker: PoolWorker = {
+            worker: new Worker(workerScript, { eval: __filename.endsWith(".ts") }),
+            batches: 0,
+        };
+
+        poolWorker.worker.on("message", (responses: VerifyResponse[]) => {
+            poolWorker.batches--;
+            for (const { sequence, error } of responses) {
+                const { id, connection } = pending.get(sequence)!;
+                pending.delete(sequence);
+                writeResponse(connection, id, error);
+                connection.pendingCount--;
+                checkForCompletion(connection);
+            }
+
+            dispatch();
+        });
+
+        poolWorker.worker.on("error", (error) => {
+            console.error(`Worker failed: ${error}`);
+            process.exit(1);
+        });
+
+        pool.push(poolWorker);
+    }
+
+    const addInput = (input: NodeJS.ReadableStream, output: NodeJS.WritableStream, onDone: () => void): Connection => {
+        const reader = readline.createInterface({ input, crlfDelay: Infinity });
+        const connection: Connection = { reader, output, pendingCount: 0, ended: false, outputBlocked: false, dropped: false, onDone };
+        connections.add(connection);
+        updateConnectionFlowControl(connection);
+
+        reader.on("line", (line) => {
+            if (line.trim() === "") {
+                return;
+            }
+
+            let id: unknown = null;
+            try {
+                const request = JSON.parse(line);
+                id = request.id ?? null;
+
+                const { testName, program, cyclesExecuted, memoryBytesAccessed } = request;
+                if (typeof(testName) !== "string" || typeof(program) !== "string" || !/^([0-9a-fA-F]{2})+$/.test(program) || typeof(cyclesExecuted) !== "number" || typeof(memoryBytesAccessed) !== "number") {
+                    throw "Invalid request";
+                }
+
+                const sequence = nextSequence++;
+                pending.set(sequence, { id, connection });
+                connection.pendingCount++;
+                queue.push({ sequence, solution: { userId: "", testName, program, cyclesExecuted, memoryBytesAccessed } });
+            } catch (error) {
+                writeResponse(connection, id, (error instanceof Error) ? error.message : `${error}`);
+            }
+        });
+
+        reader.on("close", () => {
+            connections.delete(connection);
+            connection.ended = true;
+            dispatch();
+            checkForCompletion(connection);
+        });
+
+        // Requests are dispatched in batches, after each chunk of input has been processed
+        input.on("data", () => setImmediate(dispatch));
+        return connection;
+    };
+
+    if (socketPath) {
+        // Note: connections are half-open, so that clients can end their requests but still receive responses
+        // Note: a failed connection (e.g. a client reset) is dropped without affecting any others
+        const server = net.createServer({ allowHalfOpen: true }, (socket) => {
+            const connection = addInput(socket, socket, () => socket.end());
+            socket.on("error", error => dropConnection(connection, error));
+        });
+        server.listen(socketPath, () => console.error(`Listening on ${socketPath}, using ${pool.length} workers...`));
+    } else {
+        addInput(process.stdin, process.stdout, () => pool.forEach(({ worker }) => worker.terminate()));
+    }
+}
@@ -1,4 +1,4 @@
-import { Assembler, Emulator } from "sic1asm";
+import { Assembler, BufferOutputDevice, Emulator } from "sic1asm";
 
 export enum Format {
     numbers, // Default
@@ -1018,19 +1018,16 @@ subleq 18 18 0
                     ],
                     getExpectedOutput: input => input.map(seq => {
                         const input = String.fromCharCode(...seq.slice(0, seq.length - 1)).split("\n");
-                        const result = [];
-                        const emulator = new Emulator(Assembler.assemble(input), {
-                            writeOutput: n => {
-                                result.push(n);
-                            },
-                        });
+                        const stepMax = 50;
+                        const output = new BufferOutputDevice(stepMax); // Note: at most one output per step
+                        const emulator = new Emulator(Assembler.assemble(input), { output });
 
                         let step = 0;
-                        while (step++ < 50 && emulator.isRunning()) {
+                        while (step++ < stepMax && emulator.isRunning()) {
                             emulator.step();
                         }
 
-                        return result;
+                        return output.getValues();
                     }),
                 },
                 code:
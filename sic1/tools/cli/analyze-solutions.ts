@@ -0,0 +1,34 @@
+// This is a command line tool for statically analyzing downloaded solutions (without running them), writing each
+// solution's reachable instruction count, self-modification flag, and lower bound on bytes accessed as JSON. Solutions
+// that report fewer bytes than the lower bound allows (which should be impossible) are flagged as "suspicious".
+//
+// USAGE: ts-node script.ts <path to JSON file>
+
+import { readFile } from "fs/promises";
+import { performance } from "perf_hooks";
+import { analyzeProgram } from "../../../lib/src/sic1asm";
+import { Solution } from "./shared";
+
+(async () => {
+    const [ _exePath, _scriptPath, path ] = process.argv;
+    const solutions: Solution[] = JSON.parse(await readFile(path, { encoding: "utf8" }));
+
+    const start = performance.now();
+    const results = solutions.map(({ puzzleTitle, userId, cycles, bytes, program }) => {
+        const { reachable, selfModifying, minimumMemoryBytesAccessed } = analyzeProgram(program);
+        return {
+            puzzleTitle,
+            userId,
+            cycles,
+            bytes,
+            reachableInstructions: reachable.reduce((sum, r) => sum + r, 0),
+            selfModifying,
+            minimumMemoryBytesAccessed,
+            suspicious: bytes < minimumMemoryBytesAccessed,
+        };
+    });
+
+    const elapsed = performance.now() - start;
+    console.error(`Analyzed ${solutions.length} solutions in ${Math.round(elapsed)} ms (${results.filter(r => r.selfModifying).length} self-modifying, ${results.filter(r => r.suspicious).length} suspicious)`);
+    console.log(JSON.stringify(results));
+})();
@@ -0,0 +1,38 @@
+// This is a command line tool for generating the bundled stats cache (client/ts/stats-cache.ts) from the JSON written
+// by web-stats.ts and steam-stats.ts, using the compact encoding from client/ts/stats-cache-codec.ts
+//
+// USAGE: ts-node build-stats-cache.ts <web stats JSON file> <Steam stats JSON file> [output file]
+
+import { readFile, writeFile } from "fs/promises";
+import { encodeStatsCache, Sic1StatsCache } from "../../client/ts/stats-cache-codec";
+import { normalizeHistogramData } from "./shared";
+
+async function readStatsCacheAsync(path: string): Promise<Sic1StatsCache> {
+    const cache: Sic1StatsCache = JSON.parse(await readFile(path, { encoding: "utf8" }));
+    cache.userStats.solutionsByUser = normalizeHistogramData(cache.userStats.solutionsByUser);
+    for (const stats of Object.values(cache.puzzleStats)) {
+        stats.cyclesExecutedBySolution = normalizeHistogramData(stats.cyclesExecutedBySolution);
+        stats.memoryBytesAccessedBySolution = normalizeHistogramData(stats.memoryBytesAccessedBySolution);
+    }
+    return cache;
+}
+
+(async () => {
+    const [ _exePath, _scriptPath, webFile, steamFile, outputFile ] = process.argv;
+    const webStatsCache = await readStatsCacheAsync(webFile);
+    const steamStatsCache = await readStatsCacheAsync(steamFile);
+
+    await writeFile(outputFile ?? "../../client/ts/stats-cache.ts", `// Stats updated ${new Date().toISOString()}
+// Note: this file is generated by tools/cli/build-stats-cache.ts
+
+import { decodeStatsCache } from "./stats-cache-codec";
+
+export type { Sic1PuzzleStats, Sic1StatsCache } from "./stats-cache-codec";
+
+const webStatsCache = decodeStatsCache("${encodeStatsCache(webStatsCache)}");
+
+const steamStatsCache = decodeStatsCache("${encodeStatsCache(steamStatsCache)}");
+
+export { steamStatsCache, webStatsCache };
+`);
+})();
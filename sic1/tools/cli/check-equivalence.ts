@@ -0,0 +1,126 @@
+// This is a command line tool for checking downloaded solutions against reference solutions (one per puzzle, e.g. known
+// good solutions in the same format), by exhaustively searching input sequences up to a given length for one where the
+// solution's output differs from the reference's. Each input is drawn from the values in the puzzle's standard input.
+// Identical programs are only checked once, and checks are spread across worker threads.
+//
+// USAGE: ts-node script.ts <path to JSON file> <path to reference JSON file> [max inputs] [worker count]
+
+import * as os from "os";
+import { readFile } from "fs/promises";
+import { performance } from "perf_hooks";
+import { isMainThread, parentPort, workerData } from "worker_threads";
+import { generatePuzzleTest, puzzleFlatArray } from "../../shared/puzzles";
+import { checkEquivalence, EquivalenceResult, EquivalenceStatus } from "../../../lib/src/sic1asm";
+import { createWorker, Solution } from "./shared";
+
+interface CheckRequest {
+    puzzleTitle: string;
+    program: number[];
+    reference: number[];
+}
+
+interface CheckData {
+    requests: CheckRequest[];
+    maxInputs: number;
+}
+
+const maxCyclesPerInput = 10000;
+const maxStates = 200000;
+
+function getInputValues(puzzleTitle: string): number[] {
+    const puzzle = puzzleFlatArray.find(p => p.title === puzzleTitle);
+    const values = new Set(generatePuzzleTest(puzzle).testSets[0].input);
+    return Array.from(values).sort((a, b) => a - b);
+}
+
+if (!isMainThread) {
+    // Worker: check a batch of unique programs
+    const { requests, maxInputs }: CheckData = workerData;
+    const inputValuesCache = new Map<string, number[]>();
+    const results = requests.map<EquivalenceResult>(({ puzzleTitle, program, reference }) => {
+        let inputValues = inputValuesCache.get(puzzleTitle);
+        if (!inputValues) {
+            inputValues = getInputValues(puzzleTitle);
+            inputValuesCache.set(puzzleTitle, inputValues);
+        }
+
+        return checkEquivalence(program, reference, { inputValues, maxInputs, maxCyclesPerInput, maxStates });
+    });
+
+    parentPort!.postMessage(results);
+} else {
+    (async () => {
+        const [ _exePath, _scriptPath, path, referencePath, maxInputsString, workersString ] = process.argv;
+        const maxInputs = maxInputsString ? parseInt(maxInputsString) : 4;
+        const workerCount = Math.max(1, workersString ? parseInt(workersString) : os.cpus().length);
+
+        const solutions: Solution[] = JSON.parse(await readFile(path, { encoding: "utf8" }));
+        const references = new Map<string, number[]>();
+        for (const { puzzleTitle, program } of JSON.parse(await readFile(referencePath, { encoding: "utf8" })) as Solution[]) {
+            if (!references.has(puzzleTitle)) {
+                references.set(puzzleTitle, program);
+            }
+        }
+
+        // Only check each distinct program once
+        const requestIndexes = new Map<string, number>();
+        const requests: CheckRequest[] = [];
+        const solutionRequestIndexes = solutions.map(({ puzzleTitle, program }) => {
+            const reference = references.get(puzzleTitle);
+            if (!reference) {
+                return -1;
+            }
+
+            const key = `${puzzleTitle}:${program.join(",")}`;
+            let index = requestIndexes.get(key);
+            if (index === undefined) {
+                index = requests.length;
+                requestIndexes.set(key, index);
+                requests.push({ puzzleTitle, program, reference });
+            }
+
+            return index;
+        });
+
+        // Split the requests into contiguous batches (one per worker)
+        const start = performance.now();
+        const batches: Promise<EquivalenceResult[]>[] = [];
+        const batchSize = Math.ceil(requests.length / workerCount);
+        for (let i = 0; i < requests.length; i += batchSize) {
+            const data: CheckData = { requests: requests.slice(i, i + batchSize), maxInputs };
+            const worker = createWorker(__filename, data);
+            batches.push(new Promise<EquivalenceResult[]>((resolve, reject) => {
+                worker.on("message", resolve);
+                worker.on("error", reject);
+            }));
+        }
+
+        const results = ([] as EquivalenceResult[]).concat(...await Promise.all(batches));
+        const elapsed = performance.now() - start;
+
+        const counts = [0, 0, 0];
+        solutions.forEach(({ puzzleTitle, userId, cycles, bytes }, index) => {
+            const requestIndex = solutionRequestIndexes[index];
+            const header = `${puzzleTitle}\t${userId}\t(${cycles ? `cycles: ${cycles}` : `bytes: ${bytes}`})`;
+            if (requestIndex < 0) {
+                console.log(`${header}\tNo reference solution`);
+                return;
+            }
+
+            const { status, counterexample } = results[requestIndex];
+            counts[status]++;
+            if (status === EquivalenceStatus.equivalent) {
+                console.log(`${header}\tEquivalent (up to ${maxInputs} inputs)`);
+            } else if (counterexample) {
+                const { errorContext, inputs, expectedOutputs } = counterexample;
+                console.log(`${header}\t*** Incorrect! *** (${errorContext}); IO: (${inputs.join(" ")}) => (${expectedOutputs.join(" ")})`);
+            } else {
+                console.log(`${header}\tInconclusive (search exceeded ${maxStates} states)`);
+            }
+        });
+
+        const statesExplored = results.reduce((sum, r) => sum + r.statesExplored, 0);
+        const cacheHits = results.reduce((sum, r) => sum + r.cacheHits, 0);
+        console.error(`Checked ${requests.length} distinct programs (of ${solutions.length} solutions) in ${Math.round(elapsed)} ms (solutions: ${counts[EquivalenceStatus.equivalent]} equivalent, ${counts[EquivalenceStatus.counterexample]} incorrect, ${counts[EquivalenceStatus.limitExceeded]} inconclusive; ${statesExplored} states explored, ${cacheHits} cache hits)`);
+    })();
+}
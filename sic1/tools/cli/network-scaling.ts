@@ -0,0 +1,233 @@
+// This is a command line tool for measuring how a network of SIC-1 cores scales with thread count. A pipeline of stages
+// (each one reads a value, does some busy work, and writes the value plus one) is split into contiguous partitions, one
+// per worker thread. Cores within a partition are connected by ordinary channels and scheduled cooperatively (see
+// Network in sic1asm.ts); partitions are connected by lock-free single-producer, single-consumer queues in shared
+// memory. Idle workers sleep until another thread reads or writes a shared queue.
+//
+// USAGE: ts-node script.ts [stage count] [value count] [busy loop iterations per value] [max thread count]
+
+import * as os from "os";
+import { performance } from "perf_hooks";
+import { isMainThread, parentPort, workerData } from "worker_threads";
+import { Assembler, Network, NetworkChannel, NetworkCore, NetworkStatus } from "../../../lib/src/sic1asm";
+import { createWorker } from "./shared";
+
+interface PartitionData {
+    stageCount: number;
+    work: number;
+    input: SharedArrayBuffer;
+    output: SharedArrayBuffer;
+    control: SharedArrayBuffer;
+}
+
+interface PartitionResult {
+    cyclesExecuted: number;
+    stalls: number;
+}
+
+// Control block layout (Int32Array)
+const controlActivity = 0; // Incremented (and waited on) whenever a shared queue is read or written
+const controlDone = 1;
+const controlReady = 2; // Number of workers that have finished starting up
+const controlLength = 3;
+
+const idleWaitMilliseconds = 10;
+
+/** Single-producer, single-consumer queue in a SharedArrayBuffer (head, tail, then values) */
+class SharedChannel implements NetworkChannel {
+    private readonly state: Int32Array;
+    private readonly control: Int32Array;
+    private readonly capacity: number;
+
+    public static createBuffer(capacity: number): SharedArrayBuffer {
+        return new SharedArrayBuffer((2 + capacity) * Int32Array.BYTES_PER_ELEMENT);
+    }
+
+    constructor(buffer: SharedArrayBuffer, control: SharedArrayBuffer) {
+        this.state = new Int32Array(buffer);
+        this.control = new Int32Array(control);
+        this.capacity = this.state.length - 2;
+    }
+
+    public get length(): number {
+        return Atomics.load(this.state, 1) - Atomics.load(this.state, 0);
+    }
+
+    public canRead(): boolean {
+        return this.length > 0;
+    }
+
+    public read(): number {
+        const head = this.state[0];
+        const value = this.state[2 + (head % this.capacity)];
+        Atomics.store(this.state, 0, head + 1);
+        this.signal();
+        return value;
+    }
+
+    public canWrite(): boolean {
+        return this.length < this.capacity;
+    }
+
+    public write(value: number): void {
+        const tail = this.state[1];
+        this.state[2 + (tail % this.capacity)] = value;
+        Atomics.store(this.state, 1, tail + 1);
+        this.signal();
+    }
+
+    private signal(): void {
+        Atomics.add(this.control, controlActivity, 1);
+        Atomics.notify(this.control, controlActivity);
+    }
+}
+
+function assembleStage(work: number): number[] {
+    return Assembler.assemble(`
+        @loop:
+        subleq @tmp, @IN
+        subleq @tmp, @one
+        subleq @count, @count
+        subleq @count, @work
+
+        @busy:
+        subleq @count, @minusOne, @busy
+
+        subleq @OUT, @tmp
+        subleq @tmp, @tmp, @loop
+
+        @one: .data 1
+        @minusOne: .data -1
+        @work: .data ${work}
+        @count: .data 0
+        @tmp: .data 0
+    `.split("\n")).bytes;
+}
+
+if (!isMainThread) {
+    // Worker: run a partition of the pipeline until the main thread says the run is done
+    const { stageCount, work, input, output, control }: PartitionData = workerData;
+    const controlArray = new Int32Array(control);
+    const bytes = assembleStage(work);
+    const network = new Network();
+    const cores: NetworkCore[] = [];
+    for (let i = 0; i < stageCount; i++) {
+        cores.push(network.addCore(bytes));
+        if (i > 0) {
+            network.connect(cores[i - 1], cores[i], 4);
+        }
+    }
+
+    cores[0].input = new SharedChannel(input, control);
+    cores[stageCount - 1].output = new SharedChannel(output, control);
+
+    Atomics.add(controlArray, controlReady, 1);
+    while (!Atomics.load(controlArray, controlDone)) {
+        const activity = Atomics.load(controlArray, controlActivity);
+        if (network.run(Infinity) === NetworkStatus.halted) {
+            break;
+        }
+
+        // Every core is waiting on a neighboring partition
+        Atomics.wait(controlArray, controlActivity, activity, idleWaitMilliseconds);
+    }
+
+    const result: PartitionResult = {
+        cyclesExecuted: network.cyclesExecuted,
+        stalls: cores.reduce((sum, core) => sum + core.stalls, 0),
+    };
+
+    parentPort!.postMessage(result);
+} else {
+    const [ _exePath, _scriptPath, stagesString, valuesString, workString, threadsString ] = process.argv;
+    const stageCount = stagesString ? parseInt(stagesString) : 32;
+    const valueCount = valuesString ? parseInt(valuesString) : 20000;
+    const work = workString ? parseInt(workString) : 50;
+    const threadCountMax = Math.min(stageCount, threadsString ? parseInt(threadsString) : os.cpus().length);
+
+    const runPipeline = async (threadCount: number) => {
+        const control = new SharedArrayBuffer(controlLength * Int32Array.BYTES_PER_ELEMENT);
+        const controlArray = new Int32Array(control);
+        const buffers = [SharedChannel.createBuffer(valueCount)];
+        for (let i = 1; i < threadCount; i++) {
+            buffers.push(SharedChannel.createBuffer(4));
+        }
+
+        buffers.push(SharedChannel.createBuffer(valueCount));
+        const source = new SharedChannel(buffers[0], control);
+        const sink = new SharedChannel(buffers[threadCount], control);
+
+        // Start the workers, wait for them to be ready (so startup isn't measured), then feed the input all at once
+        const results: Promise<PartitionResult>[] = [];
+        for (let i = 0; i < threadCount; i++) {
+            const partitionStart = Math.floor(stageCount * i / threadCount);
+            const partitionEnd = Math.floor(stageCount * (i + 1) / threadCount);
+            const data: PartitionData = {
+                stageCount: partitionEnd - partitionStart,
+                work,
+                input: buffers[i],
+                output: buffers[i + 1],
+                control,
+            };
+
+            const worker = createWorker(__filename, data);
+            results.push(new Promise<PartitionResult>((resolve, reject) => {
+                worker.on("message", resolve);
+                worker.on("error", reject);
+            }));
+        }
+
+        while (Atomics.load(controlArray, controlReady) < threadCount) {
+            await new Promise(resolve => setTimeout(resolve, 1));
+        }
+
+        const start = performance.now();
+        for (let i = 0; i < valueCount; i++) {
+            source.write((i % 200) - 100);
+        }
+
+        // Wait for every value to come out of the pipeline (without blocking message delivery from the workers)
+        while (sink.length < valueCount) {
+            await new Promise(resolve => setTimeout(resolve, 1));
+        }
+
+        const elapsed = performance.now() - start;
+        Atomics.store(controlArray, controlDone, 1);
+        Atomics.notify(controlArray, controlActivity);
+        const partitions = await Promise.all(results);
+
+        for (let i = 0; i < valueCount; i++) {
+            const expected = ((((i % 200) - 100) + stageCount + 128) & 0xff) - 128;
+            if (sink.read() !== expected) {
+                throw new Error(`Incorrect output at index ${i} with ${threadCount} threads`);
+            }
+        }
+
+        return {
+            elapsed,
+            cyclesExecuted: partitions.reduce((sum, p) => sum + p.cyclesExecuted, 0),
+            stalls: partitions.reduce((sum, p) => sum + p.stalls, 0),
+        };
+    };
+
+    (async () => {
+        console.log(`Stages: ${stageCount}, values: ${valueCount}, busy loop iterations: ${work}`);
+        console.log("Threads\tTime (ms)\tCycles\tMcycles/s\tStalls\tSpeedup");
+        const threadCounts: number[] = [];
+        for (let threadCount = 1; threadCount < threadCountMax; threadCount *= 2) {
+            threadCounts.push(threadCount);
+        }
+
+        threadCounts.push(threadCountMax);
+
+        let baseline: number | undefined;
+        for (const threadCount of threadCounts) {
+            const { elapsed, cyclesExecuted, stalls } = await runPipeline(threadCount);
+            if (baseline === undefined) {
+                baseline = elapsed;
+            }
+
+            console.log(`${threadCount}\t${Math.round(elapsed)}\t${cyclesExecuted}\t${(cyclesExecuted / elapsed / 1000).toFixed(1)}\t${stalls}\t${(baseline / elapsed).toFixed(2)}`);
+        }
+    })();
+}
@@ -0,0 +1,70 @@
+// This is a command line tool for profiling downloaded solutions (on each puzzle's standard test set), writing
+// per-instruction execution/branch counts and per-address read/write counts as JSON for further analysis
+//
+// USAGE: ts-node script.ts <path to JSON file> [max cycles]
+
+import { readFile } from "fs/promises";
+import { generatePuzzleTest, puzzleFlatArray } from "../../shared/puzzles";
+import { AssembledProgram, BufferOutputDevice, Emulator, SpanInputDevice, summarizeProfile } from "../../../lib/src/sic1asm";
+import { Solution } from "./shared";
+
+function profileSolution(title: string, program: number[], maxCyclesExecuted: number) {
+    const puzzle = puzzleFlatArray.find(p => p.title === title);
+    const { input, output } = generatePuzzleTest(puzzle).testSets[0];
+
+    // Note: downloaded solutions don't include source, so results are by address rather than by line
+    const assembledProgram: AssembledProgram = {
+        bytes: program,
+        sourceMap: [],
+        variables: [],
+    };
+
+    const outputDevice = new BufferOutputDevice(output.length);
+    const emulator = new Emulator(assembledProgram, {
+        input: new SpanInputDevice(input),
+        output: outputDevice,
+    });
+
+    const profile = emulator.enableProfiling();
+    while (emulator.isRunning() && !outputDevice.isDone() && emulator.getCyclesExecuted() < maxCyclesExecuted) {
+        emulator.step();
+    }
+
+    const instructions: { address: number, executions: number, branchesTaken: number, branchesNotTaken: number }[] = [];
+    for (let address = 0; address < profile.executionCounts.length; address++) {
+        const executions = profile.executionCounts[address];
+        if (executions > 0) {
+            instructions.push({
+                address,
+                executions,
+                branchesTaken: profile.branchTakenCounts[address],
+                branchesNotTaken: profile.branchNotTakenCounts[address],
+            });
+        }
+    }
+
+    const { cyclesExecuted, addresses } = summarizeProfile(assembledProgram, profile);
+    return {
+        completed: outputDevice.isDone(),
+        cyclesExecuted,
+        memoryBytesAccessed: emulator.getMemoryBytesAccessed(),
+        instructions,
+        addresses,
+    };
+}
+
+(async () => {
+    const [ _exePath, _scriptPath, path, maxCycles ] = process.argv;
+    const maxCyclesExecuted = maxCycles ? parseInt(maxCycles) : 10000;
+
+    const solutions: Solution[] = JSON.parse(await readFile(path, { encoding: "utf8" }));
+    const results = solutions.map(({ puzzleTitle, userId, cycles, bytes, program }) => ({
+        puzzleTitle,
+        userId,
+        cycles,
+        bytes,
+        profile: profileSolution(puzzleTitle, program, maxCyclesExecuted),
+    }));
+
+    console.log(JSON.stringify(results));
+})();
@@ -1,4 +1,7 @@
 import { readFile } from "fs/promises";
+import { Worker } from "worker_threads";
+import * as Contract from "../../server/contract/contract";
+import { RankIndex } from "../../client/ts/rank-index";
 
 export interface Solution {
     puzzleTitle: string;
@@ -19,3 +22,19 @@ export function unhexifyBytes(text: string): number[] {
     }
     return result;
 }
+
+// Starts a worker thread running the given script (i.e. the caller's __filename). Under ts-node, workers need to register
+// ts-node themselves, so TypeScript scripts are loaded via an evaluated bootstrap.
+export function createWorker(fileName: string, workerData?: unknown): Worker {
+    const isTypeScript = fileName.endsWith(".ts");
+    const workerScript = isTypeScript
+        ? `require("ts-node/register"); require(${JSON.stringify(fileName)});`
+        : fileName;
+
+    return new Worker(workerScript, { eval: isTypeScript, workerData });
+}
+
+// Histograms are stored sorted (with duplicate scores merged), i.e. in the form rank indexes are serialized in
+export function normalizeHistogramData(data: Contract.HistogramData): Contract.HistogramData {
+    return RankIndex.fromHistogramData(data).toHistogramData();
+}
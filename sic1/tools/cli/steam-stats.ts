@@ -7,19 +7,10 @@ import { puzzleFlatArray } from "../../shared/puzzles";
 import * as Contract from "../../server/contract/contract";
 import type { Sic1PuzzleStats, Sic1StatsCache } from "../../client/ts/stats-cache";
 import { getLeaderboardEntriesAsync, getLeaderboardsForGameAsync, LeaderboardEntry } from "./steam-api";
-import { getAppIdAsync } from "./shared";
+import { getAppIdAsync, normalizeHistogramData } from "./shared";
 
 function convertLeaderboardEntriesToHistogram(entries: LeaderboardEntry[]): Contract.HistogramData {
-    const scoreToCount: { [score: number]: number } = {};
-    for (const { score } of entries) {
-        const previousValue = scoreToCount[score];
-        scoreToCount[score] = previousValue ? (previousValue + 1) : 1;
-    }
-
-    return Object.entries(scoreToCount).map(([bucketMax, count]) => ({
-        bucketMax: parseInt(bucketMax),
-        count,
-    }));
+    return normalizeHistogramData(entries.map(({ score }) => ({ bucketMax: score, count: 1 })));
 }
 
 function convertHistogramDataToCSV(group: string, metric: string, data: Contract.HistogramData): string {
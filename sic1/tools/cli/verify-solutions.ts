@@ -1,77 +1,28 @@
-// This is a command line tool for validating downloaded solutions
+// This is a command line tool for validating downloaded solutions (optionally against several random test sets)
 //
-// USAGE: ts-node script.ts <path to JSON file>
+// USAGE: ts-node script.ts <path to JSON file> [random test set count]
 
 import { readFile } from "fs/promises";
 import { generatePuzzleTest, puzzleFlatArray, shuffleInPlace } from "../../shared/puzzles";
-import { AssembledProgram, Emulator } from "../../../lib/src/sic1asm";
+import { Verifier, VerificationStatus } from "../../../lib/src/sic1asm";
 import { Solution } from "./shared";
 
-function verifyProgram(inputs: number[], expectedOutputs: number[], program: AssembledProgram, maxCyclesExecuted: number, maxMemoryBytesAccessed: number, context?: string): boolean {
-    let inputIndex = 0;
-    let outputIndex = 0;
-    let correct = true;
-
-    const assert = {
-        fail: (a?, context?) => correct = false,
-        strictEqual: (a, b, context?) => {
-            if (a !== b) {
-                // console.log(`Error: ${a} !== ${b} (${context})`);
-                correct = false;
-            }
-        },
-    }
-    const emulator = new Emulator(program, {
-        readInput: () => inputs[inputIndex++],
-        writeOutput: n => {
-            const expected = expectedOutputs[outputIndex++];
-            if (n !== expected) {
-                correct = false;
-            }
-
-            assert.strictEqual(n, expected, context);
-        },
-    });
-
-    assert.strictEqual(emulator.isRunning(), true);
-
-    while (correct && outputIndex < expectedOutputs.length) {
-        if (emulator.getCyclesExecuted() > maxCyclesExecuted || emulator.getMemoryBytesAccessed() > maxMemoryBytesAccessed) {
-            assert.fail("Execution did not complete", context);
-            break;
-        }
-
-        emulator.step();
-    }
-
-    assert.strictEqual(correct, true, "Successful");
-
-    // console.log(`Cycles: ${emulator.getCyclesExecuted()}; bytes: ${emulator.getMemoryBytesAccessed()}`);
-
-    return correct;
-}
-
-function verifySolution(title: string, program: number[]): boolean {
+function verifySolution(title: string, program: number[], randomTestCount: number): boolean {
     const puzzle = puzzleFlatArray.find(p => p.title === title);
     const test = generatePuzzleTest(puzzle);
     const maxCycles = 10000;
     const maxBytes = 256;
+    const verifier = new Verifier(program);
     let correct = true;
 
-    function validate(value: boolean): void {
-        if (!value) {
+    function validate(inputs: number[], expectedOutputs: number[]): void {
+        if (verifier.verify(inputs, expectedOutputs, maxCycles, maxBytes).status !== VerificationStatus.correct) {
             correct = false;
         }
     }
 
     // Verify using standard input
-    const assembledProgram: AssembledProgram = {
-        bytes: program,
-        sourceMap: [],
-        variables: [],
-    };
-
-    validate(verifyProgram(test.testSets[0].input, test.testSets[0].output, assembledProgram, maxCycles, maxBytes, "Standard"));
+    validate(test.testSets[0].input, test.testSets[0].output);
 
     // Verify using shuffled standard input (note: this ensures the order is different)
     const shuffeldStandardIO = puzzle.io.slice();
@@ -84,21 +35,30 @@ function verifySolution(title: string, program: number[]): boolean {
         shuffeldStandardIO[1] = originalFirst;
     }
 
-    validate(verifyProgram([].concat(...shuffeldStandardIO.map(a => a[0])), [].concat(...shuffeldStandardIO.map(a => a[1])), assembledProgram, maxCycles, maxBytes, "Standard shuffled"));
+    validate([].concat(...shuffeldStandardIO.map(a => a[0])), [].concat(...shuffeldStandardIO.map(a => a[1])));
 
     if (puzzle.test) {
-        // Verify using random input
-        validate(verifyProgram(test.testSets[1].input, test.testSets[1].output, assembledProgram, maxCycles, maxBytes, "Random"));
+        // Verify using random input (note: random tests all start with the puzzle's fixed tests, so that shared prefix
+        // only gets run once)
+        const randomTestSets = [test.testSets[1]];
+        for (let i = 1; i < randomTestCount; i++) {
+            randomTestSets.push(generatePuzzleTest(puzzle).testSets[1]);
+        }
+
+        if (verifier.verifyTestSets(randomTestSets, maxCycles, maxBytes).some(result => result.status !== VerificationStatus.correct)) {
+            correct = false;
+        }
     }
 
     return correct;
 }
 
 (async () => {
-    const [ _exePath, _scriptPath, path ] = process.argv;
+    const [ _exePath, _scriptPath, path, randomTests ] = process.argv;
+    const randomTestCount = randomTests ? parseInt(randomTests) : 1;
 
     const solutions: Solution[] = JSON.parse(await readFile(path, { encoding: "utf8" }));
     for (const { puzzleTitle, userId, cycles, bytes, program } of solutions) {
-        console.log(`${userId}\t(${cycles ? `cycles: ${cycles}` : `bytes: ${bytes}`})${verifySolution(puzzleTitle, program) ? "" : " *** Invalid! ***"}`);
+        console.log(`${userId}\t(${cycles ? `cycles: ${cycles}` : `bytes: ${bytes}`})${verifySolution(puzzleTitle, program, randomTestCount) ? "" : " *** Invalid! ***"}`);
     }
 })();
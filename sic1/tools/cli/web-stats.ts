@@ -3,16 +3,22 @@
 import { Sic1WebService } from "../../client/ts/service";
 import { puzzleFlatArray } from "../../shared/puzzles";
 import type { Sic1PuzzleStats, Sic1StatsCache } from "../../client/ts/stats-cache";
+import { normalizeHistogramData } from "./shared";
 
 (async () => {
     const service = new Sic1WebService();
     const puzzleStats: Sic1PuzzleStats = {};
     for (const { title } of puzzleFlatArray) {
-        puzzleStats[title] = await service.getPuzzleStatsRawAsync(title);
+        const { cyclesExecutedBySolution, memoryBytesAccessedBySolution } = await service.getPuzzleStatsRawAsync(title);
+        puzzleStats[title] = {
+            cyclesExecutedBySolution: normalizeHistogramData(cyclesExecutedBySolution),
+            memoryBytesAccessedBySolution: normalizeHistogramData(memoryBytesAccessedBySolution),
+        };
     }
     
+    const userStats = await service.getUserStatsRawAsync();
     const cache: Sic1StatsCache = {
-        userStats: await service.getUserStatsRawAsync(),
+        userStats: { ...userStats, solutionsByUser: normalizeHistogramData(userStats.solutionsByUser) },
         puzzleStats,
     };
     